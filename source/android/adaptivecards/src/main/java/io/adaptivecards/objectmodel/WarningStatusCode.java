@@ -16,7 +16,8 @@ public enum WarningStatusCode {
   InteractivityNotSupported,
   MaxActionsExceeded,
   AssetLoadFailed,
-  UnsupportedSchemaVersion;
+  UnsupportedSchemaVersion,
+  DuplicateId;
 
   public final int swigValue() {
     return swigValue;
@@ -288,9 +288,14 @@ using namespace AdaptiveCards;
 // find date and time string, and replace them in NSDateFormatterCompactStyle, NSDateFormatterMediumStyle or
 // NSDateFormatterLongStyle of local language
 + (std::string) getLocalizedDate:(std::shared_ptr<TextBlock> const &)txtBlck
+{
+    return [ACOHostConfig getLocalizedDate:txtBlck->GetTextForDateParsing() language:txtBlck->GetLanguage()];
+}
+
++ (std::string) getLocalizedDate:(DateTimePreparser const &)preparser language:(std::string const &)language
 {
     std::string dateParsedString;
-    std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparsedTokens =  DateTimePreparser(txtBlck->GetText()).GetTextTokens();
+    std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparsedTokens = preparser.GetTextTokens();
     for(auto section : DateTimePreparsedTokens){
         if(section->GetFormat() != DateTimePreparsedTokenFormat::RegularString) {
             NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
@@ -310,7 +315,7 @@ using namespace AdaptiveCards;
                 outputFormatter.dateStyle = NSDateFormatterLongStyle;
             }
 
-            NSString *languageType= [NSString stringWithCString:txtBlck->GetLanguage().c_str() encoding:NSUTF8StringEncoding];
+            NSString *languageType= [NSString stringWithCString:language.c_str() encoding:NSUTF8StringEncoding];
             if(languageType.length > 0){
                 outputFormatter.locale = [[NSLocale alloc] initWithLocaleIdentifier:languageType];
             }
@@ -31,5 +31,7 @@ using namespace AdaptiveCards;
 // find date and time string, and replace them in NSDateFormatterCompactStyle, NSDateFormatterMediumStyle or
 // NSDateFormatterLongStyle of local language
 + (std::string) getLocalizedDate:(std::shared_ptr<TextBlock> const &)txtBlck;
+// as above, for text already preparsed, in the given language
++ (std::string) getLocalizedDate:(DateTimePreparser const &)preparser language:(std::string const &)language;
 
 @end    
@@ -17,6 +17,7 @@ typedef NS_ENUM(NSUInteger, ACRParseWarningStatusCode)
     ACRMaxActionsExceeded,
     ACRAssetLoadFailed,
     ACRUnsupportedSchemaVersion,
+    ACRDuplicateId,
 };
 
 @interface ACRParseWarning:NSObject
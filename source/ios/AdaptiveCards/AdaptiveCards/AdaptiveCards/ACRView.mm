@@ -18,7 +18,7 @@
 #import "ACRImageRenderer.h"
 #import "TextBlock.h"
 #import "ACRTextBlockRenderer.h"
-#import "MarkDownParser.h"
+#import "TextProcessingCache.h"
 #import "ImageSet.h"
 #import "ACRUILabel.h"
 
@@ -143,6 +143,24 @@ using namespace AdaptiveCards;
     }
 }
 
+// Hash of what the dates of text are formatted with besides their language: the time zone they are
+// converted to, and the current locale when there is no language. Text without dates comes out the
+// same either way, and hashes to 0.
++ (unsigned long long)getDateFormattingOptionsHash:(std::string const &)text language:(std::string const &)language
+{
+    if(text.find("{{") == std::string::npos)
+    {
+        return 0;
+    }
+
+    NSString *options = [[NSTimeZone defaultTimeZone] name];
+    if(language.empty())
+    {
+        options = [options stringByAppendingFormat:@"|%@", [[NSLocale currentLocale] localeIdentifier]];
+    }
+    return [options hash];
+}
+
 // Walk through adaptive cards elements recursively and if images/images set/TextBlocks are found process them concurrently
 - (void)addTasksToConcurrentQueue:(std::vector<std::shared_ptr<BaseCardElement>> const &)body
 {
@@ -160,10 +178,15 @@ using namespace AdaptiveCards;
                 std::shared_ptr<TextBlock> txtElem = std::dynamic_pointer_cast<TextBlock>(elem);
                 dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),
                     ^{
-                        std::string dateParsedString = [ACOHostConfig getLocalizedDate:txtElem];
-                        // MarkDownParser transforms text with MarkDown to a html string
-                        std::shared_ptr<MarkDownParser> markDownParser = std::make_shared<MarkDownParser>(dateParsedString.c_str());
-                        NSString *parsedString = [NSString stringWithCString:markDownParser->TransformToHtml().c_str() encoding:NSUTF8StringEncoding];
+                        // transforms text with dates and MarkDown to a html string, which is cached as
+                        // the same text is rendered again on each re-render
+                        const std::string language = txtElem->GetLanguage();
+                        const std::string text = txtElem->GetText();
+                        std::shared_ptr<const std::string> html = TextProcessingCache::GetDefault()->TransformToHtml(text, language, [ACRView getDateFormattingOptionsHash:text language:language],
+                            [&language](const DateTimePreparser &preparser) {
+                                return [ACOHostConfig getLocalizedDate:preparser language:language];
+                            });
+                        NSString *parsedString = [NSString stringWithCString:html->c_str() encoding:NSUTF8StringEncoding];
                         // if correctly initialized, fonFamilyNames array is bigger than zero
                         NSMutableString *fontFamilyName = [[NSMutableString alloc] initWithString:@"'"];
                         for(NSUInteger index = 0; index < [_hostConfig.fontFamilyNames count] - 1; ++index){
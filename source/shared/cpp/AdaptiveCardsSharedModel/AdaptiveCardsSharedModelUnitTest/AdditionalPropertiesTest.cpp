@@ -13,6 +13,31 @@ using namespace std;
 
 namespace AdaptiveCardsSharedModelUnitTest
 {
+    class KnownPropertiesCustomElement : public BaseCardElement
+    {
+    public:
+        KnownPropertiesCustomElement() : BaseCardElement(CardElementType::Custom) {}
+
+    protected:
+        const KnownPropertySet& GetKnownProperties() const override
+        {
+            static const KnownPropertySet knownProperties(BaseCardElement::GetKnownProperties(), { "payload" });
+            return knownProperties;
+        }
+    };
+
+    class KnownPropertiesCustomParser : public BaseCardElementParser
+    {
+    public:
+        std::shared_ptr<BaseCardElement> Deserialize(
+            std::shared_ptr<ElementParserRegistration>,
+            std::shared_ptr<ActionParserRegistration>,
+            const Json::Value& value) override
+        {
+            return BaseCardElement::Deserialize<KnownPropertiesCustomElement>(value);
+        }
+    };
+
     TEST_CLASS(AdditionalPropertyTest)
     {
     public:
@@ -42,5 +67,32 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::string expected = "{\"unknown\":\"testing unknown\"}\n";
             Assert::AreEqual(expected, jsonString);
         }
+
+        TEST_METHOD(CustomElementKnownPropertiesTest)
+        {
+            std::string testJsonString =
+            "{\
+                \"type\": \"AdaptiveCard\",\
+                \"version\": \"1.0\",\
+                \"body\": [\
+                    {\
+                        \"type\": \"CustomType\",\
+                        \"spacing\": \"large\",\
+                        \"payload\": \"known to the custom element\",\
+                        \"unknown\": \"testing unknown\"\
+                    }\
+                ]\
+            }";
+            auto elementParserRegistration = std::make_shared<ElementParserRegistration>();
+            elementParserRegistration->AddParser("CustomType", std::make_shared<KnownPropertiesCustomParser>());
+
+            std::shared_ptr<ParseResult> parseResult = AdaptiveCard::DeserializeFromString(testJsonString, 1.0, elementParserRegistration);
+            std::shared_ptr<BaseCardElement> elem = parseResult->GetAdaptiveCard()->GetBody().front();
+            Json::FastWriter fastWriter;
+            std::string jsonString = fastWriter.write(elem->GetAdditionalProperties());
+
+            std::string expected = "{\"unknown\":\"testing unknown\"}\n";
+            Assert::AreEqual(expected, jsonString);
+        }
     };
 }
@@ -0,0 +1,193 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "BinaryCardFormat.h"
+#include "TextBlock.h"
+#include "SampleFiles.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    class BinaryFormatCustomElement : public BaseCardElement
+    {
+    public:
+        BinaryFormatCustomElement() : BaseCardElement(CardElementType::Custom) {}
+
+        Json::Value SerializeToJsonValue() override
+        {
+            Json::Value root = BaseCardElement::SerializeToJsonValue();
+            root["type"] = "CustomType";
+            root["payload"] = m_payload;
+            return root;
+        }
+
+        Json::Value m_payload;
+    };
+
+    class BinaryFormatCustomParser : public BaseCardElementParser
+    {
+    public:
+        std::shared_ptr<BaseCardElement> Deserialize(
+            std::shared_ptr<ElementParserRegistration>,
+            std::shared_ptr<ActionParserRegistration>,
+            const Json::Value& value) override
+        {
+            auto element = BaseCardElement::Deserialize<BinaryFormatCustomElement>(value);
+            element->m_payload = value.get("payload", Json::Value());
+            return element;
+        }
+    };
+
+    TEST_CLASS(BinaryCardFormatTest)
+    {
+    public:
+        TEST_METHOD(RoundTripTest)
+        {
+            std::string testJsonString =
+            "{\
+                \"type\": \"AdaptiveCard\",\
+                \"version\": \"1.0\",\
+                \"style\": \"emphasis\",\
+                \"speak\": \"Speak\",\
+                \"backgroundImage\": \"background.png\",\
+                \"fallbackText\": \"fallback\",\
+                \"lang\": \"fr\",\
+                \"selectAction\": { \"type\": \"Action.OpenUrl\", \"title\": \"Select\", \"url\": \"http://adaptivecards.io\" },\
+                \"body\": [\
+                    { \"type\": \"TextBlock\", \"text\": \"Text \\u0000 \\u00e9\", \"size\": \"large\", \"maxLines\": 2, \"wrap\": true, \"spacing\": \"padding\", \"separator\": true },\
+                    { \"type\": \"Image\", \"url\": \"image.png\", \"size\": \"small\", \"width\": \"20px\", \"selectAction\": { \"type\": \"Action.Submit\", \"title\": \"Go\", \"data\": { \"x\": 1 } } },\
+                    { \"type\": \"ImageSet\", \"imageSize\": \"medium\", \"images\": [ { \"type\": \"Image\", \"url\": \"a.png\" }, { \"type\": \"Image\", \"url\": \"b.png\" } ] },\
+                    { \"type\": \"Container\", \"style\": \"emphasis\", \"items\": [ { \"type\": \"TextBlock\", \"text\": \"inner\" } ] },\
+                    { \"type\": \"ColumnSet\", \"columns\": [ { \"type\": \"Column\", \"width\": \"Stretch\", \"items\": [] }, { \"type\": \"Column\", \"width\": \"50px\", \"items\": [ { \"type\": \"Image\", \"url\": \"c.png\" } ] } ] },\
+                    { \"type\": \"FactSet\", \"facts\": [ { \"title\": \"t\", \"value\": \"v\" } ] },\
+                    { \"type\": \"Input.Text\", \"id\": \"text\", \"placeholder\": \"p\", \"isMultiline\": true, \"maxLength\": 10, \"style\": \"email\" },\
+                    { \"type\": \"Input.Number\", \"id\": \"number\", \"min\": -5, \"max\": 5, \"value\": -1 },\
+                    { \"type\": \"Input.Date\", \"id\": \"date\", \"min\": \"2017-01-01\", \"value\": \"2017-06-01\" },\
+                    { \"type\": \"Input.Time\", \"id\": \"time\", \"max\": \"17:00\" },\
+                    { \"type\": \"Input.Toggle\", \"id\": \"toggle\", \"title\": \"t\", \"valueOn\": \"yes\", \"valueOff\": \"no\", \"isRequired\": true },\
+                    { \"type\": \"Input.ChoiceSet\", \"id\": \"choice\", \"style\": \"expanded\", \"isMultiSelect\": true, \"choices\": [ { \"title\": \"a\", \"value\": \"1\" } ] },\
+                    { \"type\": \"Random\", \"id\": \"kept\" }\
+                ],\
+                \"actions\": [\
+                    { \"type\": \"Action.OpenUrl\", \"title\": \"Open\", \"url\": \"http://adaptivecards.io\", \"iconUrl\": \"icon.png\" },\
+                    { \"type\": \"Action.Submit\", \"title\": \"Submit\", \"data\": { \"z\": [ 1 ], \"a\": \"b\" } },\
+                    { \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": { \"type\": \"AdaptiveCard\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"Inner\" } ] } }\
+                ]\
+            }";
+
+            auto parseResult = AdaptiveCard::DeserializeFromString(testJsonString, 1.0);
+            auto roundTrip = BinaryCardReader::Read(BinaryCardWriter::Write(parseResult));
+
+            auto card = parseResult->GetAdaptiveCard();
+            auto roundTripCard = roundTrip->GetAdaptiveCard();
+            Assert::AreEqual(card->Serialize(), roundTripCard->Serialize());
+            Assert::AreEqual(card->GetLanguage(), roundTripCard->GetLanguage());
+            Assert::AreEqual(card->GetBody().size(), roundTripCard->GetBody().size());
+            Assert::AreEqual(std::string("fr"), std::static_pointer_cast<TextBlock>(roundTripCard->GetBody()[0])->GetLanguage());
+            Assert::IsTrue(roundTripCard->GetBody()[12]->GetElementType() == CardElementType::Unknown);
+
+            Assert::AreEqual(parseResult->GetWarnings().size(), roundTrip->GetWarnings().size());
+            for (size_t i = 0; i < parseResult->GetWarnings().size(); ++i)
+            {
+                Assert::IsTrue(parseResult->GetWarnings()[i]->GetStatusCode() == roundTrip->GetWarnings()[i]->GetStatusCode());
+                Assert::AreEqual(parseResult->GetWarnings()[i]->GetReason(), roundTrip->GetWarnings()[i]->GetReason());
+            }
+        }
+
+        TEST_METHOD(SamplesRoundTripTest)
+        {
+            std::vector<std::string> sampleFilePaths = GetSampleFilePaths();
+            Assert::IsFalse(sampleFilePaths.empty());
+
+            for (const auto& path : sampleFilePaths)
+            {
+                const std::wstring message(path.begin(), path.end());
+
+                std::shared_ptr<ParseResult> parseResult;
+                try
+                {
+                    parseResult = AdaptiveCard::DeserializeFromString(ReadSampleFile(path), 1.0);
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                    // host configs and the samples of invalid cards have nothing to round trip
+                    continue;
+                }
+
+                auto roundTrip = BinaryCardReader::Read(BinaryCardWriter::Write(parseResult));
+                Assert::AreEqual(parseResult->GetAdaptiveCard()->Serialize(), roundTrip->GetAdaptiveCard()->Serialize(), message.c_str());
+
+                Assert::AreEqual(parseResult->GetWarnings().size(), roundTrip->GetWarnings().size(), message.c_str());
+                for (size_t i = 0; i < parseResult->GetWarnings().size(); ++i)
+                {
+                    Assert::IsTrue(parseResult->GetWarnings()[i]->GetStatusCode() == roundTrip->GetWarnings()[i]->GetStatusCode(), message.c_str());
+                    Assert::AreEqual(parseResult->GetWarnings()[i]->GetReason(), roundTrip->GetWarnings()[i]->GetReason(), message.c_str());
+                }
+            }
+        }
+
+        TEST_METHOD(AdditionalPropertiesTest)
+        {
+            std::string testJsonString =
+            "{\
+                \"type\": \"AdaptiveCard\",\
+                \"version\": \"1.0\",\
+                \"body\": [ { \"type\": \"TextBlock\", \"text\": \"a\", \"extra\": { \"list\": [ 1, -2, 2.5, 18446744073709551615, \"s\", true, false, null ], \"empty\": {} } } ],\
+                \"actions\": [ { \"type\": \"Action.Submit\", \"title\": \"Submit\", \"extra\": \"value\" } ]\
+            }";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, 1.0)->GetAdaptiveCard();
+            auto roundTripCard = BinaryCardReader::Read(BinaryCardWriter::Write(card))->GetAdaptiveCard();
+
+            Assert::IsTrue(card->GetBody()[0]->GetAdditionalProperties() == roundTripCard->GetBody()[0]->GetAdditionalProperties());
+            Assert::IsTrue(card->GetActions()[0]->GetAdditionalProperties() == roundTripCard->GetActions()[0]->GetAdditionalProperties());
+            Assert::AreEqual(std::string("value"), roundTripCard->GetActions()[0]->GetAdditionalProperties()["extra"].asString());
+        }
+
+        TEST_METHOD(CustomElementTest)
+        {
+            auto elementParserRegistration = std::make_shared<ElementParserRegistration>();
+            elementParserRegistration->AddParser("CustomType", std::make_shared<BinaryFormatCustomParser>());
+
+            std::string testJsonString =
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"CustomType\", \"id\": \"custom\", \"payload\": { \"a\": [1, 2] } } ] }";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, 1.0, elementParserRegistration)->GetAdaptiveCard();
+            std::string data = BinaryCardWriter::Write(card);
+
+            auto roundTripCard = BinaryCardReader::Read(data, elementParserRegistration)->GetAdaptiveCard();
+            auto element = std::dynamic_pointer_cast<BinaryFormatCustomElement>(roundTripCard->GetBody()[0]);
+            Assert::IsTrue(element != nullptr);
+            Assert::AreEqual(std::string("custom"), element->GetId());
+            Assert::AreEqual(2u, element->m_payload["a"].size());
+
+            // Without the custom parser the element is read back as unknown
+            auto defaultCard = BinaryCardReader::Read(data)->GetAdaptiveCard();
+            Assert::IsTrue(defaultCard->GetBody()[0]->GetElementType() == CardElementType::Unknown);
+        }
+
+        TEST_METHOD(InvalidDataTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"a\" } ] }",
+                1.0)->GetAdaptiveCard();
+            std::string data = BinaryCardWriter::Write(card);
+
+            for (size_t length = 0; length < data.size(); ++length)
+            {
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { BinaryCardReader::Read(data.substr(0, length)); });
+            }
+
+            std::string wrongMagic = data;
+            wrongMagic[0] = 'X';
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { BinaryCardReader::Read(wrongMagic); });
+
+            std::string wrongVersion = data;
+            wrongVersion[4] = 2;
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { BinaryCardReader::Read(wrongVersion); });
+        }
+    };
+}
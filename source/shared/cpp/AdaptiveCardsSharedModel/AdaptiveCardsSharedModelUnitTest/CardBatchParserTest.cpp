@@ -0,0 +1,87 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "CardBatchParser.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static std::string MakeBatchTestCard(unsigned int index)
+    {
+        // Every seventh card is much larger so that shares of the batch differ in cost
+        std::string body;
+        const unsigned int elementCount = (index % 7 == 0) ? 200 : 1;
+        for (unsigned int i = 0; i < elementCount; ++i)
+        {
+            body += (i == 0 ? "" : ",");
+            body += "{ \"type\": \"TextBlock\", \"text\": \"card " + std::to_string(index) + "\" }";
+        }
+        return "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ " + body + " ] }";
+    }
+
+    TEST_CLASS(CardBatchParserTest)
+    {
+    public:
+        TEST_METHOD(ResultsInInputOrderTest)
+        {
+            std::vector<std::string> cards;
+            for (unsigned int i = 0; i < 100; ++i)
+            {
+                cards.push_back(MakeBatchTestCard(i));
+            }
+
+            for (unsigned int workerCount : { 1u, 3u, 8u, 200u })
+            {
+                CardBatchParser batchParser(workerCount, 1.0);
+                auto results = batchParser.Parse(cards);
+
+                Assert::AreEqual(cards.size(), results.size());
+                for (size_t i = 0; i < cards.size(); ++i)
+                {
+                    Assert::IsTrue(results[i].Succeeded());
+                    Assert::AreEqual(
+                        AdaptiveCard::DeserializeFromString(cards[i], 1.0)->GetAdaptiveCard()->Serialize(),
+                        results[i].GetParseResult()->GetAdaptiveCard()->Serialize());
+                }
+            }
+        }
+
+        TEST_METHOD(PerItemExceptionsTest)
+        {
+            std::vector<std::string> cards = {
+                MakeBatchTestCard(1),
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ ",
+                MakeBatchTestCard(2),
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"abc\" }"
+            };
+
+            CardBatchParser batchParser(2, 1.0);
+            auto results = batchParser.Parse(cards);
+
+            Assert::IsTrue(results[0].Succeeded());
+            Assert::IsFalse(results[1].Succeeded());
+            Assert::IsTrue(results[2].Succeeded());
+            Assert::IsFalse(results[3].Succeeded());
+
+            try
+            {
+                results[3].GetParseResult();
+                Assert::Fail();
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::IsTrue(e.GetStatusCode() == ErrorStatusCode::InvalidPropertyValue);
+            }
+        }
+
+        TEST_METHOD(WorkerCountTest)
+        {
+            Assert::IsTrue(CardBatchParser(0, 1.0).GetWorkerCount() >= 1);
+            Assert::AreEqual(4u, CardBatchParser(4, 1.0).GetWorkerCount());
+            Assert::IsTrue(CardBatchParser(4, 1.0).Parse(std::vector<std::string>()).empty());
+        }
+    };
+}
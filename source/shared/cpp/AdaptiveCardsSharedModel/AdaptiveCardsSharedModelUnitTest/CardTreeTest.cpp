@@ -0,0 +1,180 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "CardTree.h"
+#include "ColumnSet.h"
+#include "Fact.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static const std::string TreeCardJson =
+        "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": ["
+        "  { \"type\": \"Container\", \"id\": \"container\", \"items\": ["
+        "    { \"type\": \"TextBlock\", \"id\": \"text\", \"text\": \"Text\" },"
+        "    { \"type\": \"FactSet\", \"id\": \"facts\", \"facts\": [ { \"title\": \"a\", \"value\": \"1\" }, { \"title\": \"b\", \"value\": \"2\" } ] } ],"
+        "    \"selectAction\": { \"type\": \"Action.OpenUrl\", \"id\": \"select\", \"title\": \"Select\", \"url\": \"http://adaptivecards.io\" } },"
+        "  { \"type\": \"ColumnSet\", \"id\": \"columns\", \"columns\": [ { \"type\": \"Column\", \"id\": \"column\", \"items\": ["
+        "    { \"type\": \"ImageSet\", \"id\": \"images\", \"images\": [ { \"type\": \"Image\", \"id\": \"image\", \"url\": \"http://adaptivecards.io/content/image.png\" } ] } ] } ] } ],"
+        "  \"actions\": [ { \"type\": \"Action.ShowCard\", \"id\": \"show\", \"title\": \"Show\", \"card\": {"
+        "    \"type\": \"AdaptiveCard\", \"body\": [ { \"type\": \"TextBlock\", \"id\": \"inner\", \"text\": \"Inner\" } ] } },"
+        "    { \"type\": \"Action.Submit\", \"id\": \"submit\", \"title\": \"Submit\" } ] }";
+
+    // Names nodes by their id, "card" for cards and the title for facts
+    static std::string GetName(const CardNode& node)
+    {
+        switch (node.GetType())
+        {
+        case CardNodeType::Card:
+            return "card";
+        case CardNodeType::Element:
+            return node.GetElement()->GetId();
+        case CardNodeType::Action:
+            return node.GetAction()->GetId();
+        default:
+            return node.GetFact()->GetTitle();
+        }
+    }
+
+    template <typename Nodes>
+    static std::string JoinNames(const Nodes& nodes)
+    {
+        std::string names;
+        for (const auto& node : nodes)
+        {
+            names += (names.empty() ? "" : " ") + GetName(node);
+        }
+        return names;
+    }
+
+    class NamingVisitor : public CardVisitor
+    {
+    public:
+        bool Visit(AdaptiveCard&) override
+        {
+            Append("card");
+            return true;
+        }
+
+        bool Visit(BaseCardElement& element) override
+        {
+            Append(element.GetId());
+            return element.GetId() != "columns";
+        }
+
+        bool Visit(BaseActionElement& action) override
+        {
+            Append(action.GetId());
+            return true;
+        }
+
+        void Visit(Fact& fact) override
+        {
+            Append(fact.GetTitle());
+        }
+
+        void EndVisit(AdaptiveCard&) override
+        {
+            Append("/card");
+        }
+
+        void EndVisit(BaseCardElement& element) override
+        {
+            Append("/" + element.GetId());
+        }
+
+        void Append(const std::string& name)
+        {
+            names += (names.empty() ? "" : " ") + name;
+        }
+
+        std::string names;
+    };
+
+    TEST_CLASS(CardTreeTest)
+    {
+    public:
+        TEST_METHOD(PreOrderTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(TreeCardJson, 1.0)->GetAdaptiveCard();
+            CardTree tree(*card);
+            Assert::AreEqual(std::string("card container text facts a b select columns column images image show card inner submit"), JoinNames(tree));
+
+            std::string depths;
+            for (auto node = tree.begin(); node != tree.end(); ++node)
+            {
+                depths += std::to_string(node.GetDepth());
+            }
+            Assert::AreEqual(std::string("012233212341231"), depths);
+
+            // Trees can start at any element
+            auto column = std::static_pointer_cast<ColumnSet>(card->GetBody()[1])->GetColumns()[0];
+            Assert::AreEqual(std::string("column images image"), JoinNames(CardTree(*column)));
+        }
+
+        TEST_METHOD(PostOrderTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(TreeCardJson, 1.0)->GetAdaptiveCard();
+            Assert::AreEqual(std::string("text a b facts select container image images column columns inner card show submit card"),
+                JoinNames(CardTree(*card, CardTreeOrder::PostOrder)));
+        }
+
+        TEST_METHOD(OfTypeTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(TreeCardJson, 1.0)->GetAdaptiveCard();
+            CardTree tree(*card);
+            Assert::AreEqual(std::string("text inner"), JoinNames(tree.OfType(CardElementType::TextBlock)));
+            Assert::AreEqual(std::string("select show submit"), JoinNames(tree.OfType(CardNodeType::Action)));
+            Assert::AreEqual(std::string("submit"), JoinNames(tree.OfType(ActionType::Submit)));
+            Assert::AreEqual(std::string("a b"), JoinNames(tree.OfType(CardNodeType::Fact)));
+            Assert::AreEqual(std::string(""), JoinNames(tree.OfType(CardElementType::TextInput)));
+        }
+
+        TEST_METHOD(SkipChildrenTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(TreeCardJson, 1.0)->GetAdaptiveCard();
+            CardTree tree(*card);
+            std::string names;
+            for (auto node = tree.begin(); node != tree.end(); ++node)
+            {
+                names += (names.empty() ? "" : " ") + GetName(*node);
+                if (node->GetType() != CardNodeType::Card && node.GetDepth() == 1)
+                {
+                    node.SkipChildren();
+                }
+            }
+            Assert::AreEqual(std::string("card container columns show submit"), names);
+        }
+
+        TEST_METHOD(VisitorTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(TreeCardJson, 1.0)->GetAdaptiveCard();
+            NamingVisitor visitor;
+            CardTree(*card).Accept(visitor);
+            Assert::AreEqual(std::string("card container text /text facts a b /facts select /container columns /columns show card inner /inner /card submit /card"), visitor.names);
+        }
+
+        TEST_METHOD(DeferredShowCardTest)
+        {
+            auto actionParserRegistration = std::make_shared<ActionParserRegistration>();
+            actionParserRegistration->SetShowCardParsingDeferred(true);
+            auto card = AdaptiveCard::DeserializeFromString(TreeCardJson, 1.0, nullptr, actionParserRegistration)->GetAdaptiveCard();
+            auto showCard = std::static_pointer_cast<ShowCardAction>(card->GetActions()[0]);
+
+            // Neither resource gathering nor language propagation parse the card
+            Assert::AreEqual(static_cast<size_t>(1), card->GetResourceUris().size());
+            card->SetLanguage("fr");
+            Assert::IsTrue(showCard->IsCardDeferred());
+
+            // Walking into it does
+            Assert::AreEqual(std::string("text inner"), JoinNames(CardTree(*card).OfType(CardElementType::TextBlock)));
+            Assert::IsFalse(showCard->IsCardDeferred());
+            Assert::AreEqual(std::string("fr"), std::static_pointer_cast<TextBlock>(showCard->GetCard()->GetBody()[0])->GetLanguage());
+        }
+    };
+}
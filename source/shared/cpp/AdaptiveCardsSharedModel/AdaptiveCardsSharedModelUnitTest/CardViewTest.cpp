@@ -0,0 +1,262 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "CardView.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "FactSet.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "OpenUrlAction.h"
+#include "ShowCardAction.h"
+#include "SubmitAction.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static void VerifyCardViewMatches(const CardView& view, std::shared_ptr<AdaptiveCard> card);
+
+    static void VerifyActionViewMatches(const CardActionView& view, std::shared_ptr<BaseActionElement> action)
+    {
+        Assert::AreEqual(action == nullptr, view.IsNull());
+        if (action == nullptr)
+        {
+            return;
+        }
+
+        Assert::IsTrue(action->GetElementType() == view.GetElementType());
+        Assert::AreEqual(action->GetTitle(), view.GetTitle().ToString());
+        Assert::AreEqual(action->GetId(), view.GetId().ToString());
+        Assert::AreEqual(action->GetIconUrl(), view.GetIconUrl().ToString());
+
+        switch (action->GetElementType())
+        {
+        case ActionType::OpenUrl:
+            Assert::AreEqual(std::static_pointer_cast<OpenUrlAction>(action)->GetUrl(), view.GetUrl().ToString());
+            break;
+        case ActionType::Submit:
+            Assert::AreEqual(std::static_pointer_cast<SubmitAction>(action)->GetDataJson(), view.GetDataJson().ToString());
+            break;
+        case ActionType::ShowCard:
+            VerifyCardViewMatches(view.GetCard(), std::static_pointer_cast<ShowCardAction>(action)->GetCard());
+            break;
+        default:
+            break;
+        }
+    }
+
+    template <typename T>
+    static void VerifyElementListViewMatches(const CardListView<CardElementView>& view, const std::vector<std::shared_ptr<T>>& elements);
+
+    static void VerifyElementViewMatches(const CardElementView& view, std::shared_ptr<BaseCardElement> element)
+    {
+        Assert::IsTrue(element->GetElementType() == view.GetElementType());
+        Assert::AreEqual(element->GetId(), view.GetId().ToString());
+        Assert::IsTrue(element->GetSpacing() == view.GetSpacing());
+        Assert::AreEqual(element->GetSeparator(), view.GetSeparator());
+
+        switch (element->GetElementType())
+        {
+        case CardElementType::TextBlock:
+        {
+            auto textBlock = std::static_pointer_cast<TextBlock>(element);
+            Assert::AreEqual(textBlock->GetText(), view.GetText().ToString());
+            Assert::IsTrue(textBlock->GetTextSize() == view.GetTextSize());
+            Assert::IsTrue(textBlock->GetTextWeight() == view.GetTextWeight());
+            Assert::IsTrue(textBlock->GetTextColor() == view.GetTextColor());
+            Assert::AreEqual(textBlock->GetWrap(), view.GetWrap());
+            Assert::AreEqual(textBlock->GetIsSubtle(), view.GetIsSubtle());
+            Assert::AreEqual(textBlock->GetMaxLines(), view.GetMaxLines());
+            Assert::IsTrue(textBlock->GetHorizontalAlignment() == view.GetHorizontalAlignment());
+            Assert::AreEqual(textBlock->GetLanguage(), view.GetLanguage().ToString());
+            break;
+        }
+        case CardElementType::Image:
+        {
+            auto image = std::static_pointer_cast<Image>(element);
+            Assert::AreEqual(image->GetUrl(), view.GetUrl().ToString());
+            Assert::AreEqual(image->GetAltText(), view.GetAltText().ToString());
+            Assert::IsTrue(image->GetImageStyle() == view.GetImageStyle());
+            Assert::IsTrue(image->GetImageSize() == view.GetImageSize());
+            VerifyActionViewMatches(view.GetSelectAction(), image->GetSelectAction());
+            break;
+        }
+        case CardElementType::ImageSet:
+        {
+            auto imageSet = std::static_pointer_cast<ImageSet>(element);
+            Assert::IsTrue(imageSet->GetImageSize() == view.GetImageSize());
+            VerifyElementListViewMatches(view.GetItems(), imageSet->GetImages());
+            break;
+        }
+        case CardElementType::Container:
+        {
+            auto container = std::static_pointer_cast<Container>(element);
+            Assert::IsTrue(container->GetStyle() == view.GetStyle());
+            VerifyActionViewMatches(view.GetSelectAction(), container->GetSelectAction());
+            VerifyElementListViewMatches(view.GetItems(), container->GetItems());
+            break;
+        }
+        case CardElementType::Column:
+        {
+            auto column = std::static_pointer_cast<Column>(element);
+            Assert::AreEqual(column->GetWidth(), view.GetWidth().ToString());
+            Assert::IsTrue(column->GetStyle() == view.GetStyle());
+            VerifyElementListViewMatches(view.GetItems(), column->GetItems());
+            break;
+        }
+        case CardElementType::ColumnSet:
+        {
+            auto columnSet = std::static_pointer_cast<ColumnSet>(element);
+            VerifyActionViewMatches(view.GetSelectAction(), columnSet->GetSelectAction());
+            VerifyElementListViewMatches(view.GetItems(), columnSet->GetColumns());
+            break;
+        }
+        case CardElementType::FactSet:
+        {
+            auto facts = std::static_pointer_cast<FactSet>(element)->GetFacts();
+            auto factsView = view.GetFacts();
+            Assert::AreEqual(facts.size(), factsView.GetSize());
+            for (size_t i = 0; i < facts.size(); ++i)
+            {
+                Assert::AreEqual(facts[i]->GetTitle(), factsView.Get(i).GetTitle().ToString());
+                Assert::AreEqual(facts[i]->GetValue(), factsView.Get(i).GetValue().ToString());
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    template <typename T>
+    static void VerifyElementListViewMatches(const CardListView<CardElementView>& view, const std::vector<std::shared_ptr<T>>& elements)
+    {
+        Assert::AreEqual(elements.size(), view.GetSize());
+        for (size_t i = 0; i < elements.size(); ++i)
+        {
+            VerifyElementViewMatches(view.Get(i), elements[i]);
+        }
+    }
+
+    static void VerifyCardViewMatches(const CardView& view, std::shared_ptr<AdaptiveCard> card)
+    {
+        Assert::AreEqual(card == nullptr, view.IsNull());
+        if (card == nullptr)
+        {
+            return;
+        }
+
+        Assert::AreEqual(card->GetVersion(), view.GetVersion().ToString());
+        Assert::AreEqual(card->GetFallbackText(), view.GetFallbackText().ToString());
+        Assert::AreEqual(card->GetBackgroundImage(), view.GetBackgroundImage().ToString());
+        Assert::AreEqual(card->GetSpeak(), view.GetSpeak().ToString());
+        Assert::AreEqual(card->GetLanguage(), view.GetLanguage().ToString());
+        Assert::IsTrue(card->GetStyle() == view.GetStyle());
+        VerifyActionViewMatches(view.GetSelectAction(), card->GetSelectAction());
+        VerifyElementListViewMatches(view.GetBody(), card->GetBody());
+
+        auto actions = view.GetActions();
+        Assert::AreEqual(card->GetActions().size(), actions.GetSize());
+        for (size_t i = 0; i < actions.GetSize(); ++i)
+        {
+            VerifyActionViewMatches(actions.Get(i), card->GetActions()[i]);
+        }
+    }
+
+    TEST_CLASS(CardViewTest)
+    {
+    public:
+        TEST_METHOD(ViewMatchesObjectModelTest)
+        {
+            std::string testJsonString =
+            "{\
+                \"type\": \"AdaptiveCard\",\
+                \"version\": \"1.0\",\
+                \"style\": \"emphasis\",\
+                \"speak\": \"Speak\",\
+                \"backgroundImage\": \"background.png\",\
+                \"lang\": \"fr\",\
+                \"selectAction\": { \"type\": \"Action.OpenUrl\", \"title\": \"Select\", \"url\": \"http://adaptivecards.io\" },\
+                \"body\": [\
+                    { \"type\": \"TextBlock\", \"text\": \"Text\", \"size\": \"large\", \"weight\": \"bolder\", \"color\": \"good\", \"maxLines\": 2, \"wrap\": true, \"isSubtle\": true, \"horizontalAlignment\": \"center\", \"spacing\": \"padding\", \"separator\": true },\
+                    { \"type\": \"Image\", \"id\": \"image\", \"url\": \"image.png\", \"altText\": \"alt\", \"style\": \"person\", \"size\": \"small\", \"selectAction\": { \"type\": \"Action.Submit\", \"title\": \"Go\", \"data\": { \"x\": 1 } } },\
+                    { \"type\": \"ImageSet\", \"imageSize\": \"medium\", \"images\": [ { \"type\": \"Image\", \"url\": \"a.png\" }, { \"type\": \"Image\", \"url\": \"b.png\" } ] },\
+                    { \"type\": \"Container\", \"style\": \"emphasis\", \"items\": [ { \"type\": \"TextBlock\", \"text\": \"inner\" } ] },\
+                    { \"type\": \"ColumnSet\", \"columns\": [ { \"type\": \"Column\", \"width\": \"Stretch\", \"items\": [] }, { \"type\": \"Column\", \"width\": \"50px\", \"items\": [ { \"type\": \"Image\", \"url\": \"c.png\" } ] } ] },\
+                    { \"type\": \"FactSet\", \"facts\": [ { \"title\": \"t1\", \"value\": \"v1\" }, { \"title\": \"t2\", \"value\": \"v2\" } ] },\
+                    { \"type\": \"Input.Text\", \"id\": \"text\", \"placeholder\": \"p\" }\
+                ],\
+                \"actions\": [\
+                    { \"type\": \"Action.OpenUrl\", \"title\": \"Open\", \"url\": \"http://adaptivecards.io\", \"iconUrl\": \"icon.png\" },\
+                    { \"type\": \"Action.Submit\", \"title\": \"Submit\", \"data\": { \"z\": [ 1 ] } },\
+                    { \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": { \"type\": \"AdaptiveCard\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"Inner\" } ] } }\
+                ]\
+            }";
+
+            std::string data = BinaryCardWriter::Compile(testJsonString, 1.0);
+            CardView view(data.data(), data.size());
+
+            VerifyCardViewMatches(view, AdaptiveCard::DeserializeFromString(testJsonString, 1.0)->GetAdaptiveCard());
+
+            auto input = view.GetBody().Get(6);
+            Assert::IsTrue(input.GetString(AdaptiveCardSchemaKey::Placeholder) == "p");
+            Assert::IsTrue(input.GetText().IsEmpty());
+        }
+
+        TEST_METHOD(JsonRecordTest)
+        {
+            std::string data = BinaryCardWriter::Compile(
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"Random\", \"id\": \"unknown\" } ] }", 1.0);
+            CardView view(data.data(), data.size());
+
+            auto element = view.GetBody().Get(0);
+            Assert::IsTrue(element.GetElementType() == CardElementType::Unknown);
+            Assert::IsTrue(element.GetId() == "unknown");
+        }
+
+        TEST_METHOD(InvalidDataTest)
+        {
+            std::string data = BinaryCardWriter::Compile(
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"a\" } ] }", 1.0);
+
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { CardView(data.data(), 3); });
+
+            // Truncating the body is only noticed by the accessors that reach past the end
+            CardView truncated(data.data(), data.size() - 4);
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { truncated.GetBody().Get(0).GetText(); });
+        }
+
+        TEST_METHOD(CyclicOffsetTest)
+        {
+            std::string data = BinaryCardWriter::Compile(
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"a\" } ] }", 1.0);
+            const size_t bodyStart = BinaryCardFormat::Data(data.data(), data.size()).GetBody() - data.data();
+
+            // The body's only offset is the one that points just past itself, at the TextBlock
+            size_t offsetPosition = bodyStart;
+            while (offsetPosition + 4 <= data.size() &&
+                   !(static_cast<unsigned char>(data[offsetPosition]) == ((offsetPosition + 4 - bodyStart) & 0xff) &&
+                     data.compare(offsetPosition + 1, 3, std::string(3, '\0')) == 0))
+            {
+                ++offsetPosition;
+            }
+            Assert::IsTrue(offsetPosition + 4 <= data.size());
+            Assert::IsTrue(CardView(data.data(), data.size()).GetBody().Get(0).GetText() == "a");
+
+            // Point the body's child back at the card, then at the offset itself
+            for (size_t target : { static_cast<size_t>(0), offsetPosition - bodyStart })
+            {
+                std::string cyclic = data;
+                cyclic[offsetPosition] = static_cast<char>(target);
+                CardView view(cyclic.data(), cyclic.size());
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { view.GetBody().Get(0); });
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { BinaryCardReader::Read(cyclic); });
+            }
+        }
+    };
+}
@@ -0,0 +1,128 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "CardWriter.h"
+#include "Container.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // A host subclass of a built-in element that changes only what SerializeToJsonValue returns
+    class CardWriterHighlightedTextBlock : public TextBlock
+    {
+    public:
+        Json::Value SerializeToJsonValue() override
+        {
+            Json::Value root = TextBlock::SerializeToJsonValue();
+            root["highlight"] = true;
+            return root;
+        }
+    };
+
+    TEST_CLASS(CardWriterTest)
+    {
+    public:
+        TEST_METHOD(AllElementsMatchFastWriterTest)
+        {
+            std::string testJsonString =
+            "{\
+                \"type\": \"AdaptiveCard\",\
+                \"version\": \"1.0\",\
+                \"style\": \"emphasis\",\
+                \"speak\": \"Speak \\\"this\\\"\\n\",\
+                \"body\": [\
+                    { \"type\": \"TextBlock\", \"text\": \"Tab\\tand \\u0001 and \\u00e9\", \"size\": \"large\", \"maxLines\": 2, \"wrap\": true },\
+                    { \"type\": \"Image\", \"url\": \"image.png\", \"size\": \"small\", \"selectAction\": { \"type\": \"Action.OpenUrl\", \"title\": \"Open\", \"url\": \"http://adaptivecards.io\" } },\
+                    { \"type\": \"ImageSet\", \"imageSize\": \"medium\", \"images\": [ { \"type\": \"Image\", \"url\": \"a.png\" }, { \"type\": \"Image\", \"url\": \"b.png\" } ] },\
+                    { \"type\": \"Container\", \"style\": \"emphasis\", \"items\": [ { \"type\": \"TextBlock\", \"text\": \"inner\" } ], \"selectAction\": { \"type\": \"Action.Submit\", \"title\": \"Go\", \"data\": { \"x\": 1 } } },\
+                    { \"type\": \"ColumnSet\", \"columns\": [ { \"type\": \"Column\", \"width\": \"stretch\", \"style\": \"default\", \"items\": [] }, { \"type\": \"Column\", \"width\": \"50px\", \"items\": [ { \"type\": \"Image\", \"url\": \"c.png\" } ] } ] },\
+                    { \"type\": \"FactSet\", \"facts\": [ { \"title\": \"t\", \"value\": \"v\" } ] },\
+                    { \"type\": \"Input.Text\", \"id\": \"text\", \"placeholder\": \"p\", \"isMultiline\": true, \"maxLength\": 10, \"style\": \"email\" },\
+                    { \"type\": \"Input.Number\", \"id\": \"number\", \"min\": -5, \"max\": 5, \"value\": 1 },\
+                    { \"type\": \"Input.Date\", \"id\": \"date\", \"min\": \"2017-01-01\", \"value\": \"2017-06-01\" },\
+                    { \"type\": \"Input.Time\", \"id\": \"time\", \"max\": \"17:00\" },\
+                    { \"type\": \"Input.Toggle\", \"id\": \"toggle\", \"title\": \"t\", \"valueOn\": \"yes\", \"valueOff\": \"no\", \"isRequired\": true },\
+                    { \"type\": \"Input.ChoiceSet\", \"id\": \"choice\", \"style\": \"expanded\", \"isMultiSelect\": true, \"choices\": [ { \"title\": \"a\", \"value\": \"1\" } ] },\
+                    { \"type\": \"Custom\", \"id\": \"kept\", \"zeta\": [ 1, 2.5, null ], \"alpha\": { \"b\": true, \"a\": \"x\" } }\
+                ],\
+                \"actions\": [\
+                    { \"type\": \"Action.OpenUrl\", \"title\": \"Open\", \"url\": \"http://adaptivecards.io\", \"iconUrl\": \"icon.png\" },\
+                    { \"type\": \"Action.Submit\", \"title\": \"Submit\", \"data\": { \"z\": [ 1 ], \"a\": \"b\" } },\
+                    { \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": { \"type\": \"AdaptiveCard\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"Inner\" } ] } }\
+                ]\
+            }";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, 1.0)->GetAdaptiveCard();
+
+            Json::FastWriter fastWriter;
+            Assert::AreEqual(fastWriter.write(card->SerializeToJsonValue()), card->Serialize());
+            for (const auto& element : card->GetBody())
+            {
+                Assert::AreEqual(fastWriter.write(element->SerializeToJsonValue()), element->Serialize());
+            }
+            for (const auto& action : card->GetActions())
+            {
+                Assert::AreEqual(fastWriter.write(action->SerializeToJsonValue()), action->Serialize());
+            }
+        }
+
+        TEST_METHOD(SubclassedElementTest)
+        {
+            auto textBlock = std::make_shared<CardWriterHighlightedTextBlock>();
+            textBlock->SetText("Highlighted");
+
+            auto container = std::make_shared<Container>();
+            container->GetItems().push_back(textBlock);
+
+            // the subclass's SerializeToJsonValue is written, on its own and nested
+            Json::FastWriter fastWriter;
+            Assert::AreEqual(fastWriter.write(textBlock->SerializeToJsonValue()), textBlock->Serialize());
+            Assert::AreEqual(fastWriter.write(container->SerializeToJsonValue()), container->Serialize());
+            Assert::IsTrue(container->Serialize().find("\"highlight\":true") != std::string::npos);
+        }
+
+        TEST_METHOD(MembersSortedAndLastValueWinsTest)
+        {
+            CardWriter writer;
+            writer.BeginObject();
+            writer.WriteKey("b");
+            writer.WriteValue(1);
+            writer.WriteKey("a");
+            writer.BeginArray();
+            writer.WriteValue(true);
+            writer.BeginObject();
+            writer.WriteKey("y");
+            writer.WriteValue("first");
+            writer.WriteKey("x");
+            writer.WriteValue(2u);
+            writer.WriteKey("y");
+            writer.WriteValue("second");
+            writer.EndObject();
+            writer.BeginObject();
+            writer.EndObject();
+            writer.EndArray();
+            writer.WriteKey("c");
+            writer.WriteValue(Json::Value(Json::nullValue));
+            writer.EndObject();
+
+            Assert::AreEqual(std::string("{\"a\":[true,{\"x\":2,\"y\":\"second\"},{}],\"b\":1,\"c\":null}\n"), writer.GetString());
+        }
+
+        TEST_METHOD(StringEscapingTest)
+        {
+            std::string value = "quote\" backslash\\ controls\b\f\n\r\t\x01\x1f del\x7f utf8\xc3\xa9 nul";
+            value += '\0';
+            value += "end";
+            Json::FastWriter fastWriter;
+            std::string expected = fastWriter.write(Json::Value(value));
+
+            CardWriter writer;
+            writer.WriteValue(value);
+            Assert::AreEqual(expected, writer.GetString());
+        }
+    };
+}
@@ -0,0 +1,169 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "Container.h"
+#include "ColumnSet.h"
+#include "Column.h"
+#include "TextBlock.h"
+#include "Image.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static const unsigned int DeepNestingLevels = 100000;
+
+    // JSON for a card whose body nests containers and column sets DeepNestingLevels deep around a
+    // text block and an image. Json::Reader and Json::Value's destructor both recurse, so the
+    // value is built in place and torn down from the innermost element out.
+    class DeepCardJson
+    {
+    public:
+        DeepCardJson()
+        {
+            m_root["type"] = "AdaptiveCard";
+            m_root["version"] = "1.0";
+
+            Json::Value* items = &m_root["body"];
+            for (unsigned int i = 0; i < DeepNestingLevels; ++i)
+            {
+                Json::Value& element = items->append(Json::Value(Json::objectValue));
+                m_elements.push_back(&element);
+                if (i % 2 == 0)
+                {
+                    element["type"] = "Container";
+                    items = &element["items"];
+                }
+                else
+                {
+                    element["type"] = "ColumnSet";
+                    Json::Value& column = element["columns"].append(Json::Value(Json::objectValue));
+                    m_elements.push_back(&column);
+                    column["type"] = "Column";
+                    items = &column["items"];
+                }
+            }
+
+            Json::Value textBlock(Json::objectValue);
+            textBlock["type"] = "TextBlock";
+            textBlock["text"] = "leaf";
+            items->append(textBlock);
+
+            Json::Value image(Json::objectValue);
+            image["type"] = "Image";
+            image["url"] = "http://adaptivecards.io/content/leaf.png";
+            items->append(image);
+        }
+
+        ~DeepCardJson()
+        {
+            for (auto it = m_elements.rbegin(); it != m_elements.rend(); ++it)
+            {
+                (*it)->clear();
+            }
+        }
+
+        const Json::Value& Get() const
+        {
+            return m_root;
+        }
+
+    private:
+        Json::Value m_root;
+        std::vector<Json::Value*> m_elements;
+    };
+
+    // Follows the first item of every level down to the innermost elements, counting the levels
+    static const std::vector<std::shared_ptr<BaseCardElement>>& FindInnermostItems(const std::shared_ptr<AdaptiveCard>& card, unsigned int& levels)
+    {
+        levels = 0;
+        const std::vector<std::shared_ptr<BaseCardElement>>* items = &card->GetBody();
+        while (true)
+        {
+            Assert::IsFalse(items->empty());
+            if (auto container = std::dynamic_pointer_cast<Container>(items->front()))
+            {
+                items = &container->GetItems();
+            }
+            else if (auto columnSet = std::dynamic_pointer_cast<ColumnSet>(items->front()))
+            {
+                Assert::AreEqual(static_cast<size_t>(1), columnSet->GetColumns().size());
+                items = &columnSet->GetColumns().front()->GetItems();
+            }
+            else
+            {
+                return *items;
+            }
+            ++levels;
+        }
+    }
+
+    static size_t CountOccurrences(const std::string& text, const std::string& pattern)
+    {
+        size_t count = 0;
+        for (size_t position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + pattern.size()))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    TEST_CLASS(DeepNestingTest)
+    {
+    public:
+        TEST_METHOD(DeepParseTest)
+        {
+            std::shared_ptr<AdaptiveCard> card;
+            {
+                DeepCardJson json;
+                auto result = AdaptiveCard::TryDeserialize(json.Get(), 1.0);
+                Assert::IsTrue(result->GetError() == nullptr);
+                // Column set levels count their column as well, and the innermost elements add one
+                Assert::AreEqual(DeepNestingLevels / 2 * 3 + 1, result->GetStatistics().maxDepth);
+                card = result->GetAdaptiveCard();
+            }
+
+            unsigned int levels;
+            const auto& innermostItems = FindInnermostItems(card, levels);
+            Assert::AreEqual(DeepNestingLevels, levels);
+            Assert::AreEqual(static_cast<size_t>(2), innermostItems.size());
+            Assert::AreEqual(std::string("leaf"), std::static_pointer_cast<TextBlock>(innermostItems[0])->GetText());
+
+            std::vector<std::string> resourceUris = card->GetResourceUris();
+            Assert::AreEqual(static_cast<size_t>(1), resourceUris.size());
+            Assert::AreEqual(std::string("http://adaptivecards.io/content/leaf.png"), resourceUris[0]);
+
+            card->SetLanguage("fr");
+            Assert::AreEqual(std::string("fr"), std::static_pointer_cast<TextBlock>(innermostItems[0])->GetLanguage());
+
+            std::string serializedCard = card->Serialize();
+            Assert::AreEqual(static_cast<size_t>(DeepNestingLevels / 2), CountOccurrences(serializedCard, "\"type\":\"Container\""));
+            Assert::AreEqual(static_cast<size_t>(DeepNestingLevels / 2), CountOccurrences(serializedCard, "\"type\":\"Column\""));
+            Assert::AreEqual(static_cast<size_t>(1), CountOccurrences(serializedCard, "\"text\":\"leaf\""));
+        }
+
+        TEST_METHOD(DeepConstructionTest)
+        {
+            auto card = std::make_shared<AdaptiveCard>();
+            std::vector<std::shared_ptr<BaseCardElement>>* items = &card->GetBody();
+            for (unsigned int i = 0; i < DeepNestingLevels; ++i)
+            {
+                auto container = std::make_shared<Container>();
+                items->push_back(container);
+                items = &container->GetItems();
+            }
+
+            auto image = std::make_shared<Image>();
+            image->SetUrl("http://adaptivecards.io/content/leaf.png");
+            items->push_back(image);
+
+            Assert::AreEqual(static_cast<size_t>(1), card->GetResourceUris().size());
+            Assert::AreEqual(static_cast<size_t>(DeepNestingLevels), CountOccurrences(card->Serialize(), "\"type\":\"Container\""));
+
+            // Destroying the card releases the chain without recursing
+            card.reset();
+        }
+    };
+}
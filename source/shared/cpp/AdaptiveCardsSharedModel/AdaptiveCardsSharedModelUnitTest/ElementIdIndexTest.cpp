@@ -0,0 +1,186 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static const std::string IndexedCardJson =
+        "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": ["
+        "  { \"type\": \"TextBlock\", \"id\": \"title\", \"text\": \"Title\" },"
+        "  { \"type\": \"Container\", \"id\": \"outer\", \"items\": ["
+        "    { \"type\": \"ColumnSet\", \"id\": \"columns\", \"columns\": ["
+        "      { \"type\": \"Column\", \"id\": \"left\", \"items\": ["
+        "        { \"type\": \"Input.Text\", \"id\": \"name\" } ] },"
+        "      { \"type\": \"Column\", \"items\": ["
+        "        { \"type\": \"ImageSet\", \"images\": [ { \"type\": \"Image\", \"id\": \"photo\", \"url\": \"http://adaptivecards.io/content/photo.png\" } ] } ] } ] } ] },"
+        "  { \"type\": \"TextBlock\", \"id\": \"title\", \"text\": \"Duplicate\" } ] }";
+
+    static std::shared_ptr<ElementParserRegistration> MakeIndexingRegistration()
+    {
+        auto elementParserRegistration = std::make_shared<ElementParserRegistration>();
+        elementParserRegistration->SetIdIndexingEnabled(true);
+        return elementParserRegistration;
+    }
+
+    TEST_CLASS(ElementIdIndexTest)
+    {
+    public:
+        TEST_METHOD(IndexBuiltWhileParsingTest)
+        {
+            auto result = AdaptiveCard::DeserializeFromString(IndexedCardJson, 1.0, MakeIndexingRegistration());
+            auto card = result->GetAdaptiveCard();
+            Assert::IsTrue(card->GetElementIndex() != nullptr);
+            Assert::AreEqual(static_cast<size_t>(9), card->GetElementIndex()->GetElementCount());
+
+            auto warnings = result->GetWarnings();
+            Assert::AreEqual(static_cast<size_t>(1), warnings.size());
+            Assert::IsTrue(warnings[0]->GetStatusCode() == WarningStatusCode::DuplicateId);
+
+            // The first of the duplicates is found, as with a walk of the body
+            auto title = std::static_pointer_cast<TextBlock>(card->GetElementById("title"));
+            Assert::AreEqual(std::string("Title"), title->GetText());
+
+            auto path = card->GetElementIndex()->GetParentPath("photo");
+            Assert::AreEqual(static_cast<size_t>(4), path.size());
+            Assert::AreEqual(std::string("outer"), path[0]->GetId());
+            Assert::AreEqual(std::string("columns"), path[1]->GetId());
+            Assert::IsTrue(path[3]->GetElementType() == CardElementType::ImageSet);
+            Assert::IsTrue(card->GetElementIndex()->GetParentPath("title").empty());
+
+            // Without the registration there is no index, and lookups walk the body
+            auto unindexedResult = AdaptiveCard::DeserializeFromString(IndexedCardJson, 1.0);
+            Assert::IsTrue(unindexedResult->GetAdaptiveCard()->GetElementIndex() == nullptr);
+            Assert::IsTrue(unindexedResult->GetWarnings().empty());
+            for (const std::string id : { "title", "outer", "columns", "left", "name", "photo", "missing" })
+            {
+                auto indexed = card->GetElementById(id);
+                auto walked = unindexedResult->GetAdaptiveCard()->GetElementById(id);
+                Assert::AreEqual(indexed == nullptr, walked == nullptr);
+                if (indexed != nullptr)
+                {
+                    Assert::AreEqual(indexed->Serialize(), walked->Serialize());
+                }
+            }
+        }
+
+        TEST_METHOD(MutationHelpersTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(IndexedCardJson, 1.0, MakeIndexingRegistration())->GetAdaptiveCard();
+            auto index = card->GetElementIndex();
+
+            // Inserting indexes the element and everything under it
+            auto container = std::make_shared<Container>();
+            container->SetId("added");
+            auto textBlock = std::make_shared<TextBlock>();
+            textBlock->SetId("addedText");
+            container->GetItems().push_back(textBlock);
+            card->InsertElement(card->GetElementById("left"), 0, container);
+            Assert::IsTrue(card->GetElementById("addedText") == textBlock);
+            Assert::AreEqual(std::string("added"), index->GetParentPath("addedText").back()->GetId());
+            Assert::IsTrue(std::static_pointer_cast<Column>(card->GetElementById("left"))->GetItems()[0] == container);
+
+            // Removing drops the whole subtree, and the duplicate takes over the id
+            auto firstTitle = card->GetElementById("title");
+            Assert::IsTrue(card->RemoveElement(firstTitle));
+            Assert::IsFalse(card->RemoveElement(firstTitle));
+            Assert::AreEqual(std::string("Duplicate"), std::static_pointer_cast<TextBlock>(card->GetElementById("title"))->GetText());
+            Assert::IsTrue(card->RemoveElement(card->GetElementById("outer")));
+            Assert::IsTrue(card->GetElementById("addedText") == nullptr);
+            Assert::IsTrue(card->GetElementById("photo") == nullptr);
+            Assert::AreEqual(static_cast<size_t>(1), card->GetBody().size());
+
+            card->SetElementId(card->GetElementById("title"), "renamed");
+            Assert::IsTrue(card->GetElementById("title") == nullptr);
+            Assert::AreEqual(std::string("renamed"), card->GetBody()[0]->GetId());
+            Assert::IsTrue(card->GetElementById("renamed") == card->GetBody()[0]);
+
+            // Columns only go in ColumnSets
+            auto columnSet = std::make_shared<ColumnSet>();
+            card->InsertElement(nullptr, 10, columnSet);
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { card->InsertElement(columnSet, 0, std::make_shared<TextBlock>()); });
+            card->InsertElement(columnSet, 0, std::make_shared<Column>());
+            Assert::AreEqual(static_cast<size_t>(1), columnSet->GetColumns().size());
+        }
+
+        TEST_METHOD(MutationHelpersWithoutIndexTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(IndexedCardJson, 1.0)->GetAdaptiveCard();
+            auto photo = card->GetElementById("photo");
+            Assert::IsTrue(card->RemoveElement(photo));
+            Assert::IsTrue(card->GetElementById("photo") == nullptr);
+
+            // An index built later sees the body as it is then
+            Assert::AreEqual(static_cast<size_t>(1), card->BuildElementIndex().size());
+            Assert::AreEqual(static_cast<size_t>(8), card->GetElementIndex()->GetElementCount());
+        }
+
+        TEST_METHOD(DuplicateIdsInDocumentOrderTest)
+        {
+            auto indexedCard = AdaptiveCard::DeserializeFromString(IndexedCardJson, 1.0, MakeIndexingRegistration())->GetAdaptiveCard();
+            auto unindexedCard = AdaptiveCard::DeserializeFromString(IndexedCardJson, 1.0)->GetAdaptiveCard();
+            for (const auto& card : { indexedCard, unindexedCard })
+            {
+                // An element inserted before the holder of its id takes the id over, and is reported
+                auto inserted = std::make_shared<TextBlock>();
+                inserted->SetId("title");
+                auto warnings = card->InsertElement(nullptr, 0, inserted);
+                Assert::AreEqual(static_cast<size_t>(1), warnings.size());
+                Assert::IsTrue(warnings[0]->GetStatusCode() == WarningStatusCode::DuplicateId);
+                Assert::IsTrue(card->GetElementById("title") == inserted);
+
+                auto nested = std::make_shared<TextBlock>();
+                nested->SetId("name");
+                Assert::AreEqual(static_cast<size_t>(1), card->InsertElement(card->GetElementById("left"), 0, nested).size());
+                Assert::IsTrue(card->GetElementById("name") == nested);
+                Assert::IsTrue(card->InsertElement(card->GetElementById("left"), 0, std::make_shared<TextBlock>()).empty());
+
+                // Removing the holder hands the id to the next element in document order
+                Assert::IsTrue(card->RemoveElement(inserted));
+                Assert::AreEqual(std::string("Title"), std::static_pointer_cast<TextBlock>(card->GetElementById("title"))->GetText());
+                auto columns = card->GetElementById("columns");
+                card->SetElementId(columns, "title");
+                Assert::AreEqual(std::string("Title"), std::static_pointer_cast<TextBlock>(card->GetElementById("title"))->GetText());
+                Assert::IsTrue(card->RemoveElement(card->GetBody()[0]));
+                Assert::IsTrue(card->GetElementById("title") == columns);
+            }
+        }
+
+        TEST_METHOD(InsertElementAlreadyInCardTest)
+        {
+            auto indexedCard = AdaptiveCard::DeserializeFromString(IndexedCardJson, 1.0, MakeIndexingRegistration())->GetAdaptiveCard();
+            auto unindexedCard = AdaptiveCard::DeserializeFromString(IndexedCardJson, 1.0)->GetAdaptiveCard();
+            for (const auto& card : { indexedCard, unindexedCard })
+            {
+                const std::string serialized = card->Serialize();
+                auto textBlock = std::make_shared<TextBlock>();
+                card->InsertElement(nullptr, 0, textBlock);
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { card->InsertElement(nullptr, 0, textBlock); });
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { card->InsertElement(card->GetElementById("left"), 0, card->GetElementById("name")); });
+
+                // Nor can an element come back inside a new one, or go inside itself
+                auto container = std::make_shared<Container>();
+                container->GetItems().push_back(textBlock);
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { card->InsertElement(nullptr, 0, container); });
+                container->GetItems().clear();
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { card->InsertElement(container, 0, container); });
+
+                Assert::IsTrue(card->RemoveElement(textBlock));
+                Assert::IsFalse(card->RemoveElement(textBlock));
+                Assert::AreEqual(serialized, card->Serialize());
+            }
+        }
+
+        TEST_METHOD(DefaultRegistrationIsReadOnlyTest)
+        {
+            Assert::ExpectException<AdaptiveCardParseException>([]() { ElementParserRegistration::GetDefault()->SetIdIndexingEnabled(true); });
+            Assert::IsFalse(ElementParserRegistration::GetDefault()->IsIdIndexingEnabled());
+        }
+    };
+}
@@ -0,0 +1,151 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static const std::string ShowCardJson =
+        "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"lang\": \"de\","
+        "  \"backgroundImage\": \"http://adaptivecards.io/content/background.png\","
+        "  \"body\": [ { \"type\": \"Image\", \"url\": \"http://adaptivecards.io/content/outer.png\" } ],"
+        "  \"actions\": ["
+        "    { \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": {"
+        "      \"type\": \"AdaptiveCard\","
+        "      \"body\": ["
+        "        { \"type\": \"TextBlock\", \"text\": \"inner\" },"
+        "        { \"type\": \"ColumnSet\", \"columns\": [ { \"type\": \"Column\", \"items\": ["
+        "          { \"type\": \"ImageSet\", \"images\": ["
+        "            { \"type\": \"Image\", \"url\": \"http://adaptivecards.io/content/set1.png\" },"
+        "            { \"type\": \"Image\", \"url\": \"http://adaptivecards.io/content/set2.png\" } ] } ] } ] } ],"
+        "      \"actions\": ["
+        "        { \"type\": \"Action.ShowCard\", \"title\": \"More\", \"card\": {"
+        "          \"type\": \"AdaptiveCard\", \"backgroundImage\": \"http://adaptivecards.io/content/nested.png\", \"body\": [] } } ] } },"
+        "    { \"type\": \"Action.Submit\", \"title\": \"Submit\" } ] }";
+
+    static std::shared_ptr<ActionParserRegistration> MakeDeferringRegistration()
+    {
+        auto actionParserRegistration = std::make_shared<ActionParserRegistration>();
+        actionParserRegistration->SetShowCardParsingDeferred(true);
+        return actionParserRegistration;
+    }
+
+    class CustomElement : public BaseCardElement
+    {
+    public:
+        CustomElement() : BaseCardElement(CardElementType::Custom)
+        {
+        }
+
+        void GetResourceUris(std::vector<std::string>& resourceUris) override
+        {
+            resourceUris.push_back("http://adaptivecards.io/content/custom.png");
+        }
+    };
+
+    class CustomElementParser : public BaseCardElementParser
+    {
+    public:
+        std::shared_ptr<BaseCardElement> Deserialize(
+            std::shared_ptr<ElementParserRegistration>,
+            std::shared_ptr<ActionParserRegistration>,
+            const Json::Value&) override
+        {
+            return std::make_shared<CustomElement>();
+        }
+    };
+
+    TEST_CLASS(LazyShowCardTest)
+    {
+    public:
+        TEST_METHOD(MatchesEagerParseTest)
+        {
+            auto eagerCard = AdaptiveCard::DeserializeFromString(ShowCardJson, 1.0)->GetAdaptiveCard();
+            auto lazyCard = AdaptiveCard::DeserializeFromString(ShowCardJson, 1.0, nullptr, MakeDeferringRegistration())->GetAdaptiveCard();
+
+            // Resource URIs come from the JSON, leaving the card unparsed
+            std::vector<std::string> expectedUris = eagerCard->GetResourceUris();
+            Assert::AreEqual(static_cast<size_t>(5), expectedUris.size());
+            Assert::IsTrue(expectedUris == lazyCard->GetResourceUris());
+            Assert::IsTrue(expectedUris == AdaptiveCard::TryDeserializeFromString(ShowCardJson, 1.0, nullptr, MakeDeferringRegistration())->GetAdaptiveCard()->GetResourceUris());
+
+            // Serializing parses the card and writes the same JSON
+            Assert::AreEqual(eagerCard->Serialize(), lazyCard->Serialize());
+
+            // The language of the outer card still reaches the deferred one
+            auto showCardAction = std::static_pointer_cast<ShowCardAction>(lazyCard->GetActions()[0]);
+            auto textBlock = std::static_pointer_cast<TextBlock>(showCardAction->GetCard()->GetBody()[0]);
+            Assert::AreEqual(std::string("inner"), textBlock->GetText());
+            Assert::AreEqual(std::string("de"), textBlock->GetLanguage());
+            Assert::IsTrue(showCardAction->GetCard() == showCardAction->GetCard());
+        }
+
+        TEST_METHOD(CustomElementResourceUrisTest)
+        {
+            auto elementParserRegistration = std::make_shared<ElementParserRegistration>();
+            elementParserRegistration->AddParser("Custom", std::make_shared<CustomElementParser>());
+
+            std::string testJsonString =
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [], \"actions\": ["
+                "  { \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": {"
+                "    \"type\": \"AdaptiveCard\", \"body\": [ { \"type\": \"Custom\" } ] } } ] }";
+
+            // Only the parsed card knows the resources of custom elements
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, 1.0, elementParserRegistration, MakeDeferringRegistration())->GetAdaptiveCard();
+            std::vector<std::string> resourceUris = card->GetResourceUris();
+            Assert::AreEqual(static_cast<size_t>(1), resourceUris.size());
+            Assert::AreEqual(std::string("http://adaptivecards.io/content/custom.png"), resourceUris[0]);
+        }
+
+        TEST_METHOD(InvalidCardTest)
+        {
+            std::string testJsonString =
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [], \"actions\": ["
+                "  { \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": {"
+                "    \"type\": \"AdaptiveCard\", \"body\": [ { \"type\": \"Image\" } ] } } ] }";
+
+            // The outer card parses; the error surfaces when the deferred card is needed, without
+            // throwing from GetCard, which renderers call outside of any try block
+            auto result = AdaptiveCard::TryDeserializeFromString(testJsonString, 1.0, nullptr, MakeDeferringRegistration());
+            Assert::IsTrue(result->GetError() == nullptr);
+
+            auto showCardAction = std::static_pointer_cast<ShowCardAction>(result->GetAdaptiveCard()->GetActions()[0]);
+            auto card = showCardAction->GetCard();
+            Assert::IsTrue(card != nullptr);
+            Assert::IsTrue(card->GetBody().empty());
+
+            auto error = showCardAction->GetCardParseError();
+            Assert::IsTrue(error != nullptr);
+            Assert::IsTrue(error->GetStatusCode() == ErrorStatusCode::RequiredPropertyMissing);
+            Assert::IsTrue(result->GetAdaptiveCard()->GetResourceUris().empty());
+
+            // The card is written back as it was read
+            Json::Value cardJson = result->GetAdaptiveCard()->SerializeToJsonValue()["actions"][0]["card"];
+            Assert::AreEqual(std::string("Image"), cardJson["body"][0]["type"].asString());
+        }
+
+        TEST_METHOD(ParsedCardHasNoErrorTest)
+        {
+            std::string testJsonString =
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [], \"actions\": ["
+                "  { \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": {"
+                "    \"type\": \"AdaptiveCard\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"a\" } ] } } ] }";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, 1.0, nullptr, MakeDeferringRegistration())->GetAdaptiveCard();
+            auto showCardAction = std::static_pointer_cast<ShowCardAction>(card->GetActions()[0]);
+            Assert::IsTrue(showCardAction->GetCardParseError() == nullptr);
+            Assert::AreEqual(static_cast<size_t>(1), showCardAction->GetCard()->GetBody().size());
+        }
+
+        TEST_METHOD(DefaultRegistrationIsReadOnlyTest)
+        {
+            Assert::ExpectException<AdaptiveCardParseException>([]() { ActionParserRegistration::GetDefault()->SetShowCardParsingDeferred(true); });
+            Assert::IsFalse(ActionParserRegistration::GetDefault()->IsShowCardParsingDeferred());
+        }
+    };
+}
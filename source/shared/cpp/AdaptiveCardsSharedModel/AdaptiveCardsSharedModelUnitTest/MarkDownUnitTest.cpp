@@ -1,6 +1,8 @@
 #include "stdafx.h"
 #include "CppUnitTest.h"
 #include "MarkDownParser.h"
+#include <algorithm>
+#include <chrono>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
@@ -225,6 +227,40 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual<string>("<p><strong>foo <em>bar <strong>baz</strong>\n bim</em> bop</strong></p>", parser13.TransformToHtml());
 
         }
+        TEST_METHOD(UnmatchedDelimitersTest)
+        {
+            MarkDownParser parser("_a a* _b b* c_");
+            Assert::AreEqual<string>("<p>_a a* <em>b b* c</em></p>", parser.TransformToHtml());
+
+            // 100k delims, none of which match: each right delim fails to match the left delims
+            // before it, which the matcher must not search again for every one of them. If it did,
+            // doubling the input would take four times as long rather than twice, and the 100k
+            // input would take seconds rather than milliseconds.
+            std::string halfText;
+            for (int i = 0; i < 25000; ++i)
+            {
+                halfText += "_a a* ";
+            }
+            const std::string text = halfText + halfText;
+
+            std::chrono::steady_clock::duration halfElapsed = std::chrono::steady_clock::duration::max();
+            std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::duration::max();
+            for (int run = 0; run < 3; ++run)
+            {
+                auto start = std::chrono::steady_clock::now();
+                MarkDownParser halfParser(halfText);
+                Assert::AreEqual<string>("<p>" + halfText + "</p>", halfParser.TransformToHtml());
+                halfElapsed = std::min(halfElapsed, std::chrono::steady_clock::now() - start);
+
+                start = std::chrono::steady_clock::now();
+                MarkDownParser parser2(text);
+                Assert::AreEqual<string>("<p>" + text + "</p>", parser2.TransformToHtml());
+                elapsed = std::min(elapsed, std::chrono::steady_clock::now() - start);
+            }
+
+            Assert::IsTrue(elapsed < std::chrono::seconds(2));
+            Assert::IsTrue(elapsed < 3 * halfElapsed + std::chrono::milliseconds(5));
+        }
     };
     TEST_CLASS(Rule11_12Test)
     {
@@ -550,4 +586,94 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual<string>("<p>Green Eggs &amp; Ham</p>", parser.TransformToHtml());
         }
     };
+    TEST_CLASS(MarkDownBlocksTest)
+    {
+        TEST_METHOD(EmptyStringTest)
+        {
+            MarkDownParser parser("");
+            Assert::IsTrue(parser.TransformToBlocks().empty());
+        }
+        TEST_METHOD(EmphasisRunsTest)
+        {
+            MarkDownParser parser("a *b **c** d* 3<5");
+            auto blocks = parser.TransformToBlocks();
+            Assert::AreEqual(static_cast<size_t>(1), blocks.size());
+            Assert::IsTrue(blocks[0].type == MarkDownBlockType::ContainerBlock);
+
+            const auto& runs = blocks[0].runs;
+            Assert::AreEqual(static_cast<size_t>(5), runs.size());
+            Assert::AreEqual<string>("a ", runs[0].text);
+            Assert::IsFalse(runs[0].isBold || runs[0].isItalic);
+            Assert::AreEqual<string>("b ", runs[1].text);
+            Assert::IsTrue(!runs[1].isBold && runs[1].isItalic);
+            Assert::AreEqual<string>("c", runs[2].text);
+            Assert::IsTrue(runs[2].isBold && runs[2].isItalic);
+            Assert::AreEqual<string>(" d", runs[3].text);
+            Assert::IsTrue(!runs[3].isBold && runs[3].isItalic);
+            // text is unescaped
+            Assert::AreEqual<string>(" 3<5", runs[4].text);
+        }
+        TEST_METHOD(LinkRunsTest)
+        {
+            MarkDownParser parser("see [the **docs**](http://a.b/?x=1&y=2) now");
+            auto blocks = parser.TransformToBlocks();
+            Assert::AreEqual(static_cast<size_t>(1), blocks.size());
+
+            const auto& runs = blocks[0].runs;
+            Assert::AreEqual(static_cast<size_t>(4), runs.size());
+            Assert::AreEqual<string>("see ", runs[0].text);
+            Assert::IsTrue(runs[0].linkTarget.empty());
+            Assert::AreEqual<string>("the ", runs[1].text);
+            Assert::AreEqual<string>("http://a.b/?x=1&y=2", runs[1].linkTarget);
+            Assert::AreEqual<string>("docs", runs[2].text);
+            Assert::IsTrue(runs[2].isBold);
+            Assert::AreEqual<string>("http://a.b/?x=1&y=2", runs[2].linkTarget);
+            Assert::AreEqual<string>(" now", runs[3].text);
+            Assert::IsTrue(runs[3].linkTarget.empty());
+
+            Assert::AreEqual(-1, runs[0].linkIndex);
+            Assert::AreEqual(0, runs[1].linkIndex);
+            Assert::AreEqual(0, runs[2].linkIndex);
+            Assert::AreEqual(-1, runs[3].linkIndex);
+        }
+        TEST_METHOD(AdjacentLinkRunsTest)
+        {
+            // links next to each other stay apart even when they go to the same destination
+            MarkDownParser parser("[a](x)[b](x)");
+            auto blocks = parser.TransformToBlocks();
+            Assert::AreEqual(static_cast<size_t>(1), blocks.size());
+
+            const auto& runs = blocks[0].runs;
+            Assert::AreEqual(static_cast<size_t>(2), runs.size());
+            Assert::AreEqual<string>("a", runs[0].text);
+            Assert::AreEqual<string>("x", runs[0].linkTarget);
+            Assert::AreEqual(0, runs[0].linkIndex);
+            Assert::AreEqual<string>("b", runs[1].text);
+            Assert::AreEqual<string>("x", runs[1].linkTarget);
+            Assert::AreEqual(1, runs[1].linkIndex);
+        }
+        TEST_METHOD(ListBlocksTest)
+        {
+            MarkDownParser parser("Intro\r- one\r- *two*\r\r7. seven\r1. eight");
+            auto blocks = parser.TransformToBlocks();
+            Assert::AreEqual(static_cast<size_t>(5), blocks.size());
+
+            Assert::IsTrue(blocks[0].type == MarkDownBlockType::ContainerBlock);
+            Assert::AreEqual<string>("Intro", blocks[0].runs[0].text);
+
+            Assert::IsTrue(blocks[1].type == MarkDownBlockType::UnorderedList);
+            Assert::AreEqual<string>("one", blocks[1].runs[0].text);
+            Assert::IsTrue(blocks[2].type == MarkDownBlockType::UnorderedList);
+            Assert::AreEqual<string>("two", blocks[2].runs[0].text);
+            Assert::IsTrue(blocks[2].runs[0].isItalic);
+
+            // ordered list items are numbered from the first one, as with <ol start="7">
+            Assert::IsTrue(blocks[3].type == MarkDownBlockType::OrderedList);
+            Assert::AreEqual(7u, blocks[3].listNumber);
+            Assert::AreEqual<string>("seven", blocks[3].runs[0].text);
+            Assert::IsTrue(blocks[4].type == MarkDownBlockType::OrderedList);
+            Assert::AreEqual(8u, blocks[4].listNumber);
+            Assert::AreEqual<string>("eight", blocks[4].runs[0].text);
+        }
+    };
 }
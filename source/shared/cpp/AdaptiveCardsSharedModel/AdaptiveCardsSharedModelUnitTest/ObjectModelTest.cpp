@@ -181,4 +181,103 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual(selectAction->GetElementTypeString(), "Action.Submit"s);
         }
     };
-}
\ No newline at end of file
+
+    TEST_CLASS(EnumMappingsTest)
+    {
+    public:
+        TEST_METHOD(EnumToStringRoundTripTest)
+        {
+            Assert::AreEqual("selectAction"s, AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction));
+            Assert::IsTrue(AdaptiveCardSchemaKey::SelectAction == AdaptiveCardSchemaKeyFromString("selectAction"));
+            Assert::AreEqual("Input.ChoiceSet"s, CardElementTypeToString(CardElementType::ChoiceSetInput));
+            Assert::IsTrue(CardElementType::ChoiceSetInput == CardElementTypeFromString("Input.ChoiceSet"));
+            Assert::AreEqual("Action.ShowCard"s, ActionTypeToString(ActionType::ShowCard));
+            Assert::IsTrue(ActionType::ShowCard == ActionTypeFromString("Action.ShowCard"));
+        }
+
+        TEST_METHOD(StringToEnumIsCaseInsensitiveTest)
+        {
+            Assert::IsTrue(TextSize::ExtraLarge == TextSizeFromString("extralarge"));
+            Assert::IsTrue(TextSize::ExtraLarge == TextSizeFromString("EXTRALARGE"));
+            Assert::IsTrue(CardElementType::TextBlock == CardElementTypeFromString("textblock"));
+        }
+
+        TEST_METHOD(BackCompatNamesTest)
+        {
+            Assert::IsTrue(TextSize::Default == TextSizeFromString("Normal"));
+            Assert::IsTrue(TextWeight::Default == TextWeightFromString("normal"));
+            Assert::IsTrue(ImageStyle::Default == ImageStyleFromString("Normal"));
+
+            // Back compat names are only accepted on input
+            Assert::AreEqual("Default"s, TextSizeToString(TextSize::Default));
+        }
+
+        TEST_METHOD(UnknownNamesTest)
+        {
+            Assert::IsTrue(CardElementType::Unsupported == CardElementTypeFromString("Input.Unknown"));
+            Assert::IsTrue(ActionType::Unsupported == ActionTypeFromString("Action.Unknown"));
+            Assert::IsTrue(HorizontalAlignment::Left == HorizontalAlignmentFromString("Middle"));
+
+            // "Center" and "Centre" differ in spelling but not in character sum
+            Assert::IsTrue(HorizontalAlignment::Center == HorizontalAlignmentFromString("Center"));
+            Assert::IsTrue(HorizontalAlignment::Left == HorizontalAlignmentFromString("Centre"));
+
+            Assert::ExpectException<std::out_of_range>([]() { AdaptiveCardSchemaKeyFromString("notAKey"); });
+            Assert::ExpectException<std::out_of_range>([]() { CardElementTypeToString(CardElementType::Unsupported); });
+            Assert::ExpectException<std::out_of_range>([]() { ImageSizeToString(ImageSize::None); });
+        }
+    };
+
+    class TestActionParser : public ActionElementParser
+    {
+    public:
+        std::shared_ptr<BaseActionElement> Deserialize(
+            std::shared_ptr<ElementParserRegistration>,
+            std::shared_ptr<ActionParserRegistration>,
+            const Json::Value&) override
+        {
+            return nullptr;
+        }
+    };
+
+    TEST_CLASS(ParserRegistrationTest)
+    {
+    public:
+        TEST_METHOD(DefaultRegistrationIsSharedAndReadOnlyTest)
+        {
+            Assert::IsTrue(ElementParserRegistration::GetDefault() == ElementParserRegistration::GetDefault());
+            Assert::IsTrue(ActionParserRegistration::GetDefault() == ActionParserRegistration::GetDefault());
+            Assert::IsTrue(ElementParserRegistration::GetDefault()->GetParser("TextBlock") != nullptr);
+            Assert::IsTrue(ActionParserRegistration::GetDefault()->GetParser("Action.Submit") != nullptr);
+
+            Assert::ExpectException<AdaptiveCardParseException>([]() { ActionParserRegistration::GetDefault()->AddParser("Custom.Action", std::make_shared<TestActionParser>()); });
+            Assert::ExpectException<AdaptiveCardParseException>([]() { ActionParserRegistration::GetDefault()->RemoveParser("Custom.Action"); });
+            Assert::IsTrue(ActionParserRegistration::GetDefault()->GetParser("Custom.Action") == nullptr);
+        }
+
+        TEST_METHOD(DerivedRegistrationTest)
+        {
+            auto actionParserRegistration = std::make_shared<ActionParserRegistration>();
+            auto parser = std::make_shared<TestActionParser>();
+            actionParserRegistration->AddParser("Custom.Action", parser);
+
+            Assert::IsTrue(actionParserRegistration->GetParser("custom.action") == parser);
+            Assert::IsTrue(actionParserRegistration->GetParser("Action.OpenUrl") == ActionParserRegistration::GetDefault()->GetParser("Action.OpenUrl"));
+            Assert::IsTrue(ActionParserRegistration::GetDefault()->GetParser("Custom.Action") == nullptr);
+
+            actionParserRegistration->RemoveParser("Custom.Action");
+            Assert::IsTrue(actionParserRegistration->GetParser("Custom.Action") == nullptr);
+        }
+
+        TEST_METHOD(KnownParsersCannotBeOverriddenTest)
+        {
+            auto elementParserRegistration = std::make_shared<ElementParserRegistration>();
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { elementParserRegistration->RemoveParser("TextBlock"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { elementParserRegistration->RemoveParser("textblock"); });
+            Assert::IsTrue(elementParserRegistration->GetParser("TextBlock") != nullptr);
+
+            auto actionParserRegistration = std::make_shared<ActionParserRegistration>();
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { actionParserRegistration->AddParser("action.submit", std::make_shared<TestActionParser>()); });
+        }
+    };
+}
@@ -0,0 +1,132 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "ParseCache.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static std::string MakeCacheTestCard(const std::string& text)
+    {
+        return "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"" + text + "\" } ] }";
+    }
+
+    class ParseCacheTestParser : public BaseCardElementParser
+    {
+    public:
+        std::shared_ptr<BaseCardElement> Deserialize(
+            std::shared_ptr<ElementParserRegistration>,
+            std::shared_ptr<ActionParserRegistration>,
+            const Json::Value& value) override
+        {
+            return BaseCardElement::Deserialize<TextBlock>(value);
+        }
+    };
+
+    TEST_CLASS(ParseCacheTest)
+    {
+    public:
+        TEST_METHOD(HitAndMissTest)
+        {
+            ParseCache cache(1024 * 1024);
+
+            auto first = cache.DeserializeFromString(MakeCacheTestCard("a"), 1.0);
+            auto second = cache.DeserializeFromString(MakeCacheTestCard("a"), 1.0);
+            auto other = cache.DeserializeFromString(MakeCacheTestCard("b"), 1.0);
+
+            Assert::IsTrue(first == second);
+            Assert::IsTrue(first != other);
+            Assert::AreEqual(1ull, cache.GetHitCount());
+            Assert::AreEqual(2ull, cache.GetMissCount());
+            Assert::AreEqual(static_cast<size_t>(2), cache.GetEntryCount());
+            Assert::AreEqual(AdaptiveCard::DeserializeFromString(MakeCacheTestCard("a"), 1.0)->GetAdaptiveCard()->Serialize(), second->GetAdaptiveCard()->Serialize());
+        }
+
+        TEST_METHOD(KeyIncludesVersionAndRegistrationsTest)
+        {
+            ParseCache cache(1024 * 1024);
+            const std::string card = MakeCacheTestCard("a");
+
+            auto defaultResult = cache.DeserializeFromString(card, 1.0);
+            Assert::IsTrue(defaultResult == cache.DeserializeFromString(card, 1.0, ElementParserRegistration::GetDefault(), ActionParserRegistration::GetDefault()));
+            Assert::IsTrue(defaultResult != cache.DeserializeFromString(card, 2.0));
+            Assert::IsTrue(defaultResult != cache.DeserializeFromString(card, 1.0, std::make_shared<ElementParserRegistration>()));
+            Assert::IsTrue(defaultResult != cache.DeserializeFromString(card, 1.0, nullptr, std::make_shared<ActionParserRegistration>()));
+            Assert::AreEqual(1ull, cache.GetHitCount());
+        }
+
+        TEST_METHOD(RegistrationChangesTest)
+        {
+            ParseCache cache(1024 * 1024);
+            auto registration = std::make_shared<ElementParserRegistration>();
+            const std::string card = "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"CacheTestElement\", \"text\": \"a\" } ] }";
+
+            auto unknown = cache.DeserializeFromString(card, 1.0, registration);
+            Assert::IsTrue(unknown->GetAdaptiveCard()->GetBody()[0]->GetElementType() == CardElementType::Unknown);
+
+            // results parsed before a parser is added or removed are not returned after
+            registration->AddParser("CacheTestElement", std::make_shared<ParseCacheTestParser>());
+            auto parsed = cache.DeserializeFromString(card, 1.0, registration);
+            Assert::IsTrue(parsed->GetAdaptiveCard()->GetBody()[0]->GetElementType() == CardElementType::TextBlock);
+            Assert::IsTrue(parsed == cache.DeserializeFromString(card, 1.0, registration));
+
+            registration->RemoveParser("CacheTestElement");
+            auto unknownAgain = cache.DeserializeFromString(card, 1.0, registration);
+            Assert::IsTrue(unknownAgain->GetAdaptiveCard()->GetBody()[0]->GetElementType() == CardElementType::Unknown);
+            Assert::AreEqual(1ull, cache.GetHitCount());
+            Assert::AreEqual(3ull, cache.GetMissCount());
+        }
+
+        TEST_METHOD(EvictionTest)
+        {
+            const std::string cardA = MakeCacheTestCard("a");
+            const std::string cardB = MakeCacheTestCard("b");
+            const std::string cardC = MakeCacheTestCard("c");
+
+            ParseCache cache(1024);
+            cache.DeserializeFromString(cardA, 1.0);
+            cache.DeserializeFromString(cardB, 1.0);
+            cache.DeserializeFromString(cardA, 1.0);
+
+            // Keep adding entries until the least recently used one, B, has to go
+            while (cache.GetEvictionCount() == 0)
+            {
+                cache.DeserializeFromString(MakeCacheTestCard(std::to_string(cache.GetMissCount())), 1.0);
+            }
+            Assert::IsTrue(cache.GetSizeInBytes() <= cache.GetCapacityInBytes());
+
+            const unsigned long long misses = cache.GetMissCount();
+            cache.DeserializeFromString(cardB, 1.0);
+            Assert::AreEqual(misses + 1, cache.GetMissCount());
+
+            cache.Clear();
+            Assert::AreEqual(static_cast<size_t>(0), cache.GetEntryCount());
+            Assert::AreEqual(static_cast<size_t>(0), cache.GetSizeInBytes());
+        }
+
+        TEST_METHOD(FailuresAreNotCachedTest)
+        {
+            ParseCache cache(1024 * 1024);
+            const std::string invalidCard = "{ \"type\": \"AdaptiveCard\", \"version\": \"abc\" }";
+
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { cache.DeserializeFromString(invalidCard, 1.0); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { cache.DeserializeFromString(invalidCard, 1.0); });
+            Assert::AreEqual(static_cast<size_t>(0), cache.GetEntryCount());
+            Assert::AreEqual(2ull, cache.GetMissCount());
+        }
+
+        TEST_METHOD(HashTest)
+        {
+            const std::string payload = MakeCacheTestCard("a");
+            Assert::AreEqual(ParseCache::Hash(payload.data(), payload.size()), ParseCache::Hash(payload.data(), payload.size()));
+            for (size_t length = 0; length < 16; ++length)
+            {
+                Assert::AreNotEqual(ParseCache::Hash(payload.data(), length), ParseCache::Hash(payload.data(), length + 1));
+            }
+        }
+    };
+}
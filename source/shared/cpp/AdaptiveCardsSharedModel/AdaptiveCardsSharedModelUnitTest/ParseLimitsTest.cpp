@@ -0,0 +1,174 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static std::string MakeCard(const std::string& body, const std::string& actions = "")
+    {
+        return "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ " + body + " ], \"actions\": [ " + actions + " ] }";
+    }
+
+    static std::string MakeNestedContainers(unsigned int depth)
+    {
+        std::string element = "{ \"type\": \"TextBlock\", \"text\": \"leaf\" }";
+        for (unsigned int i = 0; i < depth; ++i)
+        {
+            element = "{ \"type\": \"Container\", \"items\": [ " + element + " ] }";
+        }
+        return element;
+    }
+
+    static std::string MakeNestedShowCards(unsigned int depth)
+    {
+        std::string action = "{ \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": { \"type\": \"AdaptiveCard\", \"body\": [] } }";
+        for (unsigned int i = 1; i < depth; ++i)
+        {
+            action = "{ \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": { \"type\": \"AdaptiveCard\", \"actions\": [ " + action + " ] } }";
+        }
+        return MakeCard("", action);
+    }
+
+    static std::shared_ptr<AdaptiveCardParseError> ExpectLimitExceeded(const std::shared_ptr<ParseResult>& result)
+    {
+        Assert::IsTrue(result->GetAdaptiveCard() == nullptr);
+        Assert::IsTrue(result->GetError() != nullptr);
+        Assert::IsTrue(ErrorStatusCode::ParseLimitExceeded == result->GetError()->GetStatusCode());
+        return result->GetError();
+    }
+
+    TEST_CLASS(ParseLimitsTest)
+    {
+    public:
+        TEST_METHOD(WithinLimitsTest)
+        {
+            ParseLimits limits;
+            limits.maxPayloadLength = 4096;
+            limits.maxDepth = 4;
+            limits.maxElementCount = 5;
+            limits.maxStringLength = 8;
+            limits.maxChoiceCount = 2;
+            limits.maxShowCardDepth = 1;
+
+            std::string testJsonString = MakeCard(
+                MakeNestedContainers(1) + ", { \"type\": \"Input.ChoiceSet\", \"id\": \"choice\", \"choices\": [ { \"title\": \"a\", \"value\": \"1\" } ] }",
+                "{ \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": { \"type\": \"AdaptiveCard\", \"body\": [] } }");
+
+            auto result = AdaptiveCard::TryDeserializeFromString(testJsonString, 1.0, limits);
+            Assert::IsTrue(result->GetError() == nullptr);
+            Assert::IsTrue(result->GetAdaptiveCard() != nullptr);
+
+            // Container, its text block, the choice set, its choice and the action
+            Assert::AreEqual(5u, result->GetStatistics().elementCount);
+            Assert::AreEqual(2u, result->GetStatistics().maxDepth);
+            Assert::AreEqual(1u, result->GetStatistics().maxShowCardDepth);
+        }
+
+        TEST_METHOD(DepthLimitTest)
+        {
+            ParseLimits limits;
+            limits.maxDepth = 32;
+
+            auto result = AdaptiveCard::TryDeserializeFromString(MakeCard(MakeNestedContainers(400)), 1.0, limits);
+            std::string expectedPath = "$.body[0]";
+            for (int i = 0; i < 32; ++i)
+            {
+                expectedPath += ".items[0]";
+            }
+            Assert::AreEqual(expectedPath, ExpectLimitExceeded(result)->GetJsonPath());
+
+            // Parsing stops at the first element past the limit
+            Assert::AreEqual(33u, result->GetStatistics().maxDepth);
+            Assert::AreEqual(33u, result->GetStatistics().elementCount);
+        }
+
+        TEST_METHOD(ElementCountLimitTest)
+        {
+            ParseLimits limits;
+            limits.maxElementCount = 100;
+
+            std::string body = "{ \"type\": \"TextBlock\", \"text\": \"0\" }";
+            for (int i = 1; i < 10000; ++i)
+            {
+                body += ", { \"type\": \"TextBlock\", \"text\": \"" + std::to_string(i) + "\" }";
+            }
+
+            auto result = AdaptiveCard::TryDeserializeFromString(MakeCard(body), 1.0, limits);
+            auto error = ExpectLimitExceeded(result);
+            Assert::AreEqual(std::string("$.body[100]"), error->GetJsonPath());
+            Assert::AreEqual(101u, result->GetStatistics().elementCount);
+        }
+
+        TEST_METHOD(StringLengthLimitTest)
+        {
+            ParseLimits limits;
+            limits.maxStringLength = 1024;
+
+            std::string longText(1 << 20, 'a');
+            auto result = AdaptiveCard::TryDeserializeFromString(
+                MakeCard("{ \"type\": \"TextBlock\", \"text\": \"" + longText + "\" }"), 1.0, limits);
+            Assert::AreEqual(std::string("$.body[0].text"), ExpectLimitExceeded(result)->GetJsonPath());
+
+            result = AdaptiveCard::TryDeserializeFromString(
+                MakeCard("", "{ \"type\": \"Action.Submit\", \"title\": \"Submit\", \"data\": { \"x\": \"" + longText + "\" } }"), 1.0, limits);
+            Assert::AreEqual(std::string("$.actions[0].data"), ExpectLimitExceeded(result)->GetJsonPath());
+        }
+
+        TEST_METHOD(ChoiceCountLimitTest)
+        {
+            ParseLimits limits;
+            limits.maxChoiceCount = 100;
+
+            std::string choices = "{ \"title\": \"0\", \"value\": \"0\" }";
+            for (int i = 1; i < 5000; ++i)
+            {
+                choices += ", { \"title\": \"" + std::to_string(i) + "\", \"value\": \"" + std::to_string(i) + "\" }";
+            }
+
+            auto result = AdaptiveCard::TryDeserializeFromString(
+                MakeCard("{ \"type\": \"Input.ChoiceSet\", \"id\": \"choice\", \"choices\": [ " + choices + " ] }"), 1.0, limits);
+            Assert::AreEqual(std::string("$.body[0].choices"), ExpectLimitExceeded(result)->GetJsonPath());
+
+            // None of the choices were parsed
+            Assert::AreEqual(1u, result->GetStatistics().elementCount);
+        }
+
+        TEST_METHOD(ShowCardDepthLimitTest)
+        {
+            ParseLimits limits;
+            limits.maxShowCardDepth = 3;
+
+            auto result = AdaptiveCard::TryDeserializeFromString(MakeNestedShowCards(50), 1.0, limits);
+            Assert::AreEqual(std::string("$.actions[0].card.actions[0].card.actions[0].card.actions[0].card"), ExpectLimitExceeded(result)->GetJsonPath());
+            Assert::AreEqual(4u, result->GetStatistics().maxShowCardDepth);
+
+            limits.maxShowCardDepth = 50;
+            Assert::IsTrue(AdaptiveCard::TryDeserializeFromString(MakeNestedShowCards(50), 1.0, limits)->GetError() == nullptr);
+        }
+
+        TEST_METHOD(PayloadLengthLimitTest)
+        {
+            ParseLimits limits;
+            limits.maxPayloadLength = 64;
+
+            std::string testJsonString = MakeCard("{ \"type\": \"TextBlock\", \"text\": \"Hello\" }");
+            ExpectLimitExceeded(AdaptiveCard::TryDeserializeFromString(testJsonString, 1.0, limits));
+
+            limits.maxPayloadLength = testJsonString.size();
+            Assert::IsTrue(AdaptiveCard::TryDeserializeFromString(testJsonString, 1.0, limits)->GetError() == nullptr);
+        }
+
+        TEST_METHOD(JsonNestedPastReaderLimitTest)
+        {
+            std::string testJsonString = MakeCard("{ \"type\": \"TextBlock\", \"text\": \"a\", \"deep\": " + std::string(5000, '[') + std::string(5000, ']') + " }");
+
+            auto result = AdaptiveCard::TryDeserializeFromString(testJsonString, 1.0);
+            Assert::IsTrue(result->GetError() != nullptr);
+            Assert::IsTrue(ErrorStatusCode::InvalidJson == result->GetError()->GetStatusCode());
+        }
+    };
+}
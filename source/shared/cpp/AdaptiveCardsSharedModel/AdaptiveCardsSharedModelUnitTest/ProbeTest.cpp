@@ -0,0 +1,61 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(ProbeTest)
+    {
+    public:
+        TEST_METHOD(CardMetadataTest)
+        {
+            std::string testJsonString =
+                "{ \"body\": [ { \"type\": \"TextBlock\", \"text\": \"\\\"version\\\": \\\"9.9\\\"\" } ],"
+                "  \"type\": \"AdaptiveCard\", \"version\": \"1.2\", \"fallbackText\": \"Upgrade \\u00e9\","
+                "  \"actions\": [ { \"type\": \"Action.ShowCard\", \"card\": { \"version\": \"9.9\", \"speak\": \"nested\" } } ],"
+                "  \"lang\": \"fr\", \"speak\": null }";
+
+            CardProbe probe = AdaptiveCard::Probe(testJsonString);
+            Assert::AreEqual(std::string("1.2"), probe.version);
+            Assert::IsTrue(probe.hasValidVersion);
+            Assert::AreEqual(1.2, probe.parsedVersion.value);
+            Assert::AreEqual(std::string("Upgrade \xc3\xa9"), probe.fallbackText);
+            Assert::AreEqual(std::string("fr"), probe.language);
+            Assert::AreEqual(std::string(""), probe.speak);
+
+            Assert::IsTrue(probe.IsSupportedBy(1.2));
+            Assert::IsTrue(probe.IsSupportedBy(2.0));
+            Assert::IsFalse(probe.IsSupportedBy(1.1));
+        }
+
+        TEST_METHOD(MatchesDeserializeTest)
+        {
+            const std::string versions[] = {
+                "1.0", "1.10", "2", " 1.5", "", "one", "1e5", "0x10", "1.0000000001", ".5", "-1", "1.5abc", "1e999" };
+            const double rendererVersions[] = { 1.0, 1.5 };
+            for (const auto& version : versions)
+            {
+                std::string testJsonString = "{ \"type\": \"AdaptiveCard\", \"version\": \"" + version + "\", \"fallbackText\": \"fallback\", \"body\": [] }";
+                CardProbe probe = AdaptiveCard::Probe(testJsonString);
+
+                for (double rendererVersion : rendererVersions)
+                {
+                    auto result = AdaptiveCard::TryDeserializeFromString(testJsonString, rendererVersion);
+                    const bool isParsed = result->GetError() == nullptr && result->GetWarnings().empty();
+                    Assert::AreEqual(isParsed, probe.IsSupportedBy(rendererVersion));
+                }
+            }
+        }
+
+        TEST_METHOD(InvalidPayloadTest)
+        {
+            Assert::ExpectException<AdaptiveCardParseException>([]() { AdaptiveCard::Probe("[ 1, 2 ]"); });
+            Assert::ExpectException<AdaptiveCardParseException>([]() { AdaptiveCard::Probe("{ \"version\": \"1.0\", \"body\": [ "); });
+            Assert::ExpectException<AdaptiveCardParseException>([]() { AdaptiveCard::Probe("{ \"version\": 1.0 }"); });
+        }
+    };
+}
@@ -0,0 +1,285 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "ResourceLoader.h"
+#include <Windows.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Holds on to the loads it is given until the test completes them
+    class StubResourceResolver : public ResourceResolver
+    {
+    public:
+        void Resolve(const std::string& uri, ResourceLoadCallback callback) override
+        {
+            uris.push_back(uri);
+            callbacks.push_back(callback);
+        }
+
+        void Complete(size_t index, const std::string& content)
+        {
+            callbacks[index](ResourceLoadResult(uris[index], std::make_shared<const std::string>(content)));
+        }
+
+        std::vector<std::string> uris;
+        std::vector<ResourceLoadCallback> callbacks;
+    };
+
+    // Empty directory of its own under the temp directory, removed along with whatever was left
+    // in it when the test is over, whether or not it passed
+    class TemporaryDirectory
+    {
+    public:
+        TemporaryDirectory()
+        {
+            char tempPath[MAX_PATH];
+            GetTempPathA(MAX_PATH, tempPath);
+            m_path = std::string(tempPath) + "AdaptiveCardsSharedModelUnitTest" + std::to_string(GetCurrentProcessId());
+            CreateDirectoryA(m_path.c_str(), nullptr);
+        }
+
+        ~TemporaryDirectory()
+        {
+            WIN32_FIND_DATAA findData;
+            HANDLE find = FindFirstFileA((m_path + "\\*").c_str(), &findData);
+            if (find != INVALID_HANDLE_VALUE)
+            {
+                do
+                {
+                    if ((findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+                    {
+                        DeleteFileA((m_path + "\\" + findData.cFileName).c_str());
+                    }
+                } while (FindNextFileA(find, &findData));
+                FindClose(find);
+            }
+            RemoveDirectoryA(m_path.c_str());
+        }
+
+        TemporaryDirectory(const TemporaryDirectory&) = delete;
+        TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+
+        const std::string& GetPath() const
+        {
+            return m_path;
+        }
+
+    private:
+        std::string m_path;
+    };
+
+    // Records the results of the loads it is handed to
+    struct LoadRecorder
+    {
+        ResourceLoadCallback GetCallback()
+        {
+            return [this](const ResourceLoadResult& result) { results.push_back(result); };
+        }
+
+        std::vector<ResourceLoadResult> results;
+    };
+
+    TEST_CLASS(ResourceLoaderTest)
+    {
+    public:
+        TEST_METHOD(CacheHitTest)
+        {
+            auto resolver = std::make_shared<MemoryResourceResolver>();
+            resolver->Add("mem://image.png", "image");
+            ResourceLoader loader(1024);
+            loader.SetResolver("MEM", resolver);
+
+            LoadRecorder recorder;
+            loader.Load("mem://image.png", recorder.GetCallback());
+            loader.Load("mem://image.png", recorder.GetCallback());
+
+            Assert::AreEqual(static_cast<size_t>(2), recorder.results.size());
+            Assert::IsTrue(recorder.results[1].status == ResourceLoadStatus::Loaded);
+            Assert::AreEqual(std::string("image"), *recorder.results[1].content);
+            Assert::IsTrue(recorder.results[0].content == recorder.results[1].content);
+            Assert::AreEqual(1ULL, loader.GetMissCount());
+            Assert::AreEqual(1ULL, loader.GetHitCount());
+            Assert::AreEqual(static_cast<size_t>(1), loader.GetEntryCount());
+
+            // Served from the cache even once the resolver no longer has it
+            resolver->Remove("mem://image.png");
+            loader.Load("mem://image.png", recorder.GetCallback());
+            Assert::IsTrue(recorder.results[2].status == ResourceLoadStatus::Loaded);
+
+            loader.Clear();
+            loader.Load("mem://image.png", recorder.GetCallback());
+            Assert::IsTrue(recorder.results[3].status == ResourceLoadStatus::NotFound);
+            Assert::AreEqual(static_cast<size_t>(0), loader.GetSizeInBytes());
+        }
+
+        TEST_METHOD(CoalescingTest)
+        {
+            auto resolver = std::make_shared<StubResourceResolver>();
+            ResourceLoader loader(1024);
+            loader.SetResolver("stub", resolver);
+
+            LoadRecorder recorder;
+            loader.Load("stub:a", recorder.GetCallback());
+            loader.Load("stub:b", recorder.GetCallback());
+            loader.Load("stub:a", recorder.GetCallback());
+            loader.Load("stub:a", recorder.GetCallback());
+
+            // One resolve per URI, and nothing completes until the resolver does
+            Assert::AreEqual(static_cast<size_t>(2), resolver->uris.size());
+            Assert::AreEqual(2ULL, loader.GetCoalescedCount());
+            Assert::AreEqual(static_cast<size_t>(0), recorder.results.size());
+
+            resolver->Complete(0, "a");
+            Assert::AreEqual(static_cast<size_t>(3), recorder.results.size());
+            for (const auto& result : recorder.results)
+            {
+                Assert::AreEqual(std::string("stub:a"), result.uri);
+                Assert::AreEqual(std::string("a"), *result.content);
+            }
+
+            resolver->Complete(1, "b");
+            Assert::AreEqual(std::string("stub:b"), recorder.results[3].uri);
+
+            // Later loads are served from memory
+            loader.Load("stub:a", recorder.GetCallback());
+            Assert::AreEqual(static_cast<size_t>(2), resolver->uris.size());
+            Assert::AreEqual(static_cast<size_t>(5), recorder.results.size());
+        }
+
+        TEST_METHOD(EvictionTest)
+        {
+            auto resolver = std::make_shared<MemoryResourceResolver>();
+            const std::string content(100, 'x');
+            resolver->Add("mem:a", content);
+            resolver->Add("mem:b", content);
+            resolver->Add("mem:c", content);
+
+            // Room for two entries but not three
+            ResourceLoader loader(2 * (content.size() + 5 + 100) + 60);
+            loader.SetResolver("mem", resolver);
+
+            LoadRecorder recorder;
+            loader.Load("mem:a", recorder.GetCallback());
+            loader.Load("mem:b", recorder.GetCallback());
+            loader.Load("mem:a", recorder.GetCallback());
+            Assert::AreEqual(static_cast<size_t>(2), loader.GetEntryCount());
+
+            // b is the least recently used
+            loader.Load("mem:c", recorder.GetCallback());
+            Assert::AreEqual(1ULL, loader.GetEvictionCount());
+            Assert::AreEqual(static_cast<size_t>(2), loader.GetEntryCount());
+            Assert::IsTrue(loader.GetSizeInBytes() <= loader.GetMemoryCapacityInBytes());
+
+            const unsigned long long missCount = loader.GetMissCount();
+            loader.Load("mem:a", recorder.GetCallback());
+            Assert::AreEqual(missCount, loader.GetMissCount());
+            loader.Load("mem:b", recorder.GetCallback());
+            Assert::AreEqual(missCount + 1, loader.GetMissCount());
+
+            // Resources larger than the whole cache are returned but not kept
+            resolver->Add("mem:large", std::string(10000, 'x'));
+            loader.Load("mem:large", recorder.GetCallback());
+            Assert::IsTrue(recorder.results.back().status == ResourceLoadStatus::Loaded);
+            Assert::AreEqual(static_cast<size_t>(2), loader.GetEntryCount());
+        }
+
+        TEST_METHOD(FailureTest)
+        {
+            auto resolver = std::make_shared<StubResourceResolver>();
+            ResourceLoader loader(1024);
+            loader.SetResolver("stub", resolver);
+
+            LoadRecorder recorder;
+            loader.Load("http://adaptivecards.io/image.png", recorder.GetCallback());
+            loader.Load("no scheme", recorder.GetCallback());
+            Assert::IsTrue(recorder.results[0].status == ResourceLoadStatus::UnsupportedScheme);
+            Assert::IsTrue(recorder.results[1].status == ResourceLoadStatus::UnsupportedScheme);
+
+            // Failures are not cached
+            loader.Load("stub:a", recorder.GetCallback());
+            resolver->callbacks[0](ResourceLoadResult("stub:a", ResourceLoadStatus::Failed, "offline"));
+            Assert::AreEqual(std::string("offline"), recorder.results[2].error);
+            loader.Load("stub:a", recorder.GetCallback());
+            Assert::AreEqual(static_cast<size_t>(2), resolver->uris.size());
+
+            // Nor is a load that claims success without content
+            resolver->callbacks[1](ResourceLoadResult("stub:a", nullptr));
+            Assert::IsTrue(recorder.results[3].status == ResourceLoadStatus::Failed);
+            Assert::AreEqual(static_cast<size_t>(0), loader.GetEntryCount());
+
+            // Unregistered schemes are no longer resolved
+            loader.SetResolver("stub", nullptr);
+            loader.Load("stub:a", recorder.GetCallback());
+            Assert::IsTrue(recorder.results[4].status == ResourceLoadStatus::UnsupportedScheme);
+        }
+
+        TEST_METHOD(FileTest)
+        {
+            Assert::AreEqual(std::string("file"), ResourceLoader::GetScheme("FILE:///tmp/a.png"));
+            Assert::AreEqual(std::string("ms-appx"), ResourceLoader::GetScheme("ms-appx:///a.png"));
+            Assert::AreEqual(std::string(""), ResourceLoader::GetScheme("/tmp/a.png"));
+
+            Assert::AreEqual(std::string("/tmp/a b.png"), FileResourceResolver::GetPath("file:///tmp/a%20b.png"));
+            Assert::AreEqual(std::string("/tmp/a.png"), FileResourceResolver::GetPath("file://localhost/tmp/a.png"));
+            Assert::AreEqual(std::string("/tmp/a.png"), FileResourceResolver::GetPath("file:/tmp/a.png"));
+            Assert::AreEqual(std::string(""), FileResourceResolver::GetPath("file://server/tmp/a.png"));
+            Assert::AreEqual(std::string(""), FileResourceResolver::GetPath("http://adaptivecards.io/a.png"));
+
+            ResourceLoader loader(1024);
+            LoadRecorder recorder;
+            loader.Load("file:///AdaptiveCardsResourceLoaderTest/missing.png", recorder.GetCallback());
+            Assert::IsTrue(recorder.results[0].status == ResourceLoadStatus::NotFound);
+        }
+
+        TEST_METHOD(DiskCacheTest)
+        {
+            const std::string uri = "stub:disk";
+            auto resolver = std::make_shared<StubResourceResolver>();
+            TemporaryDirectory directory;
+            {
+                ResourceLoader loader(1024);
+                loader.SetResolver("stub", resolver);
+                loader.SetDiskCache(directory.GetPath(), 1024);
+
+                LoadRecorder recorder;
+                loader.Load(uri, recorder.GetCallback());
+                resolver->Complete(0, std::string("disk\ncontent", 12));
+                Assert::AreEqual(uri.size() + 1 + 12, loader.GetDiskSizeInBytes());
+            }
+
+            // Another loader finds it there without resolving it
+            ResourceLoader loader(1024);
+            loader.SetResolver("stub", resolver);
+            loader.SetDiskCache(directory.GetPath(), 1024);
+            LoadRecorder recorder;
+            loader.Load(uri, recorder.GetCallback());
+            Assert::AreEqual(static_cast<size_t>(1), resolver->uris.size());
+            Assert::AreEqual(std::string("disk\ncontent", 12), *recorder.results[0].content);
+            Assert::AreEqual(1ULL, loader.GetHitCount());
+        }
+
+        TEST_METHOD(CardTest)
+        {
+            auto resolver = std::make_shared<MemoryResourceResolver>();
+            resolver->Add("mem:background", "background");
+            resolver->Add("mem:image", "image");
+            ResourceLoader loader(1024);
+            loader.SetResolver("mem", resolver);
+
+            auto card = AdaptiveCard::DeserializeFromString(
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"backgroundImage\": \"mem:background\", \"body\": ["
+                "  { \"type\": \"Image\", \"url\": \"mem:image\" }, { \"type\": \"Image\", \"url\": \"mem:image\" } ] }", 1.0)->GetAdaptiveCard();
+
+            // Each resource once
+            LoadRecorder recorder;
+            loader.Load(*card, recorder.GetCallback());
+            Assert::AreEqual(static_cast<size_t>(2), recorder.results.size());
+            Assert::AreEqual(std::string("mem:background"), recorder.results[0].uri);
+            Assert::AreEqual(std::string("mem:image"), recorder.results[1].uri);
+        }
+    };
+}
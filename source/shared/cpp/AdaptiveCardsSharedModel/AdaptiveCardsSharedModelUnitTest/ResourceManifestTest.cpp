@@ -0,0 +1,129 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "HostConfig.h"
+#include "ResourceManifest.h"
+#include "ShowCardAction.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static const std::string ManifestCardJson =
+        "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"backgroundImage\": \"http://adaptivecards.io/background.png\", \"body\": ["
+        "  { \"type\": \"Image\", \"url\": \"http://adaptivecards.io/hero.png\", \"size\": \"medium\" },"
+        "  { \"type\": \"ImageSet\", \"imageSize\": \"small\", \"images\": ["
+        "    { \"type\": \"Image\", \"url\": \"http://adaptivecards.io/member.png\" },"
+        "    { \"type\": \"Image\", \"url\": \"http://adaptivecards.io/hero.png\" } ] },"
+        "  { \"type\": \"Image\", \"url\": \"http://adaptivecards.io/auto.png\" },"
+        "  { \"type\": \"Image\", \"url\": \"http://adaptivecards.io/explicit.png\", \"width\": \"10px\", \"height\": \"50px\" } ],"
+        "  \"actions\": ["
+        "    { \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"iconUrl\": \"http://adaptivecards.io/show.png\", \"card\": {"
+        "      \"type\": \"AdaptiveCard\", \"body\": [ { \"type\": \"Image\", \"url\": \"http://adaptivecards.io/shown.png\" } ] } },"
+        "    { \"type\": \"Action.Submit\", \"title\": \"Submit\", \"iconUrl\": \"http://adaptivecards.io/submit.png\" },"
+        "    { \"type\": \"Action.OpenUrl\", \"title\": \"Open\", \"url\": \"http://adaptivecards.io\", \"iconUrl\": \"http://adaptivecards.io/open.png\" } ] }";
+
+    static std::string JoinUris(const std::vector<ResourceEntry>& resources)
+    {
+        std::string uris;
+        for (const auto& resource : resources)
+        {
+            // Without the common prefix and extension
+            const std::string name = resource.uri.substr(std::string("http://adaptivecards.io/").size());
+            uris += (uris.empty() ? "" : " ") + name.substr(0, name.size() - 4);
+        }
+        return uris;
+    }
+
+    static HostConfig GetTwoActionHostConfig()
+    {
+        HostConfig hostConfig;
+        hostConfig.actions.maxActions = 2;
+        return hostConfig;
+    }
+
+    TEST_CLASS(ResourceManifestTest)
+    {
+    public:
+        TEST_METHOD(KindAndSizeTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(ManifestCardJson, 1.0)->GetAdaptiveCard();
+            ResourceManifest manifest = card->GetResourceManifest(GetTwoActionHostConfig());
+
+            // Each resource once, in document order
+            Assert::AreEqual(std::string("background hero member auto explicit show shown submit open"), JoinUris(manifest.GetResources()));
+
+            const ResourceEntry* background = manifest.Find("http://adaptivecards.io/background.png");
+            Assert::IsTrue(background->kind == ResourceKind::Background);
+            Assert::AreEqual(0U, background->pixelWidth);
+
+            // Used at medium on its own and small in the set, so needed at the larger of the two
+            const ResourceEntry* hero = manifest.Find("http://adaptivecards.io/hero.png");
+            Assert::IsTrue(hero->kind == ResourceKind::Image);
+            Assert::AreEqual(2U, hero->useCount);
+            Assert::AreEqual(120U, hero->pixelWidth);
+            Assert::AreEqual(120U, hero->pixelHeight);
+
+            const ResourceEntry* member = manifest.Find("http://adaptivecards.io/member.png");
+            Assert::IsTrue(member->kind == ResourceKind::ImageSetImage);
+            Assert::AreEqual(80U, member->pixelWidth);
+            Assert::AreEqual(80U, member->pixelHeight);
+
+            const ResourceEntry* autoSized = manifest.Find("http://adaptivecards.io/auto.png");
+            Assert::AreEqual(0U, autoSized->pixelWidth);
+            Assert::AreEqual(0U, autoSized->pixelHeight);
+
+            const ResourceEntry* explicitSized = manifest.Find("http://adaptivecards.io/explicit.png");
+            Assert::AreEqual(10U, explicitSized->pixelWidth);
+            Assert::AreEqual(50U, explicitSized->pixelHeight);
+
+            Assert::IsTrue(manifest.Find("http://adaptivecards.io/submit.png")->kind == ResourceKind::Icon);
+            Assert::IsTrue(manifest.Find("http://adaptivecards.io/shown.png")->kind == ResourceKind::Image);
+            Assert::IsTrue(manifest.Find("http://adaptivecards.io/missing.png") == nullptr);
+
+            // The set caps its images at maxImageHeight
+            HostConfig hostConfig;
+            hostConfig.imageSet.maxImageHeight = 60;
+            manifest = card->GetResourceManifest(hostConfig);
+            Assert::AreEqual(60U, manifest.Find("http://adaptivecards.io/member.png")->pixelHeight);
+        }
+
+        TEST_METHOD(PriorityTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(ManifestCardJson, 1.0)->GetAdaptiveCard();
+            ResourceManifest manifest = card->GetResourceManifest(GetTwoActionHostConfig());
+
+            // The card of the Action.ShowCard and the icon of the action past maxActions come last
+            Assert::AreEqual(std::string("background hero member auto explicit show submit shown open"), JoinUris(manifest.GetResourcesByPriority()));
+            Assert::IsTrue(manifest.Find("http://adaptivecards.io/show.png")->isInitiallyVisible);
+            Assert::IsFalse(manifest.Find("http://adaptivecards.io/shown.png")->isInitiallyVisible);
+            Assert::IsFalse(manifest.Find("http://adaptivecards.io/open.png")->isInitiallyVisible);
+
+            // Without interactivity no action is shown
+            HostConfig hostConfig;
+            hostConfig.supportsInteractivity = false;
+            manifest = card->GetResourceManifest(hostConfig);
+            Assert::AreEqual(std::string("background hero member auto explicit show shown submit open"), JoinUris(manifest.GetResourcesByPriority()));
+            Assert::IsFalse(manifest.Find("http://adaptivecards.io/show.png")->isInitiallyVisible);
+        }
+
+        TEST_METHOD(DeferredShowCardTest)
+        {
+            auto actionParserRegistration = std::make_shared<ActionParserRegistration>();
+            actionParserRegistration->SetShowCardParsingDeferred(true);
+            auto card = AdaptiveCard::DeserializeFromString(ManifestCardJson, 1.0, nullptr, actionParserRegistration)->GetAdaptiveCard();
+            ResourceManifest manifest = card->GetResourceManifest(GetTwoActionHostConfig());
+
+            // The card is read from its JSON rather than parsed
+            Assert::IsTrue(std::static_pointer_cast<ShowCardAction>(card->GetActions()[0])->IsCardDeferred());
+            const ResourceEntry* shown = manifest.Find("http://adaptivecards.io/shown.png");
+            Assert::IsTrue(shown->kind == ResourceKind::Other);
+            Assert::IsFalse(shown->isInitiallyVisible);
+
+            // GetResourceUris is unchanged, with hero twice and without the icons
+            Assert::AreEqual(static_cast<size_t>(7), card->GetResourceUris().size());
+        }
+    };
+}
@@ -0,0 +1,68 @@
+#include "stdafx.h"
+#include "SampleFiles.h"
+#include <Windows.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        // This file is at source/shared/cpp/AdaptiveCardsSharedModel/AdaptiveCardsSharedModelUnitTest
+        // under the repository root, which holds the samples directory
+        std::string GetSamplesDirectory()
+        {
+            std::string path = __FILE__;
+            for (int i = 0; i < 6; ++i)
+            {
+                path = path.substr(0, path.find_last_of("\\/"));
+            }
+            return path + "/samples";
+        }
+
+        void AddSampleFilePaths(const std::string& directory, std::vector<std::string>& paths)
+        {
+            WIN32_FIND_DATAA findData;
+            HANDLE findHandle = FindFirstFileA((directory + "/*").c_str(), &findData);
+            if (findHandle == INVALID_HANDLE_VALUE)
+            {
+                return;
+            }
+
+            do
+            {
+                const std::string name = findData.cFileName;
+                if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+                {
+                    if (name != "." && name != "..")
+                    {
+                        AddSampleFilePaths(directory + "/" + name, paths);
+                    }
+                }
+                else if (name.size() > 5 && name.compare(name.size() - 5, 5, ".json") == 0)
+                {
+                    paths.push_back(directory + "/" + name);
+                }
+            } while (FindNextFileA(findHandle, &findData));
+
+            FindClose(findHandle);
+        }
+    }
+
+    std::vector<std::string> GetSampleFilePaths()
+    {
+        std::vector<std::string> paths;
+        AddSampleFilePaths(GetSamplesDirectory(), paths);
+        std::sort(paths.begin(), paths.end());
+        return paths;
+    }
+
+    std::string ReadSampleFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Paths of every .json file under the repository's samples directory, sorted
+    std::vector<std::string> GetSampleFilePaths();
+
+    std::string ReadSampleFile(const std::string& path);
+}
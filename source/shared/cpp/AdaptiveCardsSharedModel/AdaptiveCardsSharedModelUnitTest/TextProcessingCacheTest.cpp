@@ -0,0 +1,82 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "TextProcessingCache.h"
+#include "MarkDownParser.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static std::string FormatDatesAsX(const DateTimePreparser& preparser)
+    {
+        std::string formatted;
+        for (const auto& token : preparser.GetTextTokens())
+        {
+            formatted += (token->GetFormat() == DateTimePreparsedTokenFormat::RegularString) ? token->GetText() : "X";
+        }
+        return formatted;
+    }
+
+    TEST_CLASS(TextProcessingCacheTest)
+    {
+    public:
+        TEST_METHOD(HitsAndMisses)
+        {
+            TextProcessingCache cache(64 * 1024);
+
+            auto html = cache.TransformToHtml("Some **bold** text", "en", 0, FormatDatesAsX);
+            Assert::AreEqual(MarkDownParser("Some **bold** text").TransformToHtml(), *html);
+            Assert::AreEqual(0ull, cache.GetHitCount());
+            Assert::AreEqual(1ull, cache.GetMissCount());
+
+            // the same text is processed once and shares its result
+            auto cachedHtml = cache.TransformToHtml("Some **bold** text", "en", 0, FormatDatesAsX);
+            Assert::IsTrue(html == cachedHtml);
+            Assert::AreEqual(1ull, cache.GetHitCount());
+
+            // a different language, options hash or output is processed again
+            cache.TransformToHtml("Some **bold** text", "fr", 0, FormatDatesAsX);
+            cache.TransformToHtml("Some **bold** text", "en", 1, FormatDatesAsX);
+            cache.TransformToBlocks("Some **bold** text", "en", 0, FormatDatesAsX);
+            Assert::AreEqual(1ull, cache.GetHitCount());
+            Assert::AreEqual(4ull, cache.GetMissCount());
+            Assert::AreEqual(static_cast<size_t>(4), cache.GetEntryCount());
+
+            cache.Clear();
+            Assert::AreEqual(static_cast<size_t>(0), cache.GetEntryCount());
+            Assert::AreEqual(static_cast<size_t>(0), cache.GetSizeInBytes());
+        }
+
+        TEST_METHOD(FormatsDates)
+        {
+            TextProcessingCache cache(64 * 1024);
+
+            auto html = cache.TransformToHtml("Due *{{DATE(2017-02-14T06:08:39Z, SHORT)}}*", "en", 0, FormatDatesAsX);
+            Assert::AreEqual<string>("<p>Due <em>X</em></p>", *html);
+
+            auto blocks = cache.TransformToBlocks("Due {{DATE(2017-02-14T06:08:39Z, SHORT)}}", "en", 0, FormatDatesAsX);
+            Assert::AreEqual(static_cast<size_t>(1), blocks->size());
+            Assert::AreEqual<string>("Due X", (*blocks)[0].runs[0].text);
+        }
+
+        TEST_METHOD(EvictsLeastRecentlyUsed)
+        {
+            TextProcessingCache cache(1024);
+
+            // the cache holds only a few entries, so processing many evicts the oldest
+            for (int i = 0; i < 100; ++i)
+            {
+                cache.TransformToHtml("Text " + std::to_string(i), "", 0, FormatDatesAsX);
+            }
+            Assert::IsTrue(cache.GetEvictionCount() > 0);
+            Assert::IsTrue(cache.GetSizeInBytes() <= cache.GetCapacityInBytes());
+
+            cache.TransformToHtml("Text 99", "", 0, FormatDatesAsX);
+            Assert::AreEqual(1ull, cache.GetHitCount());
+            cache.TransformToHtml("Text 0", "", 0, FormatDatesAsX);
+            Assert::AreEqual(1ull, cache.GetHitCount());
+        }
+    };
+}
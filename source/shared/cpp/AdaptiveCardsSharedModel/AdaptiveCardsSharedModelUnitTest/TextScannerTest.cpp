@@ -0,0 +1,78 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "TextScanner.h"
+#include "MarkDownParser.h"
+#include "DateTimePreparser.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static bool IsContentType(const std::string& text, TextContentType contentType)
+    {
+        return TextScanner::Scan(text).contentType == contentType;
+    }
+
+    TEST_CLASS(TextScannerTest)
+    {
+    public:
+        TEST_METHOD(ContentType)
+        {
+            Assert::IsTrue(IsContentType("", TextContentType::PlainText));
+            Assert::IsTrue(IsContentType("Total: 5 items (3 shipped) - 2018.", TextContentType::PlainText));
+            Assert::IsTrue(IsContentType("Meet {at} {noon}", TextContentType::PlainText));
+            Assert::IsTrue(IsContentType("Some **bold** text", TextContentType::MarkDown));
+            Assert::IsTrue(IsContentType("Due {{DATE(2017-02-14T06:08:39Z, SHORT)}}", TextContentType::DateTime));
+            Assert::IsTrue(IsContentType("_Due_ {{TIME(2017-02-14T06:08:39Z)}}", TextContentType::MarkDownAndDateTime));
+
+            // text longer than a vector, with markdown past the first one
+            Assert::IsTrue(IsContentType("A long line of plain text that runs past thirty two chars", TextContentType::PlainText));
+            Assert::IsTrue(IsContentType("A long line of plain text that runs past thirty two chars, then *ends*", TextContentType::MarkDown));
+        }
+
+        TEST_METHOD(ListItems)
+        {
+            // lists start only where the markdown parser starts a block
+            Assert::IsTrue(IsContentType("- item", TextContentType::MarkDown));
+            Assert::IsTrue(IsContentType("12. item", TextContentType::MarkDown));
+            Assert::IsTrue(IsContentType("-5. item", TextContentType::MarkDown));
+            Assert::IsTrue(IsContentType("(see below)1. item", TextContentType::MarkDown));
+            Assert::IsTrue(IsContentType("a - b", TextContentType::PlainText));
+            Assert::IsTrue(IsContentType("version 1. 2", TextContentType::PlainText));
+            Assert::IsTrue(IsContentType("12.5 items", TextContentType::PlainText));
+            Assert::IsTrue(IsContentType("(a) -b", TextContentType::PlainText));
+        }
+
+        TEST_METHOD(EscapedLength)
+        {
+            const std::string text = "\"Green\" eggs & <ham>, with a line long enough for a vector";
+            const TextScanResult result = TextScanner::Scan(text);
+
+            std::string escaped;
+            TextScanner::AppendEscapedText(text, escaped);
+            Assert::AreEqual<string>("&quot;Green&quot; eggs &amp; &lt;ham&gt;, with a line long enough for a vector", escaped);
+            Assert::AreEqual(escaped.size(), result.escapedLength);
+        }
+
+        TEST_METHOD(PlainTextHtml)
+        {
+            MarkDownParser parser("3 < 5 & (4) - 2");
+            Assert::AreEqual<string>("<p>3 &lt; 5 &amp; (4) - 2</p>", parser.TransformToHtml());
+
+            auto blocks = MarkDownParser("3 < 5").TransformToBlocks();
+            Assert::AreEqual(static_cast<size_t>(1), blocks.size());
+            Assert::AreEqual(static_cast<size_t>(1), blocks[0].runs.size());
+            Assert::AreEqual<string>("3 < 5", blocks[0].runs[0].text);
+        }
+
+        TEST_METHOD(PlainTextDates)
+        {
+            DateTimePreparser preparser("No dates {here}");
+            Assert::IsFalse(preparser.HasDateTokens());
+            Assert::AreEqual(static_cast<size_t>(1), preparser.GetTextTokens().size());
+            Assert::AreEqual<string>("No dates {here}", preparser.GetTextTokens()[0]->GetText());
+        }
+    };
+}
@@ -0,0 +1,157 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "BaseCardElement.h"
+#include "UnknownElement.h"
+#include "SampleFiles.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    static std::string DescribeParseResult(const std::shared_ptr<ParseResult>& parseResult)
+    {
+        std::string description = parseResult->GetAdaptiveCard()->Serialize();
+        for (const auto& warning : parseResult->GetWarnings())
+        {
+            description += std::to_string(static_cast<int>(warning->GetStatusCode())) + " " + warning->GetReason() + "\n";
+        }
+        return description;
+    }
+
+    // Deserializes the payload both from a Json::Value of the whole card and split into top-level
+    // spans, and checks that they agree on the resulting card, the warnings, or the error
+    static void VerifySpansMatchDom(
+        const std::string& json,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr)
+    {
+        std::string domResult;
+        std::string spansResult;
+
+        try
+        {
+            auto parseResult = AdaptiveCard::DeserializeFromString(json, 1.0, elementParserRegistration);
+            domResult = DescribeParseResult(parseResult);
+        }
+        catch (const AdaptiveCardParseException& e)
+        {
+            domResult = "error " + std::to_string(static_cast<int>(e.GetStatusCode())) + " " + e.GetReason();
+        }
+
+        try
+        {
+            auto parseResult = AdaptiveCard::DeserializeFromStringByTopLevelSpans(json, 1.0, elementParserRegistration);
+            spansResult = DescribeParseResult(parseResult);
+        }
+        catch (const AdaptiveCardParseException& e)
+        {
+            spansResult = "error " + std::to_string(static_cast<int>(e.GetStatusCode())) + " " + e.GetReason();
+        }
+
+        Assert::AreEqual(domResult, spansResult);
+    }
+
+    class TestCustomElement : public BaseCardElement
+    {
+    public:
+        TestCustomElement() : BaseCardElement(CardElementType::Custom) {}
+    };
+
+    class TestCustomParser : public BaseCardElementParser
+    {
+    public:
+        std::shared_ptr<BaseCardElement> Deserialize(
+            std::shared_ptr<ElementParserRegistration>,
+            std::shared_ptr<ActionParserRegistration>,
+            const Json::Value& value) override
+        {
+            auto element = BaseCardElement::Deserialize<TestCustomElement>(value);
+            element->SetId(value.get("payload", Json::Value()).toStyledString());
+            return element;
+        }
+    };
+
+    TEST_CLASS(TopLevelSpanDeserializationTest)
+    {
+    public:
+        TEST_METHOD(NestedCardTest)
+        {
+            VerifySpansMatchDom(
+            "{\
+                \"type\": \"AdaptiveCard\",\
+                \"version\": \"1.0\",\
+                \"speak\": \"Hello\",\
+                \"backgroundImage\": \"background.png\",\
+                \"selectAction\": { \"type\": \"Action.OpenUrl\", \"url\": \"http://adaptivecards.io\" },\
+                \"body\": [\
+                    { \"type\": \"TextBlock\", \"text\": \"Text \\\"quoted\\\" \\u00e9\", \"size\": \"large\", \"unknown\": [1, 2.5, -3e2] },\
+                    { \"type\": \"Container\", \"items\": [ { \"type\": \"Image\", \"url\": \"image.png\" } ] },\
+                    { \"type\": \"ColumnSet\", \"columns\": [ { \"type\": \"Column\", \"items\": [] } ] },\
+                    { \"type\": \"Random\", \"payload\": { \"nested\": [ {}, [], null, true, false ] } }\
+                ],\
+                \"actions\": [\
+                    { \"type\": \"Action.Submit\", \"title\": \"Submit\", \"data\": { \"x\": 13 } },\
+                    { \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": { \"type\": \"AdaptiveCard\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"Inner\" } ] } },\
+                    { \"type\": \"Action.Unsupported\" }\
+                ],\
+                \"lang\": \"fr\"\
+            }");
+        }
+
+        TEST_METHOD(CommentsAndWhitespaceTest)
+        {
+            VerifySpansMatchDom(
+                "  /* leading */ { \"type\" : \"AdaptiveCard\", // trailing\n"
+                " \"version\":\"1.0\" , \"body\" : [ /* inline */ { \"type\":\"TextBlock\", \"text\":\"a\" } ] } ");
+        }
+
+        TEST_METHOD(RepeatedAndNonArrayCollectionsTest)
+        {
+            VerifySpansMatchDom("{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"first\" } ], \"body\": [ { \"type\": \"TextBlock\", \"text\": \"second\" } ] }");
+            VerifySpansMatchDom("{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"first\" } ], \"body\": null }");
+            VerifySpansMatchDom("{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": {} }");
+            VerifySpansMatchDom("{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": \"text\" }");
+            VerifySpansMatchDom("{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"actions\": { \"type\": \"Action.Submit\" } }");
+        }
+
+        TEST_METHOD(CardLevelErrorsTest)
+        {
+            VerifySpansMatchDom("{ \"type\": \"AdaptiveCard\", \"version\": \"2.0\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"a\" } ] }");
+            VerifySpansMatchDom("{ \"type\": \"AdaptiveCard\", \"version\": \"abc\" }");
+            VerifySpansMatchDom("{ \"type\": \"Container\", \"version\": \"1.0\" }");
+            VerifySpansMatchDom("[ { \"type\": \"AdaptiveCard\" } ]");
+        }
+
+        TEST_METHOD(MalformedJsonTest)
+        {
+            VerifySpansMatchDom("");
+            VerifySpansMatchDom("{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"TextBlock\" ");
+            VerifySpansMatchDom("{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"TextBlock\" } } ");
+            VerifySpansMatchDom("{ \"type\": \"AdaptiveCard\" \"version\": \"1.0\" }");
+            VerifySpansMatchDom("{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"TextBlock\", \"text\": tru } ] }");
+        }
+
+        TEST_METHOD(SamplesTest)
+        {
+            std::vector<std::string> sampleFilePaths = GetSampleFilePaths();
+            Assert::IsFalse(sampleFilePaths.empty());
+
+            for (const auto& path : sampleFilePaths)
+            {
+                VerifySpansMatchDom(ReadSampleFile(path));
+            }
+        }
+
+        TEST_METHOD(CustomParserTest)
+        {
+            auto elementParserRegistration = std::make_shared<ElementParserRegistration>();
+            elementParserRegistration->AddParser("CustomType", std::make_shared<TestCustomParser>());
+
+            VerifySpansMatchDom(
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"CustomType\", \"payload\": { \"a\": [1, 2] } } ] }",
+                elementParserRegistration);
+        }
+    };
+}
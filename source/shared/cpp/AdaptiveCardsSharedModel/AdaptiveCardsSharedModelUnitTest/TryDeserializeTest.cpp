@@ -0,0 +1,119 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    class ThrowingCustomParser : public BaseCardElementParser
+    {
+    public:
+        std::shared_ptr<BaseCardElement> Deserialize(
+            std::shared_ptr<ElementParserRegistration>,
+            std::shared_ptr<ActionParserRegistration>,
+            const Json::Value&) override
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "custom failure");
+        }
+    };
+
+    TEST_CLASS(TryDeserializeTest)
+    {
+    public:
+        TEST_METHOD(ValidCardTest)
+        {
+            std::string testJsonString =
+            "{\
+                \"type\": \"AdaptiveCard\",\
+                \"version\": \"1.0\",\
+                \"body\": [ { \"type\": \"Container\", \"items\": [ { \"type\": \"TextBlock\", \"text\": \"Hello\" } ] } ],\
+                \"actions\": [ { \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": { \"type\": \"AdaptiveCard\", \"body\": [] } } ]\
+            }";
+
+            auto result = AdaptiveCard::TryDeserializeFromString(testJsonString, 1.0);
+            Assert::IsTrue(result->GetError() == nullptr);
+            Assert::IsTrue(result->GetAdaptiveCard() != nullptr);
+            Assert::AreEqual(AdaptiveCard::DeserializeFromString(testJsonString, 1.0)->GetAdaptiveCard()->Serialize(), result->GetAdaptiveCard()->Serialize());
+        }
+
+        TEST_METHOD(ErrorResultTest)
+        {
+            struct InvalidCard
+            {
+                std::string json;
+                ErrorStatusCode statusCode;
+                std::string jsonPath;
+            };
+
+            const std::vector<InvalidCard> invalidCards =
+            {
+                { "{ \"type\": \"AdaptiveCard\", ", ErrorStatusCode::InvalidJson, "$" },
+                { "[]", ErrorStatusCode::InvalidJson, "$" },
+                { "{ \"type\": \"Container\", \"version\": \"1.0\" }", ErrorStatusCode::InvalidPropertyValue, "$" },
+                { "{ \"type\": \"AdaptiveCard\", \"version\": \"one\" }", ErrorStatusCode::InvalidPropertyValue, "$.version" },
+                { "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": { \"type\": \"TextBlock\" } }", ErrorStatusCode::InvalidPropertyValue, "$.body" },
+                { "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ 5 ] }", ErrorStatusCode::RequiredPropertyMissing, "$.body[0]" },
+                { "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": [] } ] }", ErrorStatusCode::InvalidPropertyValue, "$.body[0]" },
+                { "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"a\" }, { \"type\": \"Image\" } ] }",
+                    ErrorStatusCode::RequiredPropertyMissing, "$.body[1].url" },
+                { "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"Container\", \"items\": [ { \"type\": \"TextBlock\", \"text\": \"a\" }, { \"type\": \"TextBlock\", \"text\": \"b\", \"wrap\": \"yes\" } ] } ] }",
+                    ErrorStatusCode::InvalidPropertyValue, "$.body[0].items[1].wrap" },
+                { "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"ColumnSet\", \"columns\": [ { \"type\": \"Column\", \"width\": \"10pxs\" } ] } ] }",
+                    ErrorStatusCode::InvalidPropertyValue, "$.body[0].columns[0].width" },
+                { "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"Image\", \"url\": \"a.png\", \"width\": \"10cm\" } ] }",
+                    ErrorStatusCode::InvalidPropertyValue, "$.body[0]" },
+                { "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"selectAction\": { \"type\": \"Action.Submit\" } }",
+                    ErrorStatusCode::RequiredPropertyMissing, "$.selectAction.title" },
+                { "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"actions\": [ { \"type\": \"Action.ShowCard\", \"title\": \"Show\", \"card\": { \"type\": \"AdaptiveCard\", \"body\": [ { \"type\": \"Image\" } ] } } ] }",
+                    ErrorStatusCode::RequiredPropertyMissing, "$.actions[0].card.body[0].url" },
+            };
+
+            for (const auto& invalidCard : invalidCards)
+            {
+                auto result = AdaptiveCard::TryDeserializeFromString(invalidCard.json, 1.0);
+                Assert::IsTrue(result->GetAdaptiveCard() == nullptr);
+
+                auto error = result->GetError();
+                Assert::IsTrue(error != nullptr);
+                Assert::IsTrue(invalidCard.statusCode == error->GetStatusCode());
+                Assert::AreEqual(invalidCard.jsonPath, error->GetJsonPath());
+
+                // The throwing API reports the same error
+                try
+                {
+                    AdaptiveCard::DeserializeFromString(invalidCard.json, 1.0);
+                    Assert::Fail();
+                }
+                catch (const AdaptiveCardParseException& e)
+                {
+                    Assert::IsTrue(error->GetStatusCode() == e.GetStatusCode());
+                    Assert::AreEqual(error->GetReason(), e.GetReason());
+                }
+            }
+        }
+
+        TEST_METHOD(CustomParserExceptionTest)
+        {
+            auto elementParserRegistration = std::make_shared<ElementParserRegistration>();
+            elementParserRegistration->AddParser("Throwing", std::make_shared<ThrowingCustomParser>());
+
+            auto result = AdaptiveCard::TryDeserializeFromString(
+                "{ \"type\": \"AdaptiveCard\", \"version\": \"1.0\", \"body\": [ { \"type\": \"Throwing\" } ] }", 1.0, elementParserRegistration);
+
+            Assert::IsTrue(result->GetAdaptiveCard() == nullptr);
+            Assert::IsTrue(result->GetError() != nullptr);
+            Assert::IsTrue(ErrorStatusCode::InvalidPropertyValue == result->GetError()->GetStatusCode());
+            Assert::AreEqual(std::string("custom failure"), result->GetError()->GetReason());
+        }
+
+        TEST_METHOD(ParsersOutsideScopeStillThrowTest)
+        {
+            Assert::ExpectException<AdaptiveCardParseException>([]() {
+                TextBlockParser().DeserializeFromString(nullptr, nullptr, "{ \"type\": \"TextBlock\", \"wrap\": 5 }"); });
+        }
+    };
+}
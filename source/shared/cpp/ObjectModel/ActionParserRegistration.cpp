@@ -5,51 +5,99 @@
 #include "SubmitAction.h"
 
 AdaptiveSharedNamespaceStart
-    ActionParserRegistration::ActionParserRegistration()
+    ActionParserRegistration::ActionParserRegistration() :
+        m_isReadOnly(false),
+        m_isShowCardParsingDeferred(false),
+        m_generation(0)
     {
-        m_knownElements.insert({
-            ActionTypeToString(ActionType::OpenUrl),
-            ActionTypeToString(ActionType::ShowCard),
-            ActionTypeToString(ActionType::Submit),
-        });
+    }
+
+    std::shared_ptr<ActionParserRegistration> ActionParserRegistration::GetDefault()
+    {
+        static const std::shared_ptr<ActionParserRegistration> defaultRegistration = []()
+        {
+            auto registration = std::make_shared<ActionParserRegistration>();
+            registration->m_isReadOnly = true;
+            return registration;
+        }();
+        return defaultRegistration;
+    }
 
-        m_cardElementParsers.insert({
+    const ActionParserRegistration::ParserMap& ActionParserRegistration::GetKnownParsers()
+    {
+        static const ParserMap knownParsers =
+        {
             { ActionTypeToString(ActionType::OpenUrl), std::make_shared<OpenUrlActionParser>() },
             { ActionTypeToString(ActionType::ShowCard), std::make_shared<ShowCardActionParser>() },
             { ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>() }
-        });
+        };
+        return knownParsers;
     }
 
-    void ActionParserRegistration::AddParser(std::string elementType, std::shared_ptr<ActionElementParser> parser)
+    void ActionParserRegistration::ThrowIfKnownOrReadOnly(const std::string& elementType) const
     {
-        if (m_knownElements.find(elementType) == m_knownElements.end())
+        if (GetKnownParsers().find(elementType) != GetKnownParsers().end())
         {
-            ActionParserRegistration::m_cardElementParsers[elementType] = parser;
+            throw AdaptiveCardParseException(ErrorStatusCode::UnsupportedParserOverride, "Overriding known action parsers is unsupported");
         }
-        else
+
+        if (m_isReadOnly)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::UnsupportedParserOverride, "Overriding known action parsers is unsupported");
+            throw AdaptiveCardParseException(ErrorStatusCode::UnsupportedParserOverride, "The default action parser registration cannot be modified");
         }
     }
 
+    void ActionParserRegistration::AddParser(std::string elementType, std::shared_ptr<ActionElementParser> parser)
+    {
+        ThrowIfKnownOrReadOnly(elementType);
+        m_cardElementParsers[elementType] = parser;
+        ++m_generation;
+    }
+
     void ActionParserRegistration::RemoveParser(std::string elementType)
     {
-        if (m_knownElements.find(elementType) == m_knownElements.end())
-        {
-            ActionParserRegistration::m_cardElementParsers.erase(elementType);
-        }
-        else
+        ThrowIfKnownOrReadOnly(elementType);
+        m_cardElementParsers.erase(elementType);
+        ++m_generation;
+    }
+
+    bool ActionParserRegistration::IsKnownType(const std::string& elementType)
+    {
+        return GetKnownParsers().find(elementType) != GetKnownParsers().end();
+    }
+
+    unsigned long long ActionParserRegistration::GetGeneration() const
+    {
+        return m_generation;
+    }
+
+    void ActionParserRegistration::SetShowCardParsingDeferred(bool isDeferred)
+    {
+        if (m_isReadOnly)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::UnsupportedParserOverride, "Overriding known action parsers is unsupported");
+            throw AdaptiveCardParseException(ErrorStatusCode::UnsupportedParserOverride, "The default action parser registration cannot be modified");
         }
+        m_isShowCardParsingDeferred = isDeferred;
+        ++m_generation;
+    }
+
+    bool ActionParserRegistration::IsShowCardParsingDeferred() const
+    {
+        return m_isShowCardParsingDeferred;
     }
 
-    std::shared_ptr<ActionElementParser> ActionParserRegistration::GetParser(std::string elementType)
+    std::shared_ptr<ActionElementParser> ActionParserRegistration::GetParser(const std::string& elementType) const
     {
+        auto knownParser = GetKnownParsers().find(elementType);
+        if (knownParser != GetKnownParsers().end())
+        {
+            return knownParser->second;
+        }
+
         auto parser = m_cardElementParsers.find(elementType);
-        if (parser != ActionParserRegistration::m_cardElementParsers.end())
+        if (parser != m_cardElementParsers.end())
         {
-            return parser->second; 
+            return parser->second;
         }
         else
         {
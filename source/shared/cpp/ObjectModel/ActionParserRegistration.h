@@ -22,14 +22,39 @@ AdaptiveSharedNamespaceStart
     {
     public:
 
+        // Starts out with only the built-in parsers. The built-in table is shared by every
+        // registration, so construction is cheap and only custom parsers are stored per instance.
         ActionParserRegistration();
 
+        // Process-wide registration with only the built-in parsers, used when callers don't
+        // supply one. It is shared across threads, so AddParser and RemoveParser on it throw.
+        static std::shared_ptr<ActionParserRegistration> GetDefault();
+
         void AddParser(std::string elementType, std::shared_ptr<AdaptiveSharedNamespace::ActionElementParser> parser);
         void RemoveParser(std::string elementType);
-        std::shared_ptr<AdaptiveSharedNamespace::ActionElementParser> GetParser(std::string elementType);
+        std::shared_ptr<AdaptiveSharedNamespace::ActionElementParser> GetParser(const std::string& elementType) const;
+
+        // True for the built-in action types, whose parsers cannot be replaced
+        static bool IsKnownType(const std::string& elementType);
+
+        // Changes whenever a parser is added or removed or a setting changes, so that results
+        // cached for this registration (see ParseCache) can tell when they are stale
+        unsigned long long GetGeneration() const;
+
+        // When set, Action.ShowCard keeps the JSON of its card and parses it on the first
+        // ShowCardAction::GetCard, so cards that are never shown are never parsed. Off by default.
+        void SetShowCardParsingDeferred(bool isDeferred);
+        bool IsShowCardParsingDeferred() const;
 
     private:
-        std::unordered_set<std::string> m_knownElements;
-        std::unordered_map<std::string, std::shared_ptr<AdaptiveSharedNamespace::ActionElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_cardElementParsers;
+        typedef std::unordered_map<std::string, std::shared_ptr<AdaptiveSharedNamespace::ActionElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> ParserMap;
+
+        static const ParserMap& GetKnownParsers();
+        void ThrowIfKnownOrReadOnly(const std::string& elementType) const;
+
+        ParserMap m_cardElementParsers;
+        bool m_isReadOnly;
+        bool m_isShowCardParsingDeferred;
+        unsigned long long m_generation;
     };
 AdaptiveSharedNamespaceEnd
@@ -0,0 +1,28 @@
+#include "pch.h"
+#include "AdaptiveCardParseError.h"
+
+using namespace AdaptiveSharedNamespace;
+
+AdaptiveCardParseError::AdaptiveCardParseError(const ErrorStatusCode statusCode, const std::string& message, const std::string& jsonPath) :
+    m_statusCode(statusCode), m_message(message), m_jsonPath(jsonPath)
+{
+}
+
+AdaptiveCardParseError::~AdaptiveCardParseError()
+{
+}
+
+ErrorStatusCode AdaptiveCardParseError::GetStatusCode() const
+{
+    return m_statusCode;
+}
+
+const std::string& AdaptiveCardParseError::GetReason() const
+{
+    return m_message;
+}
+
+const std::string& AdaptiveCardParseError::GetJsonPath() const
+{
+    return m_jsonPath;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "pch.h"
+#include "Enums.h"
+
+AdaptiveSharedNamespaceStart
+
+// Why a card failed to parse and where: the path is in JSONPath notation relative to the card,
+// such as "$.body[2].items[0].url"
+class AdaptiveCardParseError
+{
+public:
+    AdaptiveCardParseError(const AdaptiveSharedNamespace::ErrorStatusCode statusCode, const std::string& message, const std::string& jsonPath);
+    ~AdaptiveCardParseError();
+
+    AdaptiveSharedNamespace::ErrorStatusCode GetStatusCode() const;
+    const std::string& GetReason() const;
+    const std::string& GetJsonPath() const;
+
+private:
+    const AdaptiveSharedNamespace::ErrorStatusCode m_statusCode;
+    const std::string m_message;
+    const std::string m_jsonPath;
+};
+
+AdaptiveSharedNamespaceEnd
@@ -8,7 +8,6 @@ using namespace AdaptiveSharedNamespace;
 BaseActionElement::BaseActionElement(ActionType type) :
     m_type(type), m_typeString(ActionTypeToString(type))
 {
-    PopulateKnownPropertiesSet();
 }
 
 BaseActionElement::~BaseActionElement()
@@ -62,8 +61,9 @@ const ActionType BaseActionElement::GetElementType() const
 
 std::string BaseActionElement::Serialize()
 {
-    Json::FastWriter writer;
-    return writer.write(SerializeToJsonValue());
+    CardWriter writer;
+    SerializeToWriter(writer);
+    return writer.GetString();
 }
 
 Json::Value BaseActionElement::SerializeToJsonValue()
@@ -77,6 +77,29 @@ Json::Value BaseActionElement::SerializeToJsonValue()
     return root;
 }
 
+void BaseActionElement::SerializeToWriter(CardWriter& writer)
+{
+    writer.WriteValue(SerializeToJsonValue());
+}
+
+bool BaseActionElement::SerializeToWriterIfSubclassed(CardWriter& writer, const std::type_info& builtInType)
+{
+    if (typeid(*this) == builtInType)
+    {
+        return false;
+    }
+    writer.WriteValue(SerializeToJsonValue());
+    return true;
+}
+
+void BaseActionElement::SerializeProperties(CardWriter& writer)
+{
+    writer.WriteProperty(AdaptiveCardSchemaKey::Type, ActionTypeToString(GetElementType()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::Title, GetTitle());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Id, GetId());
+    writer.WriteProperty(AdaptiveCardSchemaKey::IconUrl, GetIconUrl());
+}
+
 Json::Value BaseActionElement::GetAdditionalProperties()
 {
     return m_additionalProperties;
@@ -87,12 +110,15 @@ void BaseActionElement::SetAdditionalProperties(Json::Value value)
     m_additionalProperties = value;
 }
 
-void BaseActionElement::PopulateKnownPropertiesSet()
+const KnownPropertySet& BaseActionElement::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl));
+    static const KnownPropertySet knownProperties({
+        AdaptiveCardSchemaKey::Type,
+        AdaptiveCardSchemaKey::Title,
+        AdaptiveCardSchemaKey::Id,
+        AdaptiveCardSchemaKey::IconUrl
+    });
+    return knownProperties;
 }
 
 void BaseActionElement::GetResourceUris(std::vector<std::string>&)
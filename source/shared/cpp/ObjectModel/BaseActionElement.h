@@ -1,9 +1,12 @@
 #pragma once
 
 #include "pch.h"
+#include <typeinfo>
 #include "Enums.h"
 #include "json/json.h"
+#include "CardWriter.h"
 #include "ParseUtil.h"
+#include "KnownPropertySet.h"
 
 AdaptiveSharedNamespaceStart
 class BaseActionElement
@@ -30,6 +33,9 @@ public:
     std::string Serialize();
     virtual Json::Value SerializeToJsonValue();
 
+    // Writes the same JSON as SerializeToJsonValue; see BaseCardElement::SerializeToWriter
+    virtual void SerializeToWriter(CardWriter& writer);
+
     template <typename T>
     static std::shared_ptr<T> Deserialize(const Json::Value& json);
 
@@ -39,8 +45,6 @@ public:
     virtual void GetResourceUris(std::vector<std::string>& resourceUris);
 
 private:
-    void PopulateKnownPropertiesSet();
-
     ActionType m_type;
     std::string m_typeString;
     std::string m_title;
@@ -49,7 +53,14 @@ private:
     Json::Value m_additionalProperties;
 
 protected:
-    std::unordered_set<std::string> m_knownProperties;
+    // Writes the properties every action serializes; the caller opens and closes the object
+    void SerializeProperties(CardWriter& writer);
+
+    // As BaseCardElement::SerializeToWriterIfSubclassed
+    bool SerializeToWriterIfSubclassed(CardWriter& writer, const std::type_info& builtInType);
+
+    // Names of the properties this action type deserializes itself
+    virtual const KnownPropertySet& GetKnownProperties() const;
 };
 
 template <typename T>
@@ -59,18 +70,24 @@ std::shared_ptr<T> BaseActionElement::Deserialize(const Json::Value& json)
     std::shared_ptr<BaseActionElement> baseActionElement = cardElement;
 
     ParseUtil::ThrowIfNotJsonObject(json);
+    if (ParseUtil::HasError())
+    {
+        return cardElement;
+    }
 
     baseActionElement->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title, true));
     baseActionElement->SetId(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Id));
     baseActionElement->SetIconUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::IconUrl));
 
     // Walk all properties and put any unknown ones in the additional properties json
+    const KnownPropertySet& knownProperties = baseActionElement->GetKnownProperties();
     for (Json::Value::const_iterator it = json.begin(); it != json.end(); it++)
     {
-        std::string key = it.key().asCString();
-        if (baseActionElement->m_knownProperties.find(key) == baseActionElement->m_knownProperties.end())
+        const char* keyEnd;
+        const char* key = it.memberName(&keyEnd);
+        if (!knownProperties.Contains(key, keyEnd))
         {
-            baseActionElement->m_additionalProperties[key] = *it;
+            baseActionElement->m_additionalProperties[std::string(key, keyEnd)] = *it;
         }
     }
     return cardElement;
@@ -16,20 +16,21 @@ BaseCardElement::BaseCardElement(
     m_separator(separator),
     m_typeString(CardElementTypeToString(type))
 {
-    PopulateKnownPropertiesSet();
 }
 
 BaseCardElement::BaseCardElement(CardElementType type) :
     m_type(type), m_spacing(Spacing::Default), m_typeString(CardElementTypeToString(type))
 {
-    PopulateKnownPropertiesSet();
 }
 
-void BaseCardElement::PopulateKnownPropertiesSet()
+const KnownPropertySet& BaseCardElement::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Spacing));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Separator));
+    static const KnownPropertySet knownProperties({
+        AdaptiveCardSchemaKey::Type,
+        AdaptiveCardSchemaKey::Spacing,
+        AdaptiveCardSchemaKey::Separator
+    });
+    return knownProperties;
 }
 
 BaseCardElement::~BaseCardElement()
@@ -83,8 +84,9 @@ const CardElementType BaseCardElement::GetElementType() const
 
 std::string BaseCardElement::Serialize()
 {
-    Json::FastWriter writer;
-    return writer.write(SerializeToJsonValue());
+    CardWriter writer;
+    SerializeToWriter(writer);
+    return writer.GetString();
 }
 
 Json::Value BaseCardElement::SerializeToJsonValue()
@@ -98,6 +100,29 @@ Json::Value BaseCardElement::SerializeToJsonValue()
     return root;
 }
 
+void BaseCardElement::SerializeToWriter(CardWriter& writer)
+{
+    writer.WriteValue(SerializeToJsonValue());
+}
+
+bool BaseCardElement::SerializeToWriterIfSubclassed(CardWriter& writer, const std::type_info& builtInType)
+{
+    if (typeid(*this) == builtInType)
+    {
+        return false;
+    }
+    writer.WriteValue(SerializeToJsonValue());
+    return true;
+}
+
+void BaseCardElement::SerializeProperties(CardWriter& writer)
+{
+    writer.WriteProperty(AdaptiveCardSchemaKey::Type, CardElementTypeToString(GetElementType()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::Spacing, SpacingToString(GetSpacing()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::Separator, GetSeparator());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Id, GetId());
+}
+
 Json::Value BaseCardElement::SerializeSelectAction(const std::shared_ptr<BaseActionElement> selectAction)
 {
     if (selectAction != nullptr)
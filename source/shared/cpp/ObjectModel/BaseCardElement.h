@@ -1,10 +1,12 @@
 #pragma once
 
 #include "pch.h"
+#include <typeinfo>
 #include "Enums.h"
 #include "json/json.h"
 #include "BaseActionElement.h"
 #include "ParseUtil.h"
+#include "KnownPropertySet.h"
 #include "Separator.h"
 
 AdaptiveSharedNamespaceStart
@@ -34,6 +36,11 @@ public:
     std::string Serialize();
     virtual Json::Value SerializeToJsonValue();
 
+    // Writes the same JSON as SerializeToJsonValue without building a Json::Value. The default
+    // implementation writes the result of SerializeToJsonValue; the built-in elements write directly,
+    // unless the element is of a host subclass (see SerializeToWriterIfSubclassed).
+    virtual void SerializeToWriter(CardWriter& writer);
+
     template <typename T>
     static std::shared_ptr<T> Deserialize(const Json::Value& json);
 
@@ -45,11 +52,19 @@ public:
 protected:
     static Json::Value SerializeSelectAction(const std::shared_ptr<BaseActionElement> selectAction);
 
-    std::unordered_set<std::string> m_knownProperties;
+    // Writes the properties every element serializes; the caller opens and closes the object
+    void SerializeProperties(CardWriter& writer);
 
-private:
-    void PopulateKnownPropertiesSet();
+    // Built-in SerializeToWriter overrides call this first. A host subclass of a built-in element
+    // may override only SerializeToJsonValue, so unless this element is exactly of the built-in
+    // class its SerializeToJsonValue is written instead, and this returns true.
+    bool SerializeToWriterIfSubclassed(CardWriter& writer, const std::type_info& builtInType);
+
+    // Property names consumed by this type's Deserialize; any others are preserved as additional
+    // properties. Types with properties of their own override this to extend their base type's set.
+    virtual const KnownPropertySet& GetKnownProperties() const;
 
+private:
     CardElementType m_type;
     Spacing m_spacing;
     std::string m_id;
@@ -65,6 +80,10 @@ std::shared_ptr<T> BaseCardElement::Deserialize(const Json::Value& json)
     std::shared_ptr<BaseCardElement> baseCardElement = cardElement;
 
     ParseUtil::ThrowIfNotJsonObject(json);
+    if (ParseUtil::HasError())
+    {
+        return cardElement;
+    }
 
     baseCardElement->SetSpacing(
             ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, Spacing::Default, SpacingFromString)); 
@@ -72,12 +91,14 @@ std::shared_ptr<T> BaseCardElement::Deserialize(const Json::Value& json)
     baseCardElement->SetId(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Id));
 
     // Walk all properties and put any unknown ones in the additional properties json
+    const KnownPropertySet& knownProperties = baseCardElement->GetKnownProperties();
     for (Json::Value::const_iterator it = json.begin(); it != json.end(); it++)
     {
-        std::string key = it.key().asCString();
-        if (baseCardElement->m_knownProperties.find(key) == baseCardElement->m_knownProperties.end())
+        const char* keyEnd;
+        const char* key = it.memberName(&keyEnd);
+        if (!knownProperties.Contains(key, keyEnd))
         {
-            baseCardElement->m_additionalProperties[key] = *it;
+            baseCardElement->m_additionalProperties[std::string(key, keyEnd)] = *it;
         }
     }
 
@@ -43,3 +43,11 @@ Json::Value BaseInputElement::SerializeToJsonValue()
 
     return root;
 }
+
+void BaseInputElement::SerializeProperties(CardWriter& writer)
+{
+    BaseCardElement::SerializeProperties(writer);
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::Id, GetId());
+    writer.WriteProperty(AdaptiveCardSchemaKey::IsRequired, GetIsRequired());
+}
@@ -24,6 +24,10 @@ public:
 
     virtual Json::Value SerializeToJsonValue() override;
 
+protected:
+    // Writes the properties every input serializes; the caller opens and closes the object
+    void SerializeProperties(CardWriter& writer);
+
 private:
     std::string m_id;
     bool m_isRequired;
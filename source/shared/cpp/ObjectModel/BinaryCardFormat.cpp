@@ -0,0 +1,1339 @@
+#include "pch.h"
+#include "BinaryCardFormat.h"
+#include "AdaptiveCardParseException.h"
+#include "BaseInputElement.h"
+#include "ChoiceInput.h"
+#include "ChoiceSetInput.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "DateInput.h"
+#include "Fact.h"
+#include "FactSet.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "NumberInput.h"
+#include "OpenUrlAction.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "SubmitAction.h"
+#include "TextBlock.h"
+#include "TextInput.h"
+#include "TimeInput.h"
+#include "ToggleInput.h"
+#include "UnknownElement.h"
+#include <cstring>
+#include <typeinfo>
+
+using namespace AdaptiveSharedNamespace;
+using namespace AdaptiveSharedNamespace::BinaryCardFormat;
+
+namespace
+{
+    const char c_magic[4] = { 'A', 'C', 'B', 'F' };
+    const unsigned int c_formatVersion = 1;
+
+    // Matches the nesting jsoncpp accepts, so anything parsed from JSON can be read back
+    const unsigned int c_maxNestingDepth = 1000;
+
+    // Rebuilds the JSON a parser would have seen for an element or action stored as JSON. Serialized
+    // output drops additional properties, so they are merged back in from what the parser recorded.
+    Json::Value ToParserInput(Json::Value json, const Json::Value& additionalProperties)
+    {
+        if (additionalProperties.isObject())
+        {
+            for (auto it = additionalProperties.begin(); it != additionalProperties.end(); ++it)
+            {
+                const std::string name = it.name();
+                if (!json.isMember(name))
+                {
+                    json[name] = *it;
+                }
+            }
+        }
+        return json;
+    }
+
+    // Only elements of exactly the built-in classes are encoded field by field; a subclass may carry
+    // state the format does not know about, so it is stored as JSON instead.
+    bool IsBuiltInElement(const BaseCardElement& element)
+    {
+        const std::type_info& type = typeid(element);
+        switch (element.GetElementType())
+        {
+        case CardElementType::TextBlock:
+            return type == typeid(TextBlock);
+        case CardElementType::Image:
+            return type == typeid(Image);
+        case CardElementType::ImageSet:
+            return type == typeid(ImageSet);
+        case CardElementType::Container:
+            return type == typeid(Container);
+        case CardElementType::Column:
+            return type == typeid(Column);
+        case CardElementType::ColumnSet:
+            return type == typeid(ColumnSet);
+        case CardElementType::FactSet:
+            return type == typeid(FactSet);
+        case CardElementType::ChoiceSetInput:
+            return type == typeid(ChoiceSetInput);
+        case CardElementType::DateInput:
+            return type == typeid(DateInput);
+        case CardElementType::NumberInput:
+            return type == typeid(NumberInput);
+        case CardElementType::TextInput:
+            return type == typeid(TextInput);
+        case CardElementType::TimeInput:
+            return type == typeid(TimeInput);
+        case CardElementType::ToggleInput:
+            return type == typeid(ToggleInput);
+        case CardElementType::Unknown:
+            return type == typeid(UnknownElement);
+        default:
+            return false;
+        }
+    }
+
+    bool IsBuiltInAction(const BaseActionElement& action)
+    {
+        const std::type_info& type = typeid(action);
+        switch (action.GetElementType())
+        {
+        case ActionType::OpenUrl:
+            return type == typeid(OpenUrlAction);
+        case ActionType::ShowCard:
+            return type == typeid(ShowCardAction);
+        case ActionType::Submit:
+            return type == typeid(SubmitAction);
+        default:
+            return false;
+        }
+    }
+}
+
+BinaryCardWriter::BinaryCardWriter()
+{
+}
+
+std::string BinaryCardWriter::Write(std::shared_ptr<ParseResult> parseResult)
+{
+    BinaryCardWriter writer;
+    writer.WriteCard(parseResult->GetAdaptiveCard());
+    writer.WriteWarnings(parseResult->GetWarnings());
+    return writer.Finish();
+}
+
+std::string BinaryCardWriter::Write(std::shared_ptr<AdaptiveCard> card)
+{
+    BinaryCardWriter writer;
+    writer.WriteCard(card);
+    writer.WriteWarnings({});
+    return writer.Finish();
+}
+
+std::string BinaryCardWriter::Compile(
+    const std::string& jsonString,
+    double rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration)
+{
+    return Write(AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, elementParserRegistration, actionParserRegistration));
+}
+
+std::string BinaryCardWriter::Finish() const
+{
+    // The string table is only complete once the body has been written, so the header and table
+    // are assembled in front of it here
+    BinaryCardWriter header;
+    header.m_body.append(c_magic, sizeof(c_magic));
+    header.WriteVarint(c_formatVersion);
+    header.WriteVarint(m_strings.size());
+
+    size_t offsetPosition = header.m_body.size();
+    header.m_body.append(4 * (m_strings.size() + 1), '\0');
+    std::string stringData;
+    for (const auto& value : m_strings)
+    {
+        header.WriteUInt32(offsetPosition, stringData.size());
+        offsetPosition += 4;
+        stringData.append(*value);
+    }
+    header.WriteUInt32(offsetPosition, stringData.size());
+    header.m_body.append(stringData);
+
+    std::string result;
+    result.reserve(header.m_body.size() + m_body.size());
+    result.append(header.m_body);
+    result.append(m_body);
+    return result;
+}
+
+void BinaryCardWriter::WriteCard(const std::shared_ptr<AdaptiveCard>& card)
+{
+    if (card == nullptr)
+    {
+        WriteByte(NullRecord);
+        return;
+    }
+
+    WriteByte(NativeRecord);
+    const size_t length = BeginLength();
+
+    WriteString(card->GetVersion());
+    WriteString(card->GetFallbackText());
+    WriteString(card->GetBackgroundImage());
+    WriteString(card->GetSpeak());
+    WriteString(card->GetLanguage());
+    WriteVarint(static_cast<unsigned int>(card->GetStyle()));
+    WriteAction(card->GetSelectAction());
+
+    WriteList(card->GetBody(), [this](const std::shared_ptr<BaseCardElement>& element) { WriteElement(element); });
+    WriteList(card->GetActions(), [this](const std::shared_ptr<BaseActionElement>& action) { WriteAction(action); });
+
+    EndLength(length);
+}
+
+void BinaryCardWriter::WriteElement(const std::shared_ptr<BaseCardElement>& element)
+{
+    if (element == nullptr)
+    {
+        WriteByte(NullRecord);
+        return;
+    }
+
+    if (!IsBuiltInElement(*element))
+    {
+        WriteByte(JsonRecord);
+        const size_t length = BeginLength();
+        WriteJson(ToParserInput(element->SerializeToJsonValue(), element->GetAdditionalProperties()));
+        EndLength(length);
+        return;
+    }
+
+    WriteByte(NativeRecord);
+    const size_t length = BeginLength();
+    WriteVarint(static_cast<unsigned int>(element->GetElementType()));
+
+    switch (element->GetElementType())
+    {
+    case CardElementType::TextBlock:
+    {
+        auto textBlock = std::static_pointer_cast<TextBlock>(element);
+        WriteElementProperties(*textBlock);
+        WriteString(textBlock->GetText());
+        WriteVarint(static_cast<unsigned int>(textBlock->GetTextSize()));
+        WriteVarint(static_cast<unsigned int>(textBlock->GetTextWeight()));
+        WriteVarint(static_cast<unsigned int>(textBlock->GetTextColor()));
+        WriteBool(textBlock->GetWrap());
+        WriteBool(textBlock->GetIsSubtle());
+        WriteVarint(textBlock->GetMaxLines());
+        WriteVarint(static_cast<unsigned int>(textBlock->GetHorizontalAlignment()));
+        WriteString(textBlock->GetLanguage());
+        break;
+    }
+    case CardElementType::Image:
+    {
+        auto image = std::static_pointer_cast<Image>(element);
+        WriteElementProperties(*image);
+        WriteString(image->GetUrl());
+        WriteVarint(static_cast<unsigned int>(image->GetImageStyle()));
+        WriteVarint(static_cast<unsigned int>(image->GetImageSize()));
+        WriteString(image->GetAltText());
+        WriteVarint(static_cast<unsigned int>(image->GetHorizontalAlignment()));
+        WriteVarint(image->GetWidth());
+        WriteVarint(image->GetHeight());
+        WriteAction(image->GetSelectAction());
+        break;
+    }
+    case CardElementType::ImageSet:
+    {
+        auto imageSet = std::static_pointer_cast<ImageSet>(element);
+        WriteElementProperties(*imageSet);
+        WriteVarint(static_cast<unsigned int>(imageSet->GetImageSize()));
+        WriteList(imageSet->GetImages(), [this](const std::shared_ptr<Image>& image) { WriteElement(image); });
+        break;
+    }
+    case CardElementType::Container:
+    {
+        auto container = std::static_pointer_cast<Container>(element);
+        WriteElementProperties(*container);
+        WriteVarint(static_cast<unsigned int>(container->GetStyle()));
+        WriteAction(container->GetSelectAction());
+        WriteList(container->GetItems(), [this](const std::shared_ptr<BaseCardElement>& item) { WriteElement(item); });
+        break;
+    }
+    case CardElementType::Column:
+    {
+        auto column = std::static_pointer_cast<Column>(element);
+        WriteElementProperties(*column);
+        WriteString(column->GetWidth());
+        WriteSignedVarint(column->GetExplicitWidth());
+        WriteVarint(static_cast<unsigned int>(column->GetStyle()));
+        WriteAction(column->GetSelectAction());
+        WriteList(column->GetItems(), [this](const std::shared_ptr<BaseCardElement>& item) { WriteElement(item); });
+        break;
+    }
+    case CardElementType::ColumnSet:
+    {
+        auto columnSet = std::static_pointer_cast<ColumnSet>(element);
+        WriteElementProperties(*columnSet);
+        WriteAction(columnSet->GetSelectAction());
+        WriteList(columnSet->GetColumns(), [this](const std::shared_ptr<Column>& column) { WriteElement(column); });
+        break;
+    }
+    case CardElementType::FactSet:
+    {
+        auto factSet = std::static_pointer_cast<FactSet>(element);
+        WriteElementProperties(*factSet);
+        WriteList(factSet->GetFacts(), [this](const std::shared_ptr<Fact>& fact)
+        {
+            WriteString(fact->GetTitle());
+            WriteString(fact->GetValue());
+        });
+        break;
+    }
+    case CardElementType::ChoiceSetInput:
+    {
+        auto choiceSet = std::static_pointer_cast<ChoiceSetInput>(element);
+        WriteInputProperties(*choiceSet);
+        WriteVarint(static_cast<unsigned int>(choiceSet->GetChoiceSetStyle()));
+        WriteBool(choiceSet->GetIsMultiSelect());
+        WriteString(choiceSet->GetValue());
+        WriteList(choiceSet->GetChoices(), [this](const std::shared_ptr<ChoiceInput>& choice)
+        {
+            WriteString(choice->GetTitle());
+            WriteString(choice->GetValue());
+        });
+        break;
+    }
+    case CardElementType::DateInput:
+    {
+        auto dateInput = std::static_pointer_cast<DateInput>(element);
+        WriteInputProperties(*dateInput);
+        WriteString(dateInput->GetMax());
+        WriteString(dateInput->GetMin());
+        WriteString(dateInput->GetPlaceholder());
+        WriteString(dateInput->GetValue());
+        break;
+    }
+    case CardElementType::NumberInput:
+    {
+        auto numberInput = std::static_pointer_cast<NumberInput>(element);
+        WriteInputProperties(*numberInput);
+        WriteString(numberInput->GetPlaceholder());
+        WriteSignedVarint(numberInput->GetValue());
+        WriteSignedVarint(numberInput->GetMax());
+        WriteSignedVarint(numberInput->GetMin());
+        break;
+    }
+    case CardElementType::TextInput:
+    {
+        auto textInput = std::static_pointer_cast<TextInput>(element);
+        WriteInputProperties(*textInput);
+        WriteString(textInput->GetPlaceholder());
+        WriteString(textInput->GetValue());
+        WriteBool(textInput->GetIsMultiline());
+        WriteVarint(textInput->GetMaxLength());
+        WriteVarint(static_cast<unsigned int>(textInput->GetTextInputStyle()));
+        break;
+    }
+    case CardElementType::TimeInput:
+    {
+        auto timeInput = std::static_pointer_cast<TimeInput>(element);
+        WriteInputProperties(*timeInput);
+        WriteString(timeInput->GetMax());
+        WriteString(timeInput->GetMin());
+        WriteString(timeInput->GetPlaceholder());
+        WriteString(timeInput->GetValue());
+        break;
+    }
+    case CardElementType::ToggleInput:
+    {
+        auto toggleInput = std::static_pointer_cast<ToggleInput>(element);
+        WriteInputProperties(*toggleInput);
+        WriteString(toggleInput->GetTitle());
+        WriteString(toggleInput->GetValue());
+        WriteString(toggleInput->GetValueOff());
+        WriteString(toggleInput->GetValueOn());
+        break;
+    }
+    default:
+        WriteElementProperties(*element);
+        break;
+    }
+
+    EndLength(length);
+}
+
+void BinaryCardWriter::WriteAction(const std::shared_ptr<BaseActionElement>& action)
+{
+    if (action == nullptr)
+    {
+        WriteByte(NullRecord);
+        return;
+    }
+
+    if (!IsBuiltInAction(*action))
+    {
+        WriteByte(JsonRecord);
+        const size_t length = BeginLength();
+        WriteJson(ToParserInput(action->SerializeToJsonValue(), action->GetAdditionalProperties()));
+        EndLength(length);
+        return;
+    }
+
+    WriteByte(NativeRecord);
+    const size_t length = BeginLength();
+    WriteVarint(static_cast<unsigned int>(action->GetElementType()));
+    WriteActionProperties(*action);
+
+    switch (action->GetElementType())
+    {
+    case ActionType::OpenUrl:
+        WriteString(std::static_pointer_cast<OpenUrlAction>(action)->GetUrl());
+        break;
+    case ActionType::Submit:
+        WriteString(std::static_pointer_cast<SubmitAction>(action)->GetDataJson());
+        break;
+    case ActionType::ShowCard:
+        WriteCard(std::static_pointer_cast<ShowCardAction>(action)->GetCard());
+        break;
+    default:
+        break;
+    }
+
+    EndLength(length);
+}
+
+void BinaryCardWriter::WriteElementProperties(BaseCardElement& element)
+{
+    WriteString(element.GetElementTypeString());
+    WriteVarint(static_cast<unsigned int>(element.GetSpacing()));
+    WriteBool(element.GetSeparator());
+    WriteString(element.GetId());
+
+    const size_t length = BeginLength();
+    WriteJson(element.GetAdditionalProperties());
+    EndLength(length);
+}
+
+void BinaryCardWriter::WriteInputProperties(BaseInputElement& input)
+{
+    WriteElementProperties(input);
+    WriteBool(input.GetIsRequired());
+}
+
+void BinaryCardWriter::WriteActionProperties(BaseActionElement& action)
+{
+    WriteString(action.GetElementTypeString());
+    WriteString(action.GetTitle());
+    WriteString(action.GetId());
+    WriteString(action.GetIconUrl());
+
+    const size_t length = BeginLength();
+    WriteJson(action.GetAdditionalProperties());
+    EndLength(length);
+}
+
+void BinaryCardWriter::WriteWarnings(const std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings)
+{
+    WriteVarint(warnings.size());
+    for (const auto& warning : warnings)
+    {
+        WriteVarint(static_cast<unsigned int>(warning->GetStatusCode()));
+        WriteString(warning->GetReason());
+    }
+}
+
+template <typename T, typename WriteChild>
+void BinaryCardWriter::WriteList(const std::vector<std::shared_ptr<T>>& items, WriteChild writeChild)
+{
+    const size_t length = BeginLength();
+    WriteVarint(items.size());
+
+    size_t offsetPosition = m_body.size();
+    m_body.append(4 * items.size(), '\0');
+
+    for (const auto& item : items)
+    {
+        WriteUInt32(offsetPosition, m_body.size());
+        offsetPosition += 4;
+        writeChild(item);
+    }
+
+    EndLength(length);
+}
+
+size_t BinaryCardWriter::BeginLength()
+{
+    const size_t position = m_body.size();
+    m_body.append(4, '\0');
+    return position;
+}
+
+void BinaryCardWriter::EndLength(size_t position)
+{
+    WriteUInt32(position, m_body.size() - position - 4);
+}
+
+void BinaryCardWriter::WriteJson(const Json::Value& value)
+{
+    switch (value.type())
+    {
+    case Json::nullValue:
+        WriteByte(JsonNull);
+        break;
+    case Json::booleanValue:
+        WriteByte(value.asBool() ? JsonTrue : JsonFalse);
+        break;
+    case Json::intValue:
+        WriteByte(JsonInt);
+        WriteSignedVarint(value.asLargestInt());
+        break;
+    case Json::uintValue:
+        WriteByte(JsonUInt);
+        WriteVarint(value.asLargestUInt());
+        break;
+    case Json::realValue:
+    {
+        WriteByte(JsonReal);
+        const double real = value.asDouble();
+        unsigned long long bits;
+        static_assert(sizeof(bits) == sizeof(real), "double is expected to be 64 bits");
+        memcpy(&bits, &real, sizeof(bits));
+        for (int i = 0; i < 8; ++i)
+        {
+            WriteByte(static_cast<unsigned char>((bits >> (8 * i)) & 0xFF));
+        }
+        break;
+    }
+    case Json::stringValue:
+        WriteByte(JsonString);
+        WriteString(value.asString());
+        break;
+    case Json::arrayValue:
+    {
+        WriteByte(JsonArray);
+        const size_t length = BeginLength();
+        WriteVarint(value.size());
+        for (const auto& item : value)
+        {
+            WriteJson(item);
+        }
+        EndLength(length);
+        break;
+    }
+    case Json::objectValue:
+    {
+        WriteByte(JsonObject);
+        const size_t length = BeginLength();
+        WriteVarint(value.size());
+        for (auto it = value.begin(); it != value.end(); ++it)
+        {
+            WriteString(it.name());
+            WriteJson(*it);
+        }
+        EndLength(length);
+        break;
+    }
+    }
+}
+
+void BinaryCardWriter::WriteString(const std::string& value)
+{
+    auto inserted = m_stringIndex.emplace(value, static_cast<unsigned int>(m_strings.size()));
+    if (inserted.second)
+    {
+        m_strings.push_back(&inserted.first->first);
+    }
+    WriteVarint(inserted.first->second);
+}
+
+void BinaryCardWriter::WriteBool(bool value)
+{
+    WriteByte(value ? 1 : 0);
+}
+
+void BinaryCardWriter::WriteVarint(unsigned long long value)
+{
+    while (value >= 0x80)
+    {
+        m_body.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    m_body.push_back(static_cast<char>(value));
+}
+
+void BinaryCardWriter::WriteSignedVarint(long long value)
+{
+    // Zigzag encoding keeps small negative numbers short
+    WriteVarint((static_cast<unsigned long long>(value) << 1) ^ static_cast<unsigned long long>(value >> 63));
+}
+
+void BinaryCardWriter::WriteUInt32(size_t position, size_t value)
+{
+    if (value > 0xFFFFFFFF)
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Card is too large for the binary format");
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        m_body[position + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+void BinaryCardWriter::WriteByte(unsigned char value)
+{
+    m_body.push_back(static_cast<char>(value));
+}
+
+
+Data::Data() :
+    m_body(nullptr),
+    m_end(nullptr),
+    m_stringOffsets(nullptr),
+    m_stringCount(0),
+    m_stringData(nullptr),
+    m_stringDataSize(0)
+{
+}
+
+Data::Data(const char* data, size_t size) :
+    m_end(data + size)
+{
+    if (size < sizeof(c_magic) || memcmp(data, c_magic, sizeof(c_magic)) != 0)
+    {
+        Cursor::ThrowInvalid();
+    }
+
+    Cursor cursor(data + sizeof(c_magic), m_end);
+    if (cursor.ReadVarint() != c_formatVersion)
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Unsupported binary card format version");
+    }
+
+    m_stringCount = cursor.ReadVarint();
+    if (m_stringCount >= static_cast<unsigned long long>(m_end - cursor.GetPosition()) / 4)
+    {
+        Cursor::ThrowInvalid();
+    }
+    m_stringOffsets = cursor.GetPosition();
+
+    // The last offset is the size of the string bytes
+    cursor.SetPosition(m_stringOffsets + 4 * m_stringCount);
+    m_stringDataSize = cursor.ReadUInt32();
+    m_stringData = cursor.GetPosition();
+    if (m_stringDataSize > static_cast<size_t>(m_end - m_stringData))
+    {
+        Cursor::ThrowInvalid();
+    }
+
+    m_body = m_stringData + m_stringDataSize;
+}
+
+const char* Data::GetBody() const
+{
+    return m_body;
+}
+
+const char* Data::GetEnd() const
+{
+    return m_end;
+}
+
+void Data::GetString(unsigned long long index, const char*& value, size_t& size) const
+{
+    if (index >= m_stringCount)
+    {
+        Cursor::ThrowInvalid();
+    }
+
+    Cursor cursor(m_stringOffsets + 4 * index, m_stringData);
+    const unsigned int begin = cursor.ReadUInt32();
+    const unsigned int end = cursor.ReadUInt32();
+    if (begin > end || end > m_stringDataSize)
+    {
+        Cursor::ThrowInvalid();
+    }
+
+    value = m_stringData + begin;
+    size = end - begin;
+}
+
+Cursor::Cursor(const char* current, const char* end) :
+    m_current(current),
+    m_end(end)
+{
+}
+
+const char* Cursor::GetPosition() const
+{
+    return m_current;
+}
+
+const char* Cursor::GetEnd() const
+{
+    return m_end;
+}
+
+void Cursor::SetPosition(const char* position)
+{
+    m_current = position;
+}
+
+unsigned char Cursor::ReadByte()
+{
+    if (m_current >= m_end)
+    {
+        ThrowInvalid();
+    }
+    return static_cast<unsigned char>(*m_current++);
+}
+
+bool Cursor::ReadBool()
+{
+    return ReadByte() != 0;
+}
+
+unsigned long long Cursor::ReadVarint()
+{
+    unsigned long long value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7)
+    {
+        const unsigned char byte = ReadByte();
+        value |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return value;
+        }
+    }
+    ThrowInvalid();
+}
+
+long long Cursor::ReadSignedVarint()
+{
+    const unsigned long long value = ReadVarint();
+    return static_cast<long long>(value >> 1) ^ -static_cast<long long>(value & 1);
+}
+
+unsigned int Cursor::ReadUInt32()
+{
+    if (m_current > m_end || m_end - m_current < 4)
+    {
+        ThrowInvalid();
+    }
+
+    unsigned int value = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        value |= static_cast<unsigned int>(static_cast<unsigned char>(*m_current++)) << (8 * i);
+    }
+    return value;
+}
+
+const char* Cursor::ReadLength()
+{
+    const unsigned int length = ReadUInt32();
+    if (length > static_cast<size_t>(m_end - m_current))
+    {
+        ThrowInvalid();
+    }
+    return m_current + length;
+}
+
+void Cursor::SkipField(FieldKind kind)
+{
+    switch (kind)
+    {
+    case StringField:
+    case VarintField:
+        ReadVarint();
+        break;
+    case BoolField:
+        ReadByte();
+        break;
+    case LengthPrefixedField:
+        m_current = ReadLength();
+        break;
+    case RecordField:
+        SkipRecord();
+        break;
+    }
+}
+
+void Cursor::SkipRecord()
+{
+    if (ReadByte() != NullRecord)
+    {
+        m_current = ReadLength();
+    }
+}
+
+void Cursor::SkipJson()
+{
+    switch (ReadByte())
+    {
+    case JsonNull:
+    case JsonFalse:
+    case JsonTrue:
+        break;
+    case JsonInt:
+    case JsonUInt:
+    case JsonString:
+        ReadVarint();
+        break;
+    case JsonReal:
+        if (m_end - m_current < 8)
+        {
+            ThrowInvalid();
+        }
+        m_current += 8;
+        break;
+    case JsonArray:
+    case JsonObject:
+        m_current = ReadLength();
+        break;
+    default:
+        ThrowInvalid();
+    }
+}
+
+void Cursor::ThrowInvalid()
+{
+    throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Invalid binary card data");
+}
+
+std::shared_ptr<ParseResult> BinaryCardReader::Read(
+    const std::string& data,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration)
+{
+    return Read(data.data(), data.size(), elementParserRegistration, actionParserRegistration);
+}
+
+std::shared_ptr<ParseResult> BinaryCardReader::Read(
+    const char* data,
+    size_t size,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration)
+{
+    if (elementParserRegistration == nullptr)
+    {
+        elementParserRegistration = ElementParserRegistration::GetDefault();
+    }
+    if (actionParserRegistration == nullptr)
+    {
+        actionParserRegistration = ActionParserRegistration::GetDefault();
+    }
+
+    BinaryCardReader reader(data, size, elementParserRegistration, actionParserRegistration);
+    auto card = reader.ReadCard();
+    if (card == nullptr)
+    {
+        Cursor::ThrowInvalid();
+    }
+
+    auto warnings = reader.ReadWarnings();
+    return std::make_shared<ParseResult>(card, warnings);
+}
+
+BinaryCardReader::BinaryCardReader(
+    const char* data,
+    size_t size,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration) :
+    m_data(data, size),
+    m_cursor(m_data.GetBody(), m_data.GetEnd()),
+    m_depth(0),
+    m_elementParserRegistration(elementParserRegistration),
+    m_actionParserRegistration(actionParserRegistration)
+{
+}
+
+std::shared_ptr<AdaptiveCard> BinaryCardReader::ReadCard()
+{
+    const unsigned char kind = m_cursor.ReadByte();
+    if (kind == NullRecord)
+    {
+        return nullptr;
+    }
+    if (kind != NativeRecord)
+    {
+        Cursor::ThrowInvalid();
+    }
+
+    const char* end = m_cursor.ReadLength();
+    EnterNested();
+
+    std::string version = ReadString();
+    std::string fallbackText = ReadString();
+    std::string backgroundImage = ReadString();
+    std::string speak = ReadString();
+    std::string language = ReadString();
+    const ContainerStyle style = ReadEnum(ContainerStyle::Emphasis);
+    auto selectAction = ReadAction();
+
+    std::vector<std::shared_ptr<BaseCardElement>> body;
+    ReadList(body, [this]() { return ReadElement(); });
+    std::vector<std::shared_ptr<BaseActionElement>> actions;
+    ReadList(actions, [this]() { return ReadAction(); });
+
+    // The language was already applied to the text blocks when the card was written, so it is
+    // restored as is rather than through SetLanguage
+    auto card = std::make_shared<AdaptiveCard>(
+        version, fallbackText, backgroundImage, style, speak, language, body, actions);
+    card->SetSelectAction(selectAction);
+
+    LeaveNested();
+    ExpectEnd(end);
+    return card;
+}
+
+std::shared_ptr<BaseCardElement> BinaryCardReader::ReadElement()
+{
+    const unsigned char kind = m_cursor.ReadByte();
+    if (kind == NullRecord)
+    {
+        return nullptr;
+    }
+
+    const char* end = m_cursor.ReadLength();
+    if (kind == JsonRecord)
+    {
+        const Json::Value json = ReadJson();
+        ExpectEnd(end);
+        return ParseUtil::GetElementFromJsonValue(m_elementParserRegistration, m_actionParserRegistration, json);
+    }
+    if (kind != NativeRecord)
+    {
+        Cursor::ThrowInvalid();
+    }
+
+    EnterNested();
+
+    std::shared_ptr<BaseCardElement> element;
+    switch (ReadEnum(CardElementType::Unknown))
+    {
+    case CardElementType::TextBlock:
+    {
+        auto textBlock = std::make_shared<TextBlock>();
+        ReadElementProperties(*textBlock);
+        textBlock->SetText(ReadString());
+        textBlock->SetTextSize(ReadEnum(TextSize::ExtraLarge));
+        textBlock->SetTextWeight(ReadEnum(TextWeight::Bolder));
+        textBlock->SetTextColor(ReadEnum(ForegroundColor::Attention));
+        textBlock->SetWrap(m_cursor.ReadBool());
+        textBlock->SetIsSubtle(m_cursor.ReadBool());
+        textBlock->SetMaxLines(static_cast<unsigned int>(m_cursor.ReadVarint()));
+        textBlock->SetHorizontalAlignment(ReadEnum(HorizontalAlignment::Right));
+        textBlock->SetLanguage(ReadString());
+        element = textBlock;
+        break;
+    }
+    case CardElementType::Image:
+    {
+        auto image = std::make_shared<Image>();
+        ReadElementProperties(*image);
+        image->SetUrl(ReadString());
+        image->SetImageStyle(ReadEnum(ImageStyle::Person));
+        image->SetImageSize(ReadEnum(ImageSize::Large));
+        image->SetAltText(ReadString());
+        image->SetHorizontalAlignment(ReadEnum(HorizontalAlignment::Right));
+        image->SetWidth(static_cast<unsigned int>(m_cursor.ReadVarint()));
+        image->SetHeight(static_cast<unsigned int>(m_cursor.ReadVarint()));
+        image->SetSelectAction(ReadAction());
+        element = image;
+        break;
+    }
+    case CardElementType::ImageSet:
+    {
+        auto imageSet = std::make_shared<ImageSet>();
+        ReadElementProperties(*imageSet);
+        imageSet->SetImageSize(ReadEnum(ImageSize::Large));
+        ReadList(imageSet->GetImages(), [this]() { return std::dynamic_pointer_cast<Image>(ReadElement()); });
+        element = imageSet;
+        break;
+    }
+    case CardElementType::Container:
+    {
+        auto container = std::make_shared<Container>();
+        ReadElementProperties(*container);
+        container->SetStyle(ReadEnum(ContainerStyle::Emphasis));
+        container->SetSelectAction(ReadAction());
+        ReadList(container->GetItems(), [this]() { return ReadElement(); });
+        element = container;
+        break;
+    }
+    case CardElementType::Column:
+    {
+        auto column = std::make_shared<Column>();
+        ReadElementProperties(*column);
+        column->SetWidth(ReadString());
+        column->SetExplicitWidth(static_cast<int>(m_cursor.ReadSignedVarint()));
+        column->SetStyle(ReadEnum(ContainerStyle::Emphasis));
+        column->SetSelectAction(ReadAction());
+        ReadList(column->GetItems(), [this]() { return ReadElement(); });
+        element = column;
+        break;
+    }
+    case CardElementType::ColumnSet:
+    {
+        auto columnSet = std::make_shared<ColumnSet>();
+        ReadElementProperties(*columnSet);
+        columnSet->SetSelectAction(ReadAction());
+        ReadList(columnSet->GetColumns(), [this]() { return std::dynamic_pointer_cast<Column>(ReadElement()); });
+        element = columnSet;
+        break;
+    }
+    case CardElementType::FactSet:
+    {
+        auto factSet = std::make_shared<FactSet>();
+        ReadElementProperties(*factSet);
+        ReadList(factSet->GetFacts(), [this]()
+        {
+            auto fact = std::make_shared<Fact>();
+            fact->SetTitle(ReadString());
+            fact->SetValue(ReadString());
+            return fact;
+        });
+        element = factSet;
+        break;
+    }
+    case CardElementType::ChoiceSetInput:
+    {
+        auto choiceSet = std::make_shared<ChoiceSetInput>();
+        ReadInputProperties(*choiceSet);
+        choiceSet->SetChoiceSetStyle(ReadEnum(ChoiceSetStyle::Expanded));
+        choiceSet->SetIsMultiSelect(m_cursor.ReadBool());
+        choiceSet->SetValue(ReadString());
+        ReadList(choiceSet->GetChoices(), [this]()
+        {
+            auto choice = std::make_shared<ChoiceInput>();
+            choice->SetTitle(ReadString());
+            choice->SetValue(ReadString());
+            return choice;
+        });
+        element = choiceSet;
+        break;
+    }
+    case CardElementType::DateInput:
+    {
+        auto dateInput = std::make_shared<DateInput>();
+        ReadInputProperties(*dateInput);
+        dateInput->SetMax(ReadString());
+        dateInput->SetMin(ReadString());
+        dateInput->SetPlaceholder(ReadString());
+        dateInput->SetValue(ReadString());
+        element = dateInput;
+        break;
+    }
+    case CardElementType::NumberInput:
+    {
+        auto numberInput = std::make_shared<NumberInput>();
+        ReadInputProperties(*numberInput);
+        numberInput->SetPlaceholder(ReadString());
+        numberInput->SetValue(static_cast<int>(m_cursor.ReadSignedVarint()));
+        numberInput->SetMax(static_cast<int>(m_cursor.ReadSignedVarint()));
+        numberInput->SetMin(static_cast<int>(m_cursor.ReadSignedVarint()));
+        element = numberInput;
+        break;
+    }
+    case CardElementType::TextInput:
+    {
+        auto textInput = std::make_shared<TextInput>();
+        ReadInputProperties(*textInput);
+        textInput->SetPlaceholder(ReadString());
+        textInput->SetValue(ReadString());
+        textInput->SetIsMultiline(m_cursor.ReadBool());
+        textInput->SetMaxLength(static_cast<unsigned int>(m_cursor.ReadVarint()));
+        textInput->SetTextInputStyle(ReadEnum(TextInputStyle::Email));
+        element = textInput;
+        break;
+    }
+    case CardElementType::TimeInput:
+    {
+        auto timeInput = std::make_shared<TimeInput>();
+        ReadInputProperties(*timeInput);
+        timeInput->SetMax(ReadString());
+        timeInput->SetMin(ReadString());
+        timeInput->SetPlaceholder(ReadString());
+        timeInput->SetValue(ReadString());
+        element = timeInput;
+        break;
+    }
+    case CardElementType::ToggleInput:
+    {
+        auto toggleInput = std::make_shared<ToggleInput>();
+        ReadInputProperties(*toggleInput);
+        toggleInput->SetTitle(ReadString());
+        toggleInput->SetValue(ReadString());
+        toggleInput->SetValueOff(ReadString());
+        toggleInput->SetValueOn(ReadString());
+        element = toggleInput;
+        break;
+    }
+    case CardElementType::Unknown:
+    {
+        auto unknown = std::make_shared<UnknownElement>();
+        ReadElementProperties(*unknown);
+        element = unknown;
+        break;
+    }
+    default:
+        Cursor::ThrowInvalid();
+    }
+
+    LeaveNested();
+    ExpectEnd(end);
+    return element;
+}
+
+std::shared_ptr<BaseActionElement> BinaryCardReader::ReadAction()
+{
+    const unsigned char kind = m_cursor.ReadByte();
+    if (kind == NullRecord)
+    {
+        return nullptr;
+    }
+
+    const char* end = m_cursor.ReadLength();
+    if (kind == JsonRecord)
+    {
+        const Json::Value json = ReadJson();
+        ExpectEnd(end);
+        return ParseUtil::GetActionFromJsonValue(m_elementParserRegistration, m_actionParserRegistration, json);
+    }
+    if (kind != NativeRecord)
+    {
+        Cursor::ThrowInvalid();
+    }
+
+    EnterNested();
+
+    std::shared_ptr<BaseActionElement> action;
+    switch (ReadEnum(ActionType::Custom))
+    {
+    case ActionType::OpenUrl:
+    {
+        auto openUrlAction = std::make_shared<OpenUrlAction>();
+        ReadActionProperties(*openUrlAction);
+        openUrlAction->SetUrl(ReadString());
+        action = openUrlAction;
+        break;
+    }
+    case ActionType::Submit:
+    {
+        auto submitAction = std::make_shared<SubmitAction>();
+        ReadActionProperties(*submitAction);
+        submitAction->SetDataJson(ReadString());
+        action = submitAction;
+        break;
+    }
+    case ActionType::ShowCard:
+    {
+        auto showCardAction = std::make_shared<ShowCardAction>();
+        ReadActionProperties(*showCardAction);
+        auto card = ReadCard();
+        if (card != nullptr)
+        {
+            showCardAction->SetCard(card);
+        }
+        action = showCardAction;
+        break;
+    }
+    default:
+        Cursor::ThrowInvalid();
+    }
+
+    LeaveNested();
+    ExpectEnd(end);
+    return action;
+}
+
+void BinaryCardReader::ReadElementProperties(BaseCardElement& element)
+{
+    element.SetElementTypeString(ReadString());
+    element.SetSpacing(ReadEnum(Spacing::Padding));
+    element.SetSeparator(m_cursor.ReadBool());
+    element.SetId(ReadString());
+    element.SetAdditionalProperties(ReadAdditionalProperties());
+}
+
+void BinaryCardReader::ReadInputProperties(BaseInputElement& input)
+{
+    ReadElementProperties(input);
+    input.SetIsRequired(m_cursor.ReadBool());
+}
+
+void BinaryCardReader::ReadActionProperties(BaseActionElement& action)
+{
+    action.SetElementTypeString(ReadString());
+    action.SetTitle(ReadString());
+    action.SetId(ReadString());
+    action.SetIconUrl(ReadString());
+    action.SetAdditionalProperties(ReadAdditionalProperties());
+}
+
+Json::Value BinaryCardReader::ReadAdditionalProperties()
+{
+    const char* end = m_cursor.ReadLength();
+    Json::Value additionalProperties = ReadJson();
+    ExpectEnd(end);
+    return additionalProperties;
+}
+
+std::vector<std::shared_ptr<AdaptiveCardParseWarning>> BinaryCardReader::ReadWarnings()
+{
+    const unsigned long long count = m_cursor.ReadVarint();
+    if (count > static_cast<unsigned long long>(m_cursor.GetEnd() - m_cursor.GetPosition()))
+    {
+        Cursor::ThrowInvalid();
+    }
+
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+    warnings.reserve(static_cast<size_t>(count));
+    for (unsigned long long i = 0; i < count; ++i)
+    {
+        const WarningStatusCode statusCode = ReadEnum(WarningStatusCode::DuplicateId);
+        warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(statusCode, ReadString()));
+    }
+    return warnings;
+}
+
+template <typename T, typename ReadChild>
+void BinaryCardReader::ReadList(std::vector<std::shared_ptr<T>>& items, ReadChild readChild)
+{
+    const char* end = m_cursor.ReadLength();
+    const unsigned long long count = m_cursor.ReadVarint();
+    if (count > static_cast<unsigned long long>(end - m_cursor.GetPosition()) / 4)
+    {
+        Cursor::ThrowInvalid();
+    }
+
+    const char* offsetTable = m_cursor.GetPosition();
+    m_cursor.SetPosition(offsetTable + 4 * count);
+
+    items.reserve(items.size() + static_cast<size_t>(count));
+    for (unsigned long long i = 0; i < count; ++i)
+    {
+        m_cursor.SetPosition(offsetTable + 4 * i);
+        const unsigned int offset = m_cursor.ReadUInt32();
+        if (offset < static_cast<size_t>(offsetTable + 4 * count - m_data.GetBody()) ||
+            offset >= static_cast<size_t>(end - m_data.GetBody()))
+        {
+            Cursor::ThrowInvalid();
+        }
+        m_cursor.SetPosition(m_data.GetBody() + offset);
+
+        auto item = readChild();
+        if (item != nullptr)
+        {
+            items.push_back(item);
+        }
+    }
+
+    ExpectEnd(end);
+}
+
+template <typename T>
+T BinaryCardReader::ReadEnum(T lastValue)
+{
+    const unsigned long long value = m_cursor.ReadVarint();
+    if (value > static_cast<unsigned long long>(lastValue))
+    {
+        Cursor::ThrowInvalid();
+    }
+    return static_cast<T>(value);
+}
+
+void BinaryCardReader::ExpectEnd(const char* end) const
+{
+    if (m_cursor.GetPosition() != end)
+    {
+        Cursor::ThrowInvalid();
+    }
+}
+
+Json::Value BinaryCardReader::ReadJson()
+{
+    switch (m_cursor.ReadByte())
+    {
+    case JsonNull:
+        return Json::Value();
+    case JsonFalse:
+        return Json::Value(false);
+    case JsonTrue:
+        return Json::Value(true);
+    case JsonInt:
+        return Json::Value(static_cast<Json::LargestInt>(m_cursor.ReadSignedVarint()));
+    case JsonUInt:
+        return Json::Value(static_cast<Json::LargestUInt>(m_cursor.ReadVarint()));
+    case JsonReal:
+    {
+        unsigned long long bits = 0;
+        for (int i = 0; i < 8; ++i)
+        {
+            bits |= static_cast<unsigned long long>(m_cursor.ReadByte()) << (8 * i);
+        }
+        double real;
+        memcpy(&real, &bits, sizeof(real));
+        return Json::Value(real);
+    }
+    case JsonString:
+        return Json::Value(ReadString());
+    case JsonArray:
+    {
+        const char* end = m_cursor.ReadLength();
+        EnterNested();
+        const unsigned long long count = m_cursor.ReadVarint();
+        Json::Value array(Json::arrayValue);
+        for (unsigned long long i = 0; i < count; ++i)
+        {
+            array.append(ReadJson());
+        }
+        LeaveNested();
+        ExpectEnd(end);
+        return array;
+    }
+    case JsonObject:
+    {
+        const char* end = m_cursor.ReadLength();
+        EnterNested();
+        const unsigned long long count = m_cursor.ReadVarint();
+        Json::Value object(Json::objectValue);
+        for (unsigned long long i = 0; i < count; ++i)
+        {
+            const std::string name = ReadString();
+            object[name] = ReadJson();
+        }
+        LeaveNested();
+        ExpectEnd(end);
+        return object;
+    }
+    default:
+        Cursor::ThrowInvalid();
+    }
+}
+
+std::string BinaryCardReader::ReadString()
+{
+    const char* value;
+    size_t size;
+    m_data.GetString(m_cursor.ReadVarint(), value, size);
+    return std::string(value, size);
+}
+
+void BinaryCardReader::EnterNested()
+{
+    if (++m_depth > c_maxNestingDepth)
+    {
+        Cursor::ThrowInvalid();
+    }
+}
+
+void BinaryCardReader::LeaveNested()
+{
+    --m_depth;
+}
@@ -0,0 +1,223 @@
+#pragma once
+
+#include "pch.h"
+#include "json/json.h"
+#include "ParseResult.h"
+#include "ElementParserRegistration.h"
+#include "ActionParserRegistration.h"
+
+AdaptiveSharedNamespaceStart
+
+class AdaptiveCard;
+class BaseCardElement;
+class BaseActionElement;
+class BaseInputElement;
+
+// Compact binary encoding of a parsed card, intended for caches and for handing cards between
+// processes without re-parsing JSON. The layout is:
+//
+//   magic "ACBF", format version (varint)
+//   string table: count (varint), count + 1 offsets into the string bytes, then the bytes
+//   body: the card record, then the warnings
+//
+// Integers and enums are stored as varints and every string as an index into the string table.
+// Cards, elements and actions are records: a kind byte and, unless the record is null, its length.
+// Lists store their length, a count and the offsets (from the start of the body) of each child
+// record, followed by the records themselves, so every child lies after its list's offsets and
+// within its length. Readers reject any other offset, which rules out cycles in malformed data.
+// Lengths, offsets and fixed-size values are 32-bit little-endian. Because everything
+// variable-sized is length-prefixed, a reader can skip straight to the field it needs, which is
+// what CardView relies on.
+//
+// Elements and actions whose dynamic type is not one of the built-in classes, such as those
+// produced by custom parsers, are stored as their serialized JSON and handed back to the
+// registered parsers on read.
+class BinaryCardWriter
+{
+public:
+    static std::string Write(std::shared_ptr<ParseResult> parseResult);
+    static std::string Write(std::shared_ptr<AdaptiveCard> card);
+
+    // Parses the card JSON and writes the result
+    static std::string Compile(
+        const std::string& jsonString,
+        double rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr);
+
+private:
+    BinaryCardWriter();
+
+    std::string Finish() const;
+
+    void WriteCard(const std::shared_ptr<AdaptiveCard>& card);
+    void WriteElement(const std::shared_ptr<BaseCardElement>& element);
+    void WriteAction(const std::shared_ptr<BaseActionElement>& action);
+    void WriteElementProperties(BaseCardElement& element);
+    void WriteInputProperties(BaseInputElement& input);
+    void WriteActionProperties(BaseActionElement& action);
+    void WriteWarnings(const std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings);
+
+    template <typename T, typename WriteChild>
+    void WriteList(const std::vector<std::shared_ptr<T>>& items, WriteChild writeChild);
+
+    // Reserves room for a length and returns its position for EndLength to fill in
+    size_t BeginLength();
+    void EndLength(size_t position);
+
+    void WriteJson(const Json::Value& value);
+    void WriteString(const std::string& value);
+    void WriteBool(bool value);
+    void WriteVarint(unsigned long long value);
+    void WriteSignedVarint(long long value);
+    void WriteUInt32(size_t position, size_t value);
+    void WriteByte(unsigned char value);
+
+    std::string m_body;
+    std::vector<const std::string*> m_strings;
+    std::unordered_map<std::string, unsigned int> m_stringIndex;
+};
+
+namespace BinaryCardFormat
+{
+    enum RecordKind : unsigned char
+    {
+        NullRecord = 0,
+        NativeRecord,
+        JsonRecord
+    };
+
+    enum JsonTag : unsigned char
+    {
+        JsonNull = 0,
+        JsonFalse,
+        JsonTrue,
+        JsonInt,
+        JsonUInt,
+        JsonReal,
+        JsonString,
+        JsonArray,
+        JsonObject
+    };
+
+    // How a field of a record is encoded, so that it can be skipped without decoding it
+    enum FieldKind : unsigned char
+    {
+        StringField = 0,
+        VarintField,
+        BoolField,
+        LengthPrefixedField,
+        RecordField
+    };
+
+    // Validated header of a binary card: the bounds of the body and the string table
+    class Data
+    {
+    public:
+        Data();
+        Data(const char* data, size_t size);
+
+        const char* GetBody() const;
+        const char* GetEnd() const;
+
+        // Returns the bytes of a string table entry
+        void GetString(unsigned long long index, const char*& value, size_t& size) const;
+
+    private:
+        const char* m_body;
+        const char* m_end;
+        const char* m_stringOffsets;
+        unsigned long long m_stringCount;
+        const char* m_stringData;
+        size_t m_stringDataSize;
+    };
+
+    // Bounds-checked decoding of the primitives of the format. Anything out of bounds or malformed
+    // throws AdaptiveCardParseException with ErrorStatusCode::InvalidJson.
+    class Cursor
+    {
+    public:
+        Cursor(const char* current, const char* end);
+
+        const char* GetPosition() const;
+        const char* GetEnd() const;
+        void SetPosition(const char* position);
+
+        unsigned char ReadByte();
+        bool ReadBool();
+        unsigned long long ReadVarint();
+        long long ReadSignedVarint();
+        unsigned int ReadUInt32();
+
+        // Reads a length and returns the end of the range it covers
+        const char* ReadLength();
+
+        void SkipField(FieldKind kind);
+        void SkipRecord();
+        void SkipJson();
+
+        [[noreturn]] static void ThrowInvalid();
+
+    private:
+        const char* m_current;
+        const char* m_end;
+    };
+}
+
+// Reads cards written by BinaryCardWriter. Null registrations resolve to the defaults, which are
+// used for elements and actions that were stored as JSON. Data that is truncated, malformed or of
+// an unsupported format version throws AdaptiveCardParseException with ErrorStatusCode::InvalidJson.
+class BinaryCardReader
+{
+public:
+    static std::shared_ptr<ParseResult> Read(
+        const std::string& data,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr);
+
+    static std::shared_ptr<ParseResult> Read(
+        const char* data,
+        size_t size,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr);
+
+private:
+    BinaryCardReader(
+        const char* data,
+        size_t size,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration);
+
+    std::shared_ptr<AdaptiveCard> ReadCard();
+    std::shared_ptr<BaseCardElement> ReadElement();
+    std::shared_ptr<BaseActionElement> ReadAction();
+    void ReadElementProperties(BaseCardElement& element);
+    void ReadInputProperties(BaseInputElement& input);
+    void ReadActionProperties(BaseActionElement& action);
+    Json::Value ReadAdditionalProperties();
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> ReadWarnings();
+
+    template <typename T, typename ReadChild>
+    void ReadList(std::vector<std::shared_ptr<T>>& items, ReadChild readChild);
+
+    template <typename T>
+    T ReadEnum(T lastValue);
+
+    // Checks that a record or list was consumed exactly up to its stated end
+    void ExpectEnd(const char* end) const;
+
+    Json::Value ReadJson();
+    std::string ReadString();
+
+    void EnterNested();
+    void LeaveNested();
+
+    BinaryCardFormat::Data m_data;
+    BinaryCardFormat::Cursor m_cursor;
+    unsigned int m_depth;
+
+    std::shared_ptr<ElementParserRegistration> m_elementParserRegistration;
+    std::shared_ptr<ActionParserRegistration> m_actionParserRegistration;
+};
+
+AdaptiveSharedNamespaceEnd
@@ -0,0 +1,220 @@
+#include "pch.h"
+#include "CardBatchParser.h"
+#include "SharedAdaptiveCard.h"
+#include <mutex>
+#include <thread>
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    // Range of batch indices still to be parsed by one worker. The owner takes from the front,
+    // other workers steal from the back.
+    struct WorkRange
+    {
+        std::mutex mutex;
+        size_t next = 0;
+        size_t end = 0;
+    };
+
+    bool TakeNext(WorkRange& range, size_t& index)
+    {
+        std::lock_guard<std::mutex> lock(range.mutex);
+        if (range.next == range.end)
+        {
+            return false;
+        }
+        index = range.next++;
+        return true;
+    }
+
+    bool StealInto(std::vector<WorkRange>& ranges, size_t thief)
+    {
+        for (size_t offset = 1; offset < ranges.size(); ++offset)
+        {
+            WorkRange& victim = ranges[(thief + offset) % ranges.size()];
+            size_t stolenBegin;
+            size_t stolenEnd;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                const size_t remaining = victim.end - victim.next;
+                if (remaining == 0)
+                {
+                    continue;
+                }
+                stolenEnd = victim.end;
+                stolenBegin = victim.end - (remaining + 1) / 2;
+                victim.end = stolenBegin;
+            }
+
+            std::lock_guard<std::mutex> lock(ranges[thief].mutex);
+            ranges[thief].next = stolenBegin;
+            ranges[thief].end = stolenEnd;
+            return true;
+        }
+        return false;
+    }
+
+    // Workers started for a batch. They are joined on the way out however Parse leaves, as
+    // destroying a joinable std::thread terminates the process.
+    class WorkerThreads
+    {
+    public:
+        WorkerThreads() = default;
+        WorkerThreads(const WorkerThreads&) = delete;
+        WorkerThreads& operator=(const WorkerThreads&) = delete;
+        ~WorkerThreads() { JoinAll(); }
+
+        template <typename Work>
+        void Start(size_t count, const Work& work)
+        {
+            m_threads.reserve(count - 1);
+            for (size_t worker = 1; worker < count; ++worker)
+            {
+                m_threads.emplace_back(work, worker);
+            }
+        }
+
+        void JoinAll()
+        {
+            for (auto& thread : m_threads)
+            {
+                if (thread.joinable())
+                {
+                    thread.join();
+                }
+            }
+        }
+
+    private:
+        std::vector<std::thread> m_threads;
+    };
+}
+
+BatchParseResult::BatchParseResult()
+{
+}
+
+BatchParseResult::BatchParseResult(std::shared_ptr<ParseResult> parseResult) :
+    m_parseResult(parseResult)
+{
+}
+
+BatchParseResult::BatchParseResult(std::exception_ptr exception) :
+    m_exception(exception)
+{
+}
+
+bool BatchParseResult::Succeeded() const
+{
+    return m_exception == nullptr;
+}
+
+std::shared_ptr<ParseResult> BatchParseResult::GetParseResult() const
+{
+    if (m_exception != nullptr)
+    {
+        std::rethrow_exception(m_exception);
+    }
+    return m_parseResult;
+}
+
+std::exception_ptr BatchParseResult::GetException() const
+{
+    return m_exception;
+}
+
+CardBatchParser::CardBatchParser(
+    unsigned int workerCount,
+    double rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration) :
+    m_workerCount(workerCount),
+    m_rendererVersion(rendererVersion),
+    m_elementParserRegistration(elementParserRegistration),
+    m_actionParserRegistration(actionParserRegistration)
+{
+    if (m_workerCount == 0)
+    {
+        m_workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (m_elementParserRegistration == nullptr)
+    {
+        m_elementParserRegistration = ElementParserRegistration::GetDefault();
+    }
+    if (m_actionParserRegistration == nullptr)
+    {
+        m_actionParserRegistration = ActionParserRegistration::GetDefault();
+    }
+}
+
+std::vector<BatchParseResult> CardBatchParser::Parse(const std::vector<std::string>& jsonStrings) const
+{
+    return Parse(jsonStrings.data(), jsonStrings.data() + jsonStrings.size());
+}
+
+std::vector<BatchParseResult> CardBatchParser::Parse(const std::string* begin, const std::string* end) const
+{
+    const size_t count = end - begin;
+    std::vector<BatchParseResult> results(count);
+    const size_t workerCount = std::min<size_t>(m_workerCount, count);
+    if (workerCount == 0)
+    {
+        return results;
+    }
+
+    std::vector<WorkRange> ranges(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        ranges[i].next = count * i / workerCount;
+        ranges[i].end = count * (i + 1) / workerCount;
+    }
+
+    auto work = [&](size_t worker)
+    {
+        size_t index;
+        for (;;)
+        {
+            if (!TakeNext(ranges[worker], index))
+            {
+                if (!StealInto(ranges, worker))
+                {
+                    return;
+                }
+                continue;
+            }
+
+            try
+            {
+                results[index] = BatchParseResult(AdaptiveCard::DeserializeFromString(
+                    begin[index], m_rendererVersion, m_elementParserRegistration, m_actionParserRegistration));
+            }
+            catch (...)
+            {
+                results[index] = BatchParseResult(std::current_exception());
+            }
+        }
+    };
+
+    WorkerThreads threads;
+    try
+    {
+        threads.Start(workerCount, work);
+    }
+    catch (...)
+    {
+        // Carry on with the threads we have, whether a thread could not be created or memory
+        // ran out; the shares of the workers that could not be started are stolen by the others
+    }
+
+    // The calling thread works on the first share itself
+    work(0);
+
+    threads.JoinAll();
+    return results;
+}
+
+unsigned int CardBatchParser::GetWorkerCount() const
+{
+    return m_workerCount;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "pch.h"
+#include "ParseResult.h"
+#include "ElementParserRegistration.h"
+#include "ActionParserRegistration.h"
+
+AdaptiveSharedNamespaceStart
+
+// Outcome of deserializing one card of a batch: either its ParseResult or the exception that
+// deserializing it threw
+class BatchParseResult
+{
+public:
+    BatchParseResult();
+    BatchParseResult(std::shared_ptr<ParseResult> parseResult);
+    BatchParseResult(std::exception_ptr exception);
+
+    bool Succeeded() const;
+
+    // Returns the parse result, or rethrows the captured exception if the card failed to parse
+    std::shared_ptr<ParseResult> GetParseResult() const;
+    std::exception_ptr GetException() const;
+
+private:
+    std::shared_ptr<ParseResult> m_parseResult;
+    std::exception_ptr m_exception;
+};
+
+// Deserializes batches of cards on several threads. Each worker starts on an equal share of the
+// batch and steals half of the remaining share of another worker once its own runs out, so a few
+// expensive cards do not hold up the rest of the batch. Results are returned in input order.
+//
+// The parser registrations are shared by all workers and must not be modified while a batch is
+// being parsed; when none are given the read-only defaults are used.
+class CardBatchParser
+{
+public:
+    // A worker count of 0 uses one worker per hardware thread
+    CardBatchParser(
+        unsigned int workerCount,
+        double rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr);
+
+    std::vector<BatchParseResult> Parse(const std::vector<std::string>& jsonStrings) const;
+    std::vector<BatchParseResult> Parse(const std::string* begin, const std::string* end) const;
+
+    unsigned int GetWorkerCount() const;
+
+private:
+    unsigned int m_workerCount;
+    double m_rendererVersion;
+    std::shared_ptr<ElementParserRegistration> m_elementParserRegistration;
+    std::shared_ptr<ActionParserRegistration> m_actionParserRegistration;
+};
+
+AdaptiveSharedNamespaceEnd
@@ -0,0 +1,46 @@
+#include "pch.h"
+#include "CardProbe.h"
+#include <cerrno>
+#include <cstdlib>
+
+using namespace AdaptiveSharedNamespace;
+
+CardVersion::CardVersion() :
+    value(0)
+{
+}
+
+bool CardVersion::TryParse(const std::string& value, CardVersion& version)
+{
+    // Same parse as std::stod, without using exceptions to report failures
+    char* valueEnd;
+    errno = 0;
+    const double parsedValue = std::strtod(value.c_str(), &valueEnd);
+    if (valueEnd == value.c_str() || errno == ERANGE)
+    {
+        return false;
+    }
+
+    version.value = parsedValue;
+    return true;
+}
+
+bool CardVersion::IsNewerThan(double rendererVersion) const
+{
+    return rendererVersion < value;
+}
+
+CardProbe::CardProbe() :
+    hasValidVersion(false)
+{
+}
+
+bool CardProbe::IsSupportedBy(double rendererVersion) const
+{
+    if (rendererVersion == std::numeric_limits<double>::max())
+    {
+        return true;
+    }
+
+    return hasValidVersion && !parsedVersion.IsNewerThan(rendererVersion);
+}
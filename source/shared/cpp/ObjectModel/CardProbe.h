@@ -0,0 +1,40 @@
+#pragma once
+
+#include "pch.h"
+
+AdaptiveSharedNamespaceStart
+
+// A card's version as AdaptiveCard::Deserialize compares it against the renderer version. Both
+// Deserialize and Probe read it with TryParse, so that they agree on every version string.
+struct CardVersion
+{
+    CardVersion();
+
+    // Reads the number value starts with, as std::strtod does, ignoring anything after it. Returns
+    // false if value doesn't start with a number or the number is out of range.
+    static bool TryParse(const std::string& value, CardVersion& version);
+
+    // True if a renderer of rendererVersion would show the fallback text instead of this version
+    bool IsNewerThan(double rendererVersion) const;
+
+    double value;
+};
+
+// The card level metadata of a payload, as read by AdaptiveCard::Probe
+struct CardProbe
+{
+    CardProbe();
+
+    // True if Deserialize for rendererVersion would parse the card rather than return a fallback
+    // text card or fail on the version
+    bool IsSupportedBy(double rendererVersion) const;
+
+    std::string version;
+    bool hasValidVersion;
+    CardVersion parsedVersion;
+    std::string fallbackText;
+    std::string language;
+    std::string speak;
+};
+
+AdaptiveSharedNamespaceEnd
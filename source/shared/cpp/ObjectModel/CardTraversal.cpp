@@ -0,0 +1,134 @@
+#include "pch.h"
+#include "CardTraversal.h"
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    struct TraversalState
+    {
+        std::vector<CardTraversal::Task> tasks;
+        bool isIsolated;
+    };
+
+    // Owned by the outermost RunNow and the outermost Release on each thread. Plain pointers, so
+    // that nodes destroyed after the thread's other thread_local objects can still be released.
+    thread_local TraversalState* s_traversal = nullptr;
+    thread_local std::vector<std::shared_ptr<void>>* s_released = nullptr;
+
+    // Drops whatever a drain leaves behind when a task throws, and restores the state it found
+    class DrainGuard
+    {
+    public:
+        DrainGuard(TraversalState& state, bool ownsState) :
+            m_state(state),
+            m_base(state.tasks.size()),
+            m_wasIsolated(state.isIsolated),
+            m_ownsState(ownsState)
+        {
+            m_state.isIsolated = false;
+        }
+
+        ~DrainGuard()
+        {
+            m_state.tasks.resize(m_base);
+            m_state.isIsolated = m_wasIsolated;
+            if (m_ownsState)
+            {
+                s_traversal = nullptr;
+            }
+        }
+
+        size_t GetBase() const
+        {
+            return m_base;
+        }
+
+    private:
+        TraversalState& m_state;
+        size_t m_base;
+        bool m_wasIsolated;
+        bool m_ownsState;
+    };
+}
+
+void CardTraversal::Schedule(Task task)
+{
+    if (!IsDeferring())
+    {
+        RunNow(std::move(task));
+        return;
+    }
+
+    s_traversal->tasks.push_back(std::move(task));
+}
+
+void CardTraversal::RunNow(Task task)
+{
+    TraversalState ownState;
+    const bool ownsState = (s_traversal == nullptr);
+    if (ownsState)
+    {
+        ownState.isIsolated = false;
+        s_traversal = &ownState;
+    }
+
+    TraversalState& state = *s_traversal;
+    DrainGuard guard(state, ownsState);
+    state.tasks.push_back(std::move(task));
+    while (state.tasks.size() > guard.GetBase())
+    {
+        Task current = std::move(state.tasks.back());
+        state.tasks.pop_back();
+
+        const size_t scheduledBegin = state.tasks.size();
+        current();
+
+        // The stack runs last in, first out; flip what the task scheduled so it runs in order
+        std::reverse(state.tasks.begin() + scheduledBegin, state.tasks.end());
+    }
+}
+
+bool CardTraversal::IsDeferring()
+{
+    return s_traversal != nullptr && !s_traversal->isIsolated;
+}
+
+CardTraversal::Isolation::Isolation(bool isActive) :
+    m_isActive(isActive && s_traversal != nullptr),
+    m_wasIsolated(m_isActive && s_traversal->isIsolated)
+{
+    if (m_isActive)
+    {
+        s_traversal->isIsolated = true;
+    }
+}
+
+CardTraversal::Isolation::~Isolation()
+{
+    if (m_isActive)
+    {
+        s_traversal->isIsolated = m_wasIsolated;
+    }
+}
+
+void CardTraversal::Release(std::shared_ptr<void> node)
+{
+    if (s_released != nullptr)
+    {
+        s_released->push_back(std::move(node));
+        return;
+    }
+
+    // Nodes destroyed here release their own children into the list instead of recursing
+    std::vector<std::shared_ptr<void>> released;
+    released.push_back(std::move(node));
+    s_released = &released;
+    while (!released.empty())
+    {
+        std::shared_ptr<void> current = std::move(released.back());
+        released.pop_back();
+        current.reset();
+    }
+    s_released = nullptr;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "pch.h"
+
+AdaptiveSharedNamespaceStart
+
+// Runs the walks over a card's tree (parsing, serialization, resource gathering and language
+// propagation) on an explicit stack instead of the call stack, so that the depth of a card is
+// bounded by memory rather than by the stack of the calling thread.
+//
+// Each node's share of a walk runs as a task. Tasks a task schedules run after it returns, in the
+// order they were scheduled and before anything else still pending, which keeps walks depth first
+// and in document order: a node schedules its children, then whatever has to follow them.
+// Scheduling outside of a task runs the task, and everything it schedules, right away.
+class CardTraversal
+{
+public:
+    typedef std::function<void()> Task;
+
+    static void Schedule(Task task);
+
+    // Runs task and everything it schedules before returning, even from inside another task.
+    // For callers that need the result of a walk straight away.
+    static void RunNow(Task task);
+
+    // True if Schedule would queue the task rather than run it right away
+    static bool IsDeferring();
+
+    // Makes Schedule run tasks right away for its lifetime, if isActive. Used around code that
+    // expects the objects it works on to be complete when a call returns, such as custom parsers.
+    class Isolation
+    {
+    public:
+        explicit Isolation(bool isActive = true);
+        ~Isolation();
+        Isolation(const Isolation&) = delete;
+        Isolation& operator=(const Isolation&) = delete;
+
+    private:
+        bool m_isActive;
+        bool m_wasIsolated;
+    };
+
+    // Destroys nodes one at a time rather than recursively. Called by the destructors of nodes
+    // with children, so that freeing a deep card does not recurse once per level.
+    static void Release(std::shared_ptr<void> node);
+
+    template <typename T>
+    static void Release(std::vector<std::shared_ptr<T>>& nodes);
+
+private:
+    CardTraversal();
+};
+
+template <typename T>
+void CardTraversal::Release(std::vector<std::shared_ptr<T>>& nodes)
+{
+    for (auto& node : nodes)
+    {
+        Release(std::move(node));
+    }
+    nodes.clear();
+}
+
+AdaptiveSharedNamespaceEnd
@@ -0,0 +1,502 @@
+#include "pch.h"
+#include "CardTree.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "FactSet.h"
+#include "ImageSet.h"
+#include "ShowCardAction.h"
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    template <typename T>
+    CardNode GetItem(const void* items, size_t index)
+    {
+        return CardNode(*(*static_cast<const std::vector<std::shared_ptr<T>>*>(items))[index]);
+    }
+
+    template <typename T>
+    CardNode GetSingle(const void* node, size_t)
+    {
+        return CardNode(*static_cast<T*>(const_cast<void*>(node)));
+    }
+
+    // Sets run to the nodes in items from index on, if there are any
+    template <typename T, typename Run>
+    bool SetItemRun(const std::vector<std::shared_ptr<T>>& items, size_t index, Run& run)
+    {
+        if (index >= items.size())
+        {
+            return false;
+        }
+
+        run.items = &items;
+        run.getItem = GetItem<T>;
+        run.next = index;
+        run.end = items.size();
+        return true;
+    }
+
+    // Sets run to node alone, if there is one
+    template <typename T, typename Run>
+    bool SetSingleRun(const std::shared_ptr<T>& node, Run& run)
+    {
+        if (node == nullptr)
+        {
+            return false;
+        }
+
+        run.items = node.get();
+        run.getItem = GetSingle<T>;
+        run.next = 0;
+        run.end = 1;
+        return true;
+    }
+
+    // Sets run to the nodes in items from index on, or past them to the select action of owner.
+    // The select action is only copied out of owner once the items are done.
+    template <typename T, typename Owner, typename Run>
+    bool SetItemOrSelectActionRun(const std::vector<std::shared_ptr<T>>& items, const Owner& owner, size_t index, Run& run)
+    {
+        if (index < items.size())
+        {
+            return SetItemRun(items, index, run);
+        }
+        return (index == items.size()) && SetSingleRun(owner.GetSelectAction(), run);
+    }
+
+    bool VisitNode(CardVisitor& visitor, const CardNode& node)
+    {
+        switch (node.GetType())
+        {
+        case CardNodeType::Card:
+            return visitor.Visit(*node.GetCard());
+        case CardNodeType::Element:
+            return visitor.Visit(*node.GetElement());
+        case CardNodeType::Action:
+            return visitor.Visit(*node.GetAction());
+        default:
+            visitor.Visit(*node.GetFact());
+            return false;
+        }
+    }
+
+    void EndVisitNode(CardVisitor& visitor, const CardNode& node)
+    {
+        switch (node.GetType())
+        {
+        case CardNodeType::Card:
+            visitor.EndVisit(*node.GetCard());
+            break;
+        case CardNodeType::Element:
+            visitor.EndVisit(*node.GetElement());
+            break;
+        case CardNodeType::Action:
+            visitor.EndVisit(*node.GetAction());
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+CardNode::CardNode() :
+    m_type(CardNodeType::Card),
+    m_object(nullptr)
+{
+}
+
+CardNode::CardNode(AdaptiveCard& card) :
+    m_type(CardNodeType::Card),
+    m_object(&card)
+{
+}
+
+CardNode::CardNode(BaseCardElement& element) :
+    m_type(CardNodeType::Element),
+    m_object(&element)
+{
+}
+
+CardNode::CardNode(BaseActionElement& action) :
+    m_type(CardNodeType::Action),
+    m_object(&action)
+{
+}
+
+CardNode::CardNode(Fact& fact) :
+    m_type(CardNodeType::Fact),
+    m_object(&fact)
+{
+}
+
+CardNodeType CardNode::GetType() const
+{
+    return m_type;
+}
+
+AdaptiveCard* CardNode::GetCard() const
+{
+    return (m_type == CardNodeType::Card) ? static_cast<AdaptiveCard*>(m_object) : nullptr;
+}
+
+BaseCardElement* CardNode::GetElement() const
+{
+    return (m_type == CardNodeType::Element) ? static_cast<BaseCardElement*>(m_object) : nullptr;
+}
+
+BaseActionElement* CardNode::GetAction() const
+{
+    return (m_type == CardNodeType::Action) ? static_cast<BaseActionElement*>(m_object) : nullptr;
+}
+
+Fact* CardNode::GetFact() const
+{
+    return (m_type == CardNodeType::Fact) ? static_cast<Fact*>(m_object) : nullptr;
+}
+
+bool CardNode::IsNull() const
+{
+    return m_object == nullptr;
+}
+
+bool CardNode::operator==(const CardNode& other) const
+{
+    return m_object == other.m_object && (m_object == nullptr || m_type == other.m_type);
+}
+
+bool CardNode::operator!=(const CardNode& other) const
+{
+    return !(*this == other);
+}
+
+CardVisitor::~CardVisitor()
+{
+}
+
+bool CardVisitor::Visit(AdaptiveCard&)
+{
+    return true;
+}
+
+bool CardVisitor::Visit(BaseCardElement&)
+{
+    return true;
+}
+
+bool CardVisitor::Visit(BaseActionElement&)
+{
+    return true;
+}
+
+void CardVisitor::Visit(Fact&)
+{
+}
+
+void CardVisitor::EndVisit(AdaptiveCard&)
+{
+}
+
+void CardVisitor::EndVisit(BaseCardElement&)
+{
+}
+
+void CardVisitor::EndVisit(BaseActionElement&)
+{
+}
+
+CardTree::Iterator::Iterator() :
+    m_order(CardTreeOrder::PreOrder),
+    m_isLeaving(false),
+    m_isSkippingChildren(false),
+    m_isFiltered(false),
+    m_filterType(CardNodeType::Card),
+    m_filterSubtype(-1)
+{
+}
+
+CardTree::Iterator::Iterator(const CardNode& root, CardTreeOrder order, bool isFiltered, CardNodeType filterType, int filterSubtype) :
+    m_order(order),
+    m_isLeaving(false),
+    m_isSkippingChildren(false),
+    m_isFiltered(isFiltered),
+    m_filterType(filterType),
+    m_filterSubtype(filterSubtype)
+{
+    // Room for the levels of most cards, so that walking them allocates once
+    m_stack.reserve(16);
+    m_stack.push_back({ root, 0, ChildRun() });
+    if (!IsReported())
+    {
+        ++(*this);
+    }
+}
+
+const CardNode& CardTree::Iterator::operator*() const
+{
+    return m_stack.back().node;
+}
+
+const CardNode* CardTree::Iterator::operator->() const
+{
+    return &m_stack.back().node;
+}
+
+CardTree::Iterator& CardTree::Iterator::operator++()
+{
+    if (m_order == CardTreeOrder::PostOrder)
+    {
+        do
+        {
+            Step();
+        } while (!m_stack.empty() && !IsReported());
+        return *this;
+    }
+
+    // In pre-order nodes are only reported as they are entered, so the walk goes straight into the
+    // first child of the current node, or else on to the next sibling of it or of a node above it
+    do
+    {
+        const bool isSkipping = m_isSkippingChildren;
+        m_isSkippingChildren = false;
+        if (isSkipping || !PushNextChild())
+        {
+            do
+            {
+                m_stack.pop_back();
+            } while (!m_stack.empty() && !PushNextChild());
+        }
+    } while (!m_stack.empty() && !IsReported());
+    return *this;
+}
+
+CardTree::Iterator CardTree::Iterator::operator++(int)
+{
+    Iterator previous = *this;
+    ++(*this);
+    return previous;
+}
+
+bool CardTree::Iterator::operator==(const Iterator& other) const
+{
+    if (m_stack.size() != other.m_stack.size())
+    {
+        return false;
+    }
+    return m_stack.empty() || (m_stack.back().node == other.m_stack.back().node && m_isLeaving == other.m_isLeaving);
+}
+
+bool CardTree::Iterator::operator!=(const Iterator& other) const
+{
+    return !(*this == other);
+}
+
+unsigned int CardTree::Iterator::GetDepth() const
+{
+    return static_cast<unsigned int>(m_stack.size() - 1);
+}
+
+void CardTree::Iterator::SkipChildren()
+{
+    m_isSkippingChildren = true;
+}
+
+void CardTree::Iterator::Step()
+{
+    if (!m_isLeaving)
+    {
+        // Entered the node on top; go into its first child, or leave it if there is none
+        const bool isSkipping = m_isSkippingChildren;
+        m_isSkippingChildren = false;
+        if (isSkipping || !PushNextChild())
+        {
+            m_isLeaving = true;
+        }
+        return;
+    }
+
+    // Left the node on top; go on to its next sibling, or leave its parent
+    m_stack.pop_back();
+    if (!m_stack.empty() && PushNextChild())
+    {
+        m_isLeaving = false;
+    }
+}
+
+bool CardTree::Iterator::PushNextChild()
+{
+    Frame& parent = m_stack.back();
+    if (parent.run.next == parent.run.end && !GetChildRun(parent.node, parent.nextChild, parent.run))
+    {
+        return false;
+    }
+
+    const CardNode child = parent.run.getItem(parent.run.items, parent.run.next++);
+    ++parent.nextChild;
+    m_stack.push_back({ child, 0, ChildRun() });
+    return true;
+}
+
+bool CardTree::Iterator::IsReported() const
+{
+    if (m_isLeaving != (m_order == CardTreeOrder::PostOrder))
+    {
+        return false;
+    }
+    if (!m_isFiltered)
+    {
+        return true;
+    }
+
+    const CardNode& node = m_stack.back().node;
+    if (node.GetType() != m_filterType)
+    {
+        return false;
+    }
+    if (m_filterSubtype < 0)
+    {
+        return true;
+    }
+    return (m_filterType == CardNodeType::Element) ?
+        static_cast<int>(node.GetElement()->GetElementType()) == m_filterSubtype :
+        static_cast<int>(node.GetAction()->GetElementType()) == m_filterSubtype;
+}
+
+CardTree::Range::Range(const Iterator& begin) :
+    m_begin(begin)
+{
+}
+
+CardTree::Iterator CardTree::Range::begin() const
+{
+    return m_begin;
+}
+
+CardTree::Iterator CardTree::Range::end() const
+{
+    return Iterator();
+}
+
+CardTree::CardTree(AdaptiveCard& root, CardTreeOrder order) :
+    m_root(root),
+    m_order(order)
+{
+}
+
+CardTree::CardTree(BaseCardElement& root, CardTreeOrder order) :
+    m_root(root),
+    m_order(order)
+{
+}
+
+CardTree::CardTree(BaseActionElement& root, CardTreeOrder order) :
+    m_root(root),
+    m_order(order)
+{
+}
+
+CardTree::Iterator CardTree::begin() const
+{
+    return Iterator(m_root, m_order, false, CardNodeType::Card, -1);
+}
+
+CardTree::Iterator CardTree::end() const
+{
+    return Iterator();
+}
+
+CardTree::Range CardTree::OfType(CardNodeType type) const
+{
+    return Range(Iterator(m_root, m_order, true, type, -1));
+}
+
+CardTree::Range CardTree::OfType(CardElementType type) const
+{
+    return Range(Iterator(m_root, m_order, true, CardNodeType::Element, static_cast<int>(type)));
+}
+
+CardTree::Range CardTree::OfType(ActionType type) const
+{
+    return Range(Iterator(m_root, m_order, true, CardNodeType::Action, static_cast<int>(type)));
+}
+
+void CardTree::Accept(CardVisitor& visitor) const
+{
+    Iterator walk;
+    walk.m_stack.push_back({ m_root, 0, ChildRun() });
+    while (!walk.m_stack.empty())
+    {
+        const CardNode& node = walk.m_stack.back().node;
+        if (walk.m_isLeaving)
+        {
+            EndVisitNode(visitor, node);
+        }
+        else if (!VisitNode(visitor, node))
+        {
+            walk.SkipChildren();
+        }
+        walk.Step();
+    }
+}
+
+CardNode CardTree::GetChild(const CardNode& node, size_t index)
+{
+    ChildRun run;
+    return GetChildRun(node, index, run) ? run.getItem(run.items, run.next) : CardNode();
+}
+
+bool CardTree::GetChildRun(const CardNode& node, size_t index, ChildRun& run)
+{
+    switch (node.GetType())
+    {
+    case CardNodeType::Card:
+    {
+        AdaptiveCard& card = *node.GetCard();
+        const auto& body = card.GetBody();
+        if (index < body.size())
+        {
+            return SetItemRun(body, index, run);
+        }
+        return SetItemOrSelectActionRun(card.GetActions(), card, index - body.size(), run);
+    }
+    case CardNodeType::Element:
+    {
+        BaseCardElement& element = *node.GetElement();
+        switch (element.GetElementType())
+        {
+        case CardElementType::Container:
+        {
+            const Container& container = static_cast<const Container&>(element);
+            return SetItemOrSelectActionRun(container.GetItems(), container, index, run);
+        }
+        case CardElementType::Column:
+        {
+            const Column& column = static_cast<const Column&>(element);
+            return SetItemOrSelectActionRun(column.GetItems(), column, index, run);
+        }
+        case CardElementType::ColumnSet:
+        {
+            const ColumnSet& columnSet = static_cast<const ColumnSet&>(element);
+            return SetItemOrSelectActionRun(columnSet.GetColumns(), columnSet, index, run);
+        }
+        case CardElementType::ImageSet:
+            return SetItemRun(static_cast<const ImageSet&>(element).GetImages(), index, run);
+        case CardElementType::FactSet:
+            return SetItemRun(static_cast<const FactSet&>(element).GetFacts(), index, run);
+        case CardElementType::Image:
+            return (index == 0) && SetSingleRun(static_cast<const Image&>(element).GetSelectAction(), run);
+        default:
+            return false;
+        }
+    }
+    case CardNodeType::Action:
+    {
+        BaseActionElement& action = *node.GetAction();
+        return (index == 0) && (action.GetElementType() == ActionType::ShowCard) &&
+            SetSingleRun(static_cast<const ShowCardAction&>(action).GetCard(), run);
+    }
+    default:
+        return false;
+    }
+}
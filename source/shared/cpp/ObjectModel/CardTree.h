@@ -0,0 +1,192 @@
+#pragma once
+
+#include "pch.h"
+#include "Enums.h"
+#include <iterator>
+
+AdaptiveSharedNamespaceStart
+class AdaptiveCard;
+class BaseCardElement;
+class BaseActionElement;
+class Fact;
+
+enum class CardNodeType
+{
+    Card = 0,
+    Element,
+    Action,
+    Fact,
+};
+
+// A card, element, action or fact in a card tree, referred to without being owned
+class CardNode
+{
+public:
+    CardNode();
+    explicit CardNode(AdaptiveCard& card);
+    explicit CardNode(BaseCardElement& element);
+    explicit CardNode(BaseActionElement& action);
+    explicit CardNode(Fact& fact);
+
+    CardNodeType GetType() const;
+
+    // The object the node refers to, or null if the node is of another type
+    AdaptiveCard* GetCard() const;
+    BaseCardElement* GetElement() const;
+    BaseActionElement* GetAction() const;
+    Fact* GetFact() const;
+
+    bool IsNull() const;
+    bool operator==(const CardNode& other) const;
+    bool operator!=(const CardNode& other) const;
+
+private:
+    CardNodeType m_type;
+    void* m_object;
+};
+
+// Callbacks for CardTree::Accept. Visit is called for a node before what is nested in it, and
+// EndVisit after; returning false from Visit skips what is nested in the node, but not its EndVisit.
+class CardVisitor
+{
+public:
+    virtual ~CardVisitor();
+
+    virtual bool Visit(AdaptiveCard& card);
+    virtual bool Visit(BaseCardElement& element);
+    virtual bool Visit(BaseActionElement& action);
+    virtual void Visit(Fact& fact);
+
+    virtual void EndVisit(AdaptiveCard& card);
+    virtual void EndVisit(BaseCardElement& element);
+    virtual void EndVisit(BaseActionElement& action);
+};
+
+enum class CardTreeOrder
+{
+    PreOrder = 0,
+    PostOrder,
+};
+
+// Walks the tree under a card, element or action, in document order:
+//  - the body, actions and select action of cards
+//  - the items and select action of Containers and Columns
+//  - the columns and select action of ColumnSets
+//  - the images of ImageSets, the facts of FactSets and the select action of Images
+//  - the card of Action.ShowCard
+//
+// Nodes are reached in place, without copying the collections that hold them or their
+// shared_ptrs, and the collection that holds the children of a node is looked up once for all of
+// them. The walk keeps its own stack of one entry per level, so it is bounded by memory rather
+// than by the call stack. The tree must not change while it is walked. Reaching the card of an
+// Action.ShowCard whose parsing was deferred parses it; skip the children of the action to avoid
+// that.
+class CardTree
+{
+private:
+    // Children of a node that follow one another, items next to end of getItem(items, index),
+    // where items is either a vector of shared_ptrs or a single node
+    struct ChildRun
+    {
+        const void* items;
+        CardNode (*getItem)(const void* items, size_t index);
+        size_t next;
+        size_t end;
+    };
+
+public:
+    class Iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef CardNode value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const CardNode* pointer;
+        typedef const CardNode& reference;
+
+        // The end of every walk
+        Iterator();
+
+        const CardNode& operator*() const;
+        const CardNode* operator->() const;
+        Iterator& operator++();
+        Iterator operator++(int);
+        bool operator==(const Iterator& other) const;
+        bool operator!=(const Iterator& other) const;
+
+        // Levels between the current node and the root, which is at 0
+        unsigned int GetDepth() const;
+
+        // In pre-order, keeps the walk out of what is nested in the current node
+        void SkipChildren();
+
+    private:
+        friend class CardTree;
+
+        struct Frame
+        {
+            CardNode node;
+            size_t nextChild;
+
+            // The run holding the child at nextChild, unless it is used up
+            ChildRun run;
+        };
+
+        Iterator(const CardNode& root, CardTreeOrder order, bool isFiltered, CardNodeType filterType, int filterSubtype);
+
+        // Moves to the next time the walk enters or leaves a node
+        void Step();
+        bool PushNextChild();
+        bool IsReported() const;
+
+        std::vector<Frame> m_stack;
+        CardTreeOrder m_order;
+        bool m_isLeaving;
+        bool m_isSkippingChildren;
+
+        // Only nodes of this type are reported, and of this CardElementType or ActionType unless negative
+        bool m_isFiltered;
+        CardNodeType m_filterType;
+        int m_filterSubtype;
+    };
+
+    // Iterators over the nodes of one type, from CardTree::OfType
+    class Range
+    {
+    public:
+        Range(const Iterator& begin);
+
+        Iterator begin() const;
+        Iterator end() const;
+
+    private:
+        Iterator m_begin;
+    };
+
+    explicit CardTree(AdaptiveCard& root, CardTreeOrder order = CardTreeOrder::PreOrder);
+    explicit CardTree(BaseCardElement& root, CardTreeOrder order = CardTreeOrder::PreOrder);
+    explicit CardTree(BaseActionElement& root, CardTreeOrder order = CardTreeOrder::PreOrder);
+
+    Iterator begin() const;
+    Iterator end() const;
+
+    // Only the nodes of one type, or only the elements or actions of one type
+    Range OfType(CardNodeType type) const;
+    Range OfType(CardElementType type) const;
+    Range OfType(ActionType type) const;
+
+    // Calls visitor for every node, whatever the order of the tree
+    void Accept(CardVisitor& visitor) const;
+
+    // The node nested at index in node, in document order, or a null node past the last one
+    static CardNode GetChild(const CardNode& node, size_t index);
+
+private:
+    // The run of the children of node that starts with the one at index, or false past the last one
+    static bool GetChildRun(const CardNode& node, size_t index, ChildRun& run);
+
+    CardNode m_root;
+    CardTreeOrder m_order;
+};
+
+AdaptiveSharedNamespaceEnd
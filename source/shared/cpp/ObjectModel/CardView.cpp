@@ -0,0 +1,778 @@
+#include "pch.h"
+#include "CardView.h"
+#include <cstring>
+
+using namespace AdaptiveSharedNamespace;
+using namespace AdaptiveSharedNamespace::BinaryCardFormat;
+
+namespace
+{
+    struct Field
+    {
+        AdaptiveCardSchemaKey key;
+        FieldKind kind;
+    };
+
+    struct Schema
+    {
+        const Field* fields;
+        size_t count;
+    };
+
+    template <size_t N>
+    Schema MakeSchema(const Field (&fields)[N])
+    {
+        return { fields, N };
+    }
+
+    // Field order of each record, as written by BinaryCardWriter. The additional properties of
+    // elements and actions have no schema key; they are filed under Type, which is never looked up
+    // with that kind.
+    const Field c_elementFields[] = {
+        { AdaptiveCardSchemaKey::Type, StringField },
+        { AdaptiveCardSchemaKey::Spacing, VarintField },
+        { AdaptiveCardSchemaKey::Separator, BoolField },
+        { AdaptiveCardSchemaKey::Id, StringField },
+        { AdaptiveCardSchemaKey::Type, LengthPrefixedField } };
+
+    const Field c_inputFields[] = {
+        { AdaptiveCardSchemaKey::IsRequired, BoolField } };
+
+    const Field c_textBlockFields[] = {
+        { AdaptiveCardSchemaKey::Text, StringField },
+        { AdaptiveCardSchemaKey::Size, VarintField },
+        { AdaptiveCardSchemaKey::Weight, VarintField },
+        { AdaptiveCardSchemaKey::Color, VarintField },
+        { AdaptiveCardSchemaKey::Wrap, BoolField },
+        { AdaptiveCardSchemaKey::IsSubtle, BoolField },
+        { AdaptiveCardSchemaKey::MaxLines, VarintField },
+        { AdaptiveCardSchemaKey::HorizontalAlignment, VarintField },
+        { AdaptiveCardSchemaKey::Language, StringField } };
+
+    const Field c_imageFields[] = {
+        { AdaptiveCardSchemaKey::Url, StringField },
+        { AdaptiveCardSchemaKey::Style, VarintField },
+        { AdaptiveCardSchemaKey::Size, VarintField },
+        { AdaptiveCardSchemaKey::AltText, StringField },
+        { AdaptiveCardSchemaKey::HorizontalAlignment, VarintField },
+        { AdaptiveCardSchemaKey::Width, VarintField },
+        { AdaptiveCardSchemaKey::Height, VarintField },
+        { AdaptiveCardSchemaKey::SelectAction, RecordField } };
+
+    const Field c_imageSetFields[] = {
+        { AdaptiveCardSchemaKey::ImageSize, VarintField },
+        { AdaptiveCardSchemaKey::Images, LengthPrefixedField } };
+
+    const Field c_containerFields[] = {
+        { AdaptiveCardSchemaKey::Style, VarintField },
+        { AdaptiveCardSchemaKey::SelectAction, RecordField },
+        { AdaptiveCardSchemaKey::Items, LengthPrefixedField } };
+
+    // The varint Width is the explicit pixel width
+    const Field c_columnFields[] = {
+        { AdaptiveCardSchemaKey::Width, StringField },
+        { AdaptiveCardSchemaKey::Width, VarintField },
+        { AdaptiveCardSchemaKey::Style, VarintField },
+        { AdaptiveCardSchemaKey::SelectAction, RecordField },
+        { AdaptiveCardSchemaKey::Items, LengthPrefixedField } };
+
+    const Field c_columnSetFields[] = {
+        { AdaptiveCardSchemaKey::SelectAction, RecordField },
+        { AdaptiveCardSchemaKey::Columns, LengthPrefixedField } };
+
+    const Field c_factSetFields[] = {
+        { AdaptiveCardSchemaKey::Facts, LengthPrefixedField } };
+
+    const Field c_choiceSetFields[] = {
+        { AdaptiveCardSchemaKey::Style, VarintField },
+        { AdaptiveCardSchemaKey::IsMultiSelect, BoolField },
+        { AdaptiveCardSchemaKey::Value, StringField },
+        { AdaptiveCardSchemaKey::Choices, LengthPrefixedField } };
+
+    const Field c_dateTimeFields[] = {
+        { AdaptiveCardSchemaKey::Max, StringField },
+        { AdaptiveCardSchemaKey::Min, StringField },
+        { AdaptiveCardSchemaKey::Placeholder, StringField },
+        { AdaptiveCardSchemaKey::Value, StringField } };
+
+    const Field c_numberFields[] = {
+        { AdaptiveCardSchemaKey::Placeholder, StringField },
+        { AdaptiveCardSchemaKey::Value, VarintField },
+        { AdaptiveCardSchemaKey::Max, VarintField },
+        { AdaptiveCardSchemaKey::Min, VarintField } };
+
+    const Field c_textInputFields[] = {
+        { AdaptiveCardSchemaKey::Placeholder, StringField },
+        { AdaptiveCardSchemaKey::Value, StringField },
+        { AdaptiveCardSchemaKey::IsMultiline, BoolField },
+        { AdaptiveCardSchemaKey::MaxLength, VarintField },
+        { AdaptiveCardSchemaKey::Style, VarintField } };
+
+    const Field c_toggleFields[] = {
+        { AdaptiveCardSchemaKey::Title, StringField },
+        { AdaptiveCardSchemaKey::Value, StringField },
+        { AdaptiveCardSchemaKey::ValueOff, StringField },
+        { AdaptiveCardSchemaKey::ValueOn, StringField } };
+
+    const Field c_actionFields[] = {
+        { AdaptiveCardSchemaKey::Type, StringField },
+        { AdaptiveCardSchemaKey::Title, StringField },
+        { AdaptiveCardSchemaKey::Id, StringField },
+        { AdaptiveCardSchemaKey::IconUrl, StringField },
+        { AdaptiveCardSchemaKey::Type, LengthPrefixedField } };
+
+    const Field c_openUrlFields[] = {
+        { AdaptiveCardSchemaKey::Url, StringField } };
+
+    const Field c_submitFields[] = {
+        { AdaptiveCardSchemaKey::Data, StringField } };
+
+    const Field c_showCardFields[] = {
+        { AdaptiveCardSchemaKey::Card, RecordField } };
+
+    const Field c_cardFields[] = {
+        { AdaptiveCardSchemaKey::Version, StringField },
+        { AdaptiveCardSchemaKey::FallbackText, StringField },
+        { AdaptiveCardSchemaKey::BackgroundImage, StringField },
+        { AdaptiveCardSchemaKey::Speak, StringField },
+        { AdaptiveCardSchemaKey::Language, StringField },
+        { AdaptiveCardSchemaKey::Style, VarintField },
+        { AdaptiveCardSchemaKey::SelectAction, RecordField },
+        { AdaptiveCardSchemaKey::Body, LengthPrefixedField },
+        { AdaptiveCardSchemaKey::Actions, LengthPrefixedField } };
+
+    Schema GetElementSchema(CardElementType type)
+    {
+        switch (type)
+        {
+        case CardElementType::TextBlock:
+            return MakeSchema(c_textBlockFields);
+        case CardElementType::Image:
+            return MakeSchema(c_imageFields);
+        case CardElementType::ImageSet:
+            return MakeSchema(c_imageSetFields);
+        case CardElementType::Container:
+            return MakeSchema(c_containerFields);
+        case CardElementType::Column:
+            return MakeSchema(c_columnFields);
+        case CardElementType::ColumnSet:
+            return MakeSchema(c_columnSetFields);
+        case CardElementType::FactSet:
+            return MakeSchema(c_factSetFields);
+        case CardElementType::ChoiceSetInput:
+            return MakeSchema(c_choiceSetFields);
+        case CardElementType::DateInput:
+        case CardElementType::TimeInput:
+            return MakeSchema(c_dateTimeFields);
+        case CardElementType::NumberInput:
+            return MakeSchema(c_numberFields);
+        case CardElementType::TextInput:
+            return MakeSchema(c_textInputFields);
+        case CardElementType::ToggleInput:
+            return MakeSchema(c_toggleFields);
+        default:
+            return { nullptr, 0 };
+        }
+    }
+
+    Schema GetActionSchema(ActionType type)
+    {
+        switch (type)
+        {
+        case ActionType::OpenUrl:
+            return MakeSchema(c_openUrlFields);
+        case ActionType::Submit:
+            return MakeSchema(c_submitFields);
+        case ActionType::ShowCard:
+            return MakeSchema(c_showCardFields);
+        default:
+            return { nullptr, 0 };
+        }
+    }
+
+    bool IsInput(CardElementType type)
+    {
+        switch (type)
+        {
+        case CardElementType::ChoiceSetInput:
+        case CardElementType::DateInput:
+        case CardElementType::NumberInput:
+        case CardElementType::TextInput:
+        case CardElementType::TimeInput:
+        case CardElementType::ToggleInput:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Moves the cursor to the field, or past all of the schema's fields if it is not there
+    bool SeekField(Cursor& cursor, const Schema& schema, AdaptiveCardSchemaKey key, FieldKind kind)
+    {
+        for (size_t i = 0; i < schema.count; ++i)
+        {
+            if (schema.fields[i].key == key && schema.fields[i].kind == kind)
+            {
+                return true;
+            }
+            cursor.SkipField(schema.fields[i].kind);
+        }
+        return false;
+    }
+
+    // Positions the cursor on the contents of a non-null record
+    Cursor OpenRecord(const Data& data, const char* record)
+    {
+        Cursor cursor(record, data.GetEnd());
+        cursor.ReadByte();
+        const char* end = cursor.ReadLength();
+        return Cursor(cursor.GetPosition(), end);
+    }
+
+    unsigned char GetRecordKind(const Data& data, const char* record)
+    {
+        if (record == nullptr)
+        {
+            return NullRecord;
+        }
+        return Cursor(record, data.GetEnd()).ReadByte();
+    }
+
+    CardStringView ReadString(const Data& data, Cursor& cursor)
+    {
+        const char* value;
+        size_t size;
+        data.GetString(cursor.ReadVarint(), value, size);
+        return CardStringView(value, size);
+    }
+
+    // Looks up a top-level string member of a record that was stored as JSON
+    CardStringView FindJsonString(const Data& data, const char* record, const std::string& name)
+    {
+        Cursor cursor = OpenRecord(data, record);
+        if (cursor.ReadByte() != JsonObject)
+        {
+            return CardStringView();
+        }
+
+        cursor.ReadLength();
+        const unsigned long long count = cursor.ReadVarint();
+        for (unsigned long long i = 0; i < count; ++i)
+        {
+            const CardStringView memberName = ReadString(data, cursor);
+            if (memberName == name)
+            {
+                if (cursor.ReadByte() == JsonString)
+                {
+                    return ReadString(data, cursor);
+                }
+                return CardStringView();
+            }
+            cursor.SkipJson();
+        }
+        return CardStringView();
+    }
+}
+
+CardStringView::CardStringView() :
+    m_data(""),
+    m_size(0)
+{
+}
+
+CardStringView::CardStringView(const char* data, size_t size) :
+    m_data(data),
+    m_size(size)
+{
+}
+
+const char* CardStringView::GetData() const
+{
+    return m_data;
+}
+
+size_t CardStringView::GetSize() const
+{
+    return m_size;
+}
+
+bool CardStringView::IsEmpty() const
+{
+    return m_size == 0;
+}
+
+std::string CardStringView::ToString() const
+{
+    return std::string(m_data, m_size);
+}
+
+bool CardStringView::operator==(const std::string& other) const
+{
+    return other.size() == m_size && memcmp(other.data(), m_data, m_size) == 0;
+}
+
+bool CardStringView::operator!=(const std::string& other) const
+{
+    return !(*this == other);
+}
+
+CardFactView::CardFactView(const Data& data, const char* record) :
+    m_data(data),
+    m_record(record)
+{
+}
+
+CardStringView CardFactView::GetTitle() const
+{
+    Cursor cursor(m_record, m_data.GetEnd());
+    return ReadString(m_data, cursor);
+}
+
+CardStringView CardFactView::GetValue() const
+{
+    Cursor cursor(m_record, m_data.GetEnd());
+    cursor.SkipField(StringField);
+    return ReadString(m_data, cursor);
+}
+
+CardElementView::CardElementView(const Data& data, const char* record) :
+    m_data(data),
+    m_record(record)
+{
+}
+
+bool CardElementView::IsNull() const
+{
+    return GetKind() == NullRecord;
+}
+
+CardElementType CardElementView::GetElementType() const
+{
+    switch (GetKind())
+    {
+    case NativeRecord:
+    {
+        Cursor cursor = OpenRecord(m_data, m_record);
+        return static_cast<CardElementType>(cursor.ReadVarint());
+    }
+    case JsonRecord:
+        return CardElementType::Custom;
+    default:
+        return CardElementType::Unsupported;
+    }
+}
+
+CardStringView CardElementView::GetElementTypeString() const
+{
+    return GetString(AdaptiveCardSchemaKey::Type);
+}
+
+CardStringView CardElementView::GetId() const
+{
+    return GetString(AdaptiveCardSchemaKey::Id);
+}
+
+Spacing CardElementView::GetSpacing() const
+{
+    return static_cast<Spacing>(GetVarint(AdaptiveCardSchemaKey::Spacing, static_cast<unsigned int>(Spacing::Default)));
+}
+
+bool CardElementView::GetSeparator() const
+{
+    return GetBool(AdaptiveCardSchemaKey::Separator, false);
+}
+
+bool CardElementView::GetIsRequired() const
+{
+    return GetBool(AdaptiveCardSchemaKey::IsRequired, false);
+}
+
+CardStringView CardElementView::GetString(AdaptiveCardSchemaKey key) const
+{
+    if (GetKind() == JsonRecord)
+    {
+        return FindJsonString(m_data, m_record, AdaptiveCardSchemaKeyToString(key));
+    }
+
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(key, StringField, cursor))
+    {
+        return CardStringView();
+    }
+    return ReadString(m_data, cursor);
+}
+
+CardStringView CardElementView::GetText() const
+{
+    return GetString(AdaptiveCardSchemaKey::Text);
+}
+
+TextSize CardElementView::GetTextSize() const
+{
+    if (GetElementType() != CardElementType::TextBlock)
+    {
+        return TextSize::Default;
+    }
+    return static_cast<TextSize>(GetVarint(AdaptiveCardSchemaKey::Size, static_cast<unsigned int>(TextSize::Default)));
+}
+
+TextWeight CardElementView::GetTextWeight() const
+{
+    return static_cast<TextWeight>(GetVarint(AdaptiveCardSchemaKey::Weight, static_cast<unsigned int>(TextWeight::Default)));
+}
+
+ForegroundColor CardElementView::GetTextColor() const
+{
+    return static_cast<ForegroundColor>(GetVarint(AdaptiveCardSchemaKey::Color, static_cast<unsigned int>(ForegroundColor::Default)));
+}
+
+bool CardElementView::GetWrap() const
+{
+    return GetBool(AdaptiveCardSchemaKey::Wrap, false);
+}
+
+bool CardElementView::GetIsSubtle() const
+{
+    return GetBool(AdaptiveCardSchemaKey::IsSubtle, false);
+}
+
+unsigned int CardElementView::GetMaxLines() const
+{
+    return static_cast<unsigned int>(GetVarint(AdaptiveCardSchemaKey::MaxLines, 0));
+}
+
+HorizontalAlignment CardElementView::GetHorizontalAlignment() const
+{
+    return static_cast<HorizontalAlignment>(
+        GetVarint(AdaptiveCardSchemaKey::HorizontalAlignment, static_cast<unsigned int>(HorizontalAlignment::Left)));
+}
+
+CardStringView CardElementView::GetLanguage() const
+{
+    return GetString(AdaptiveCardSchemaKey::Language);
+}
+
+CardStringView CardElementView::GetUrl() const
+{
+    return GetString(AdaptiveCardSchemaKey::Url);
+}
+
+CardStringView CardElementView::GetAltText() const
+{
+    return GetString(AdaptiveCardSchemaKey::AltText);
+}
+
+ImageStyle CardElementView::GetImageStyle() const
+{
+    if (GetElementType() != CardElementType::Image)
+    {
+        return ImageStyle::Default;
+    }
+    return static_cast<ImageStyle>(GetVarint(AdaptiveCardSchemaKey::Style, static_cast<unsigned int>(ImageStyle::Default)));
+}
+
+ImageSize CardElementView::GetImageSize() const
+{
+    switch (GetElementType())
+    {
+    case CardElementType::Image:
+        return static_cast<ImageSize>(GetVarint(AdaptiveCardSchemaKey::Size, static_cast<unsigned int>(ImageSize::None)));
+    case CardElementType::ImageSet:
+        return static_cast<ImageSize>(GetVarint(AdaptiveCardSchemaKey::ImageSize, static_cast<unsigned int>(ImageSize::None)));
+    default:
+        return ImageSize::None;
+    }
+}
+
+ContainerStyle CardElementView::GetStyle() const
+{
+    const CardElementType type = GetElementType();
+    if (type != CardElementType::Container && type != CardElementType::Column)
+    {
+        return ContainerStyle::None;
+    }
+    return static_cast<ContainerStyle>(GetVarint(AdaptiveCardSchemaKey::Style, static_cast<unsigned int>(ContainerStyle::None)));
+}
+
+CardStringView CardElementView::GetWidth() const
+{
+    if (GetElementType() != CardElementType::Column)
+    {
+        return CardStringView();
+    }
+    return GetString(AdaptiveCardSchemaKey::Width);
+}
+
+CardActionView CardElementView::GetSelectAction() const
+{
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(AdaptiveCardSchemaKey::SelectAction, RecordField, cursor))
+    {
+        return CardActionView(m_data, nullptr);
+    }
+    return CardActionView(m_data, cursor.GetPosition());
+}
+
+CardListView<CardElementView> CardElementView::GetItems() const
+{
+    Cursor cursor(nullptr, nullptr);
+    if (FindField(AdaptiveCardSchemaKey::Items, LengthPrefixedField, cursor) ||
+        FindField(AdaptiveCardSchemaKey::Columns, LengthPrefixedField, cursor) ||
+        FindField(AdaptiveCardSchemaKey::Images, LengthPrefixedField, cursor))
+    {
+        return CardListView<CardElementView>(m_data, cursor.GetPosition());
+    }
+    return CardListView<CardElementView>();
+}
+
+CardListView<CardFactView> CardElementView::GetFacts() const
+{
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(AdaptiveCardSchemaKey::Facts, LengthPrefixedField, cursor))
+    {
+        return CardListView<CardFactView>();
+    }
+    return CardListView<CardFactView>(m_data, cursor.GetPosition());
+}
+
+unsigned char CardElementView::GetKind() const
+{
+    return GetRecordKind(m_data, m_record);
+}
+
+bool CardElementView::FindField(AdaptiveCardSchemaKey key, FieldKind kind, Cursor& cursor) const
+{
+    if (GetKind() != NativeRecord)
+    {
+        return false;
+    }
+
+    cursor = OpenRecord(m_data, m_record);
+    const CardElementType type = static_cast<CardElementType>(cursor.ReadVarint());
+    return SeekField(cursor, MakeSchema(c_elementFields), key, kind) ||
+        (IsInput(type) && SeekField(cursor, MakeSchema(c_inputFields), key, kind)) ||
+        SeekField(cursor, GetElementSchema(type), key, kind);
+}
+
+unsigned long long CardElementView::GetVarint(AdaptiveCardSchemaKey key, unsigned long long defaultValue) const
+{
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(key, VarintField, cursor))
+    {
+        return defaultValue;
+    }
+    return cursor.ReadVarint();
+}
+
+bool CardElementView::GetBool(AdaptiveCardSchemaKey key, bool defaultValue) const
+{
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(key, BoolField, cursor))
+    {
+        return defaultValue;
+    }
+    return cursor.ReadBool();
+}
+
+CardActionView::CardActionView(const Data& data, const char* record) :
+    m_data(data),
+    m_record(record)
+{
+}
+
+bool CardActionView::IsNull() const
+{
+    return GetKind() == NullRecord;
+}
+
+ActionType CardActionView::GetElementType() const
+{
+    switch (GetKind())
+    {
+    case NativeRecord:
+    {
+        Cursor cursor = OpenRecord(m_data, m_record);
+        return static_cast<ActionType>(cursor.ReadVarint());
+    }
+    case JsonRecord:
+        return ActionType::Custom;
+    default:
+        return ActionType::Unsupported;
+    }
+}
+
+CardStringView CardActionView::GetElementTypeString() const
+{
+    return GetString(AdaptiveCardSchemaKey::Type);
+}
+
+CardStringView CardActionView::GetTitle() const
+{
+    return GetString(AdaptiveCardSchemaKey::Title);
+}
+
+CardStringView CardActionView::GetId() const
+{
+    return GetString(AdaptiveCardSchemaKey::Id);
+}
+
+CardStringView CardActionView::GetIconUrl() const
+{
+    return GetString(AdaptiveCardSchemaKey::IconUrl);
+}
+
+CardStringView CardActionView::GetUrl() const
+{
+    return GetString(AdaptiveCardSchemaKey::Url);
+}
+
+CardStringView CardActionView::GetDataJson() const
+{
+    return GetString(AdaptiveCardSchemaKey::Data);
+}
+
+CardView CardActionView::GetCard() const
+{
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(AdaptiveCardSchemaKey::Card, RecordField, cursor))
+    {
+        return CardView(m_data, nullptr);
+    }
+    return CardView(m_data, cursor.GetPosition());
+}
+
+unsigned char CardActionView::GetKind() const
+{
+    return GetRecordKind(m_data, m_record);
+}
+
+bool CardActionView::FindField(AdaptiveCardSchemaKey key, FieldKind kind, Cursor& cursor) const
+{
+    if (GetKind() != NativeRecord)
+    {
+        return false;
+    }
+
+    cursor = OpenRecord(m_data, m_record);
+    const ActionType type = static_cast<ActionType>(cursor.ReadVarint());
+    return SeekField(cursor, MakeSchema(c_actionFields), key, kind) ||
+        SeekField(cursor, GetActionSchema(type), key, kind);
+}
+
+CardStringView CardActionView::GetString(AdaptiveCardSchemaKey key) const
+{
+    if (GetKind() == JsonRecord)
+    {
+        return FindJsonString(m_data, m_record, AdaptiveCardSchemaKeyToString(key));
+    }
+
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(key, StringField, cursor))
+    {
+        return CardStringView();
+    }
+    return ReadString(m_data, cursor);
+}
+
+CardView::CardView(const char* data, size_t size) :
+    m_data(data, size),
+    m_record(m_data.GetBody())
+{
+}
+
+CardView::CardView(const Data& data, const char* record) :
+    m_data(data),
+    m_record(record)
+{
+}
+
+bool CardView::IsNull() const
+{
+    return GetRecordKind(m_data, m_record) == NullRecord;
+}
+
+CardStringView CardView::GetVersion() const
+{
+    return GetString(AdaptiveCardSchemaKey::Version);
+}
+
+CardStringView CardView::GetFallbackText() const
+{
+    return GetString(AdaptiveCardSchemaKey::FallbackText);
+}
+
+CardStringView CardView::GetBackgroundImage() const
+{
+    return GetString(AdaptiveCardSchemaKey::BackgroundImage);
+}
+
+CardStringView CardView::GetSpeak() const
+{
+    return GetString(AdaptiveCardSchemaKey::Speak);
+}
+
+CardStringView CardView::GetLanguage() const
+{
+    return GetString(AdaptiveCardSchemaKey::Language);
+}
+
+ContainerStyle CardView::GetStyle() const
+{
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(AdaptiveCardSchemaKey::Style, VarintField, cursor))
+    {
+        return ContainerStyle::None;
+    }
+    return static_cast<ContainerStyle>(cursor.ReadVarint());
+}
+
+CardActionView CardView::GetSelectAction() const
+{
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(AdaptiveCardSchemaKey::SelectAction, RecordField, cursor))
+    {
+        return CardActionView(m_data, nullptr);
+    }
+    return CardActionView(m_data, cursor.GetPosition());
+}
+
+CardListView<CardElementView> CardView::GetBody() const
+{
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(AdaptiveCardSchemaKey::Body, LengthPrefixedField, cursor))
+    {
+        return CardListView<CardElementView>();
+    }
+    return CardListView<CardElementView>(m_data, cursor.GetPosition());
+}
+
+CardListView<CardActionView> CardView::GetActions() const
+{
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(AdaptiveCardSchemaKey::Actions, LengthPrefixedField, cursor))
+    {
+        return CardListView<CardActionView>();
+    }
+    return CardListView<CardActionView>(m_data, cursor.GetPosition());
+}
+
+bool CardView::FindField(AdaptiveCardSchemaKey key, FieldKind kind, Cursor& cursor) const
+{
+    if (GetRecordKind(m_data, m_record) != NativeRecord)
+    {
+        return false;
+    }
+
+    cursor = OpenRecord(m_data, m_record);
+    return SeekField(cursor, MakeSchema(c_cardFields), key, kind);
+}
+
+CardStringView CardView::GetString(AdaptiveCardSchemaKey key) const
+{
+    Cursor cursor(nullptr, nullptr);
+    if (!FindField(key, StringField, cursor))
+    {
+        return CardStringView();
+    }
+    return ReadString(m_data, cursor);
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "pch.h"
+#include "Enums.h"
+#include "BinaryCardFormat.h"
+
+AdaptiveSharedNamespaceStart
+
+// Non-owning reference to string bytes inside a binary card
+class CardStringView
+{
+public:
+    CardStringView();
+    CardStringView(const char* data, size_t size);
+
+    const char* GetData() const;
+    size_t GetSize() const;
+    bool IsEmpty() const;
+
+    std::string ToString() const;
+
+    bool operator==(const std::string& other) const;
+    bool operator!=(const std::string& other) const;
+
+private:
+    const char* m_data;
+    size_t m_size;
+};
+
+// Read-only list of records inside a binary card. T is one of the view types below.
+template <typename T>
+class CardListView
+{
+public:
+    CardListView();
+    CardListView(const BinaryCardFormat::Data& data, const char* list);
+
+    size_t GetSize() const;
+    T Get(size_t index) const;
+
+private:
+    BinaryCardFormat::Data m_data;
+    const char* m_offsets;
+    size_t m_size;
+    const char* m_end;
+};
+
+class CardView;
+class CardActionView;
+
+class CardFactView
+{
+public:
+    CardFactView(const BinaryCardFormat::Data& data, const char* record);
+
+    CardStringView GetTitle() const;
+    CardStringView GetValue() const;
+
+private:
+    BinaryCardFormat::Data m_data;
+    const char* m_record;
+};
+
+// View of an element record. Elements that were stored as JSON report CardElementType::Custom
+// and answer string lookups from the top-level members of their JSON. Accessors for properties
+// the element does not have return the same defaults as the object model.
+class CardElementView
+{
+public:
+    CardElementView(const BinaryCardFormat::Data& data, const char* record);
+
+    bool IsNull() const;
+
+    CardElementType GetElementType() const;
+    CardStringView GetElementTypeString() const;
+    CardStringView GetId() const;
+    Spacing GetSpacing() const;
+    bool GetSeparator() const;
+    bool GetIsRequired() const;
+
+    // String valued property by schema key, such as Text, Url, Placeholder or Value
+    CardStringView GetString(AdaptiveCardSchemaKey key) const;
+
+    CardStringView GetText() const;
+    TextSize GetTextSize() const;
+    TextWeight GetTextWeight() const;
+    ForegroundColor GetTextColor() const;
+    bool GetWrap() const;
+    bool GetIsSubtle() const;
+    unsigned int GetMaxLines() const;
+    HorizontalAlignment GetHorizontalAlignment() const;
+    CardStringView GetLanguage() const;
+
+    CardStringView GetUrl() const;
+    CardStringView GetAltText() const;
+    ImageStyle GetImageStyle() const;
+    ImageSize GetImageSize() const;
+
+    ContainerStyle GetStyle() const;
+    CardStringView GetWidth() const;
+    CardActionView GetSelectAction() const;
+
+    // Items of a Container or Column, columns of a ColumnSet or images of an ImageSet
+    CardListView<CardElementView> GetItems() const;
+    CardListView<CardFactView> GetFacts() const;
+
+private:
+    unsigned char GetKind() const;
+    bool FindField(AdaptiveCardSchemaKey key, BinaryCardFormat::FieldKind kind, BinaryCardFormat::Cursor& cursor) const;
+    unsigned long long GetVarint(AdaptiveCardSchemaKey key, unsigned long long defaultValue) const;
+    bool GetBool(AdaptiveCardSchemaKey key, bool defaultValue) const;
+
+    BinaryCardFormat::Data m_data;
+    const char* m_record;
+};
+
+class CardActionView
+{
+public:
+    CardActionView(const BinaryCardFormat::Data& data, const char* record);
+
+    bool IsNull() const;
+
+    ActionType GetElementType() const;
+    CardStringView GetElementTypeString() const;
+    CardStringView GetTitle() const;
+    CardStringView GetId() const;
+    CardStringView GetIconUrl() const;
+
+    // Url of an OpenUrl action and data of a Submit action
+    CardStringView GetUrl() const;
+    CardStringView GetDataJson() const;
+
+    // Card of a ShowCard action
+    CardView GetCard() const;
+
+private:
+    unsigned char GetKind() const;
+    bool FindField(AdaptiveCardSchemaKey key, BinaryCardFormat::FieldKind kind, BinaryCardFormat::Cursor& cursor) const;
+    CardStringView GetString(AdaptiveCardSchemaKey key) const;
+
+    BinaryCardFormat::Data m_data;
+    const char* m_record;
+};
+
+// Read-only view of a card written by BinaryCardWriter. Nothing is parsed or allocated up front:
+// each accessor decodes just the bytes it needs, so opening a card costs a header check. Views
+// and the strings they return point into the caller's buffer, which may be a memory-mapped file,
+// and are valid for as long as it is. Malformed data throws AdaptiveCardParseException with
+// ErrorStatusCode::InvalidJson from the accessor that reaches it.
+class CardView
+{
+public:
+    CardView(const char* data, size_t size);
+    CardView(const BinaryCardFormat::Data& data, const char* record);
+
+    bool IsNull() const;
+
+    CardStringView GetVersion() const;
+    CardStringView GetFallbackText() const;
+    CardStringView GetBackgroundImage() const;
+    CardStringView GetSpeak() const;
+    CardStringView GetLanguage() const;
+    ContainerStyle GetStyle() const;
+
+    CardActionView GetSelectAction() const;
+    CardListView<CardElementView> GetBody() const;
+    CardListView<CardActionView> GetActions() const;
+
+private:
+    bool FindField(AdaptiveCardSchemaKey key, BinaryCardFormat::FieldKind kind, BinaryCardFormat::Cursor& cursor) const;
+    CardStringView GetString(AdaptiveCardSchemaKey key) const;
+
+    BinaryCardFormat::Data m_data;
+    const char* m_record;
+};
+
+template <typename T>
+CardListView<T>::CardListView() :
+    m_offsets(nullptr),
+    m_size(0),
+    m_end(nullptr)
+{
+}
+
+template <typename T>
+CardListView<T>::CardListView(const BinaryCardFormat::Data& data, const char* list) :
+    m_data(data)
+{
+    BinaryCardFormat::Cursor cursor(list, data.GetEnd());
+    const char* end = cursor.ReadLength();
+    const unsigned long long size = cursor.ReadVarint();
+    if (size > static_cast<unsigned long long>(end - cursor.GetPosition()) / 4)
+    {
+        BinaryCardFormat::Cursor::ThrowInvalid();
+    }
+
+    m_offsets = cursor.GetPosition();
+    m_size = static_cast<size_t>(size);
+    m_end = end;
+}
+
+template <typename T>
+size_t CardListView<T>::GetSize() const
+{
+    return m_size;
+}
+
+template <typename T>
+T CardListView<T>::Get(size_t index) const
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range("CardListView index out of range");
+    }
+
+    BinaryCardFormat::Cursor cursor(m_offsets + 4 * index, m_data.GetEnd());
+    const unsigned int offset = cursor.ReadUInt32();
+
+    // Children are written after the offsets and within the list, so an offset pointing anywhere
+    // else, such as back at the list or one of its ancestors, is malformed
+    if (offset < static_cast<size_t>(m_offsets + 4 * m_size - m_data.GetBody()) ||
+        offset >= static_cast<size_t>(m_end - m_data.GetBody()))
+    {
+        BinaryCardFormat::Cursor::ThrowInvalid();
+    }
+    return T(m_data, m_data.GetBody() + offset);
+}
+
+AdaptiveSharedNamespaceEnd
@@ -0,0 +1,348 @@
+#include "pch.h"
+#include "CardWriter.h"
+#include <cstring>
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    // Largest object content SortMembers rewrites as soon as the object is closed
+    const size_t InPlaceReorderLimit = 4096;
+}
+
+CardWriter::CardWriter() :
+    m_memberCount(0)
+{
+}
+
+void CardWriter::BeginObject()
+{
+    BeginValue();
+    m_buffer += '{';
+    m_scopes.push_back({ true, true, m_buffer.size(), m_memberCount });
+}
+
+void CardWriter::EndObject()
+{
+    const Scope scope = m_scopes.back();
+    m_scopes.pop_back();
+
+    SortMembers(scope);
+    m_memberCount = scope.firstMember;
+
+    m_buffer += '}';
+    EndValue();
+}
+
+void CardWriter::BeginArray()
+{
+    BeginValue();
+    m_buffer += '[';
+    m_scopes.push_back({ false, true, m_buffer.size(), m_memberCount });
+}
+
+void CardWriter::EndArray()
+{
+    m_scopes.pop_back();
+    m_buffer += ']';
+    EndValue();
+}
+
+void CardWriter::WriteKey(AdaptiveCardSchemaKey key)
+{
+    WriteKey(AdaptiveCardSchemaKeyToString(key));
+}
+
+void CardWriter::WriteKey(const std::string& key)
+{
+    Scope& scope = m_scopes.back();
+    if (!scope.isEmpty)
+    {
+        m_buffer += ',';
+    }
+    scope.isEmpty = false;
+
+    if (m_memberCount == m_members.size())
+    {
+        m_members.emplace_back();
+    }
+    Member& member = m_members[m_memberCount++];
+    member.name.assign(key);
+    member.begin = m_buffer.size();
+
+    WriteQuotedString(key.data(), key.data() + key.size());
+    m_buffer += ':';
+}
+
+void CardWriter::WriteValue(const std::string& value)
+{
+    BeginValue();
+    WriteQuotedString(value.data(), value.data() + value.size());
+    EndValue();
+}
+
+void CardWriter::WriteValue(const char* value)
+{
+    BeginValue();
+    WriteQuotedString(value, value + strlen(value));
+    EndValue();
+}
+
+void CardWriter::WriteValue(bool value)
+{
+    BeginValue();
+    m_buffer += Json::valueToString(value);
+    EndValue();
+}
+
+void CardWriter::WriteValue(int value)
+{
+    BeginValue();
+    m_buffer += Json::valueToString(static_cast<Json::LargestInt>(value));
+    EndValue();
+}
+
+void CardWriter::WriteValue(unsigned int value)
+{
+    BeginValue();
+    m_buffer += Json::valueToString(static_cast<Json::LargestUInt>(value));
+    EndValue();
+}
+
+void CardWriter::WriteValue(double value)
+{
+    BeginValue();
+    m_buffer += Json::valueToString(value);
+    EndValue();
+}
+
+void CardWriter::WriteValue(const Json::Value& value)
+{
+    BeginValue();
+    Json::FastWriter writer;
+    writer.omitEndingLineFeed();
+    m_buffer += writer.write(value);
+    EndValue();
+}
+
+const std::string& CardWriter::GetString() const
+{
+    return m_buffer;
+}
+
+void CardWriter::WriteTo(std::ostream& stream) const
+{
+    stream.write(m_buffer.data(), m_buffer.size());
+}
+
+void CardWriter::BeginValue()
+{
+    // Object members are separated when their key is written
+    if (!m_scopes.empty() && !m_scopes.back().isObject)
+    {
+        Scope& scope = m_scopes.back();
+        if (!scope.isEmpty)
+        {
+            m_buffer += ',';
+        }
+        scope.isEmpty = false;
+    }
+}
+
+void CardWriter::EndValue()
+{
+    if (m_scopes.empty())
+    {
+        ApplyReorders();
+        m_buffer += '\n';
+    }
+    else if (m_scopes.back().isObject)
+    {
+        m_members[m_memberCount - 1].end = m_buffer.size();
+    }
+}
+
+void CardWriter::WriteQuotedString(const char* begin, const char* end)
+{
+    // Same escaping as Json::FastWriter; bytes of multi-byte UTF-8 sequences are copied as is
+    static const char hexDigits[] = "0123456789ABCDEF";
+
+    m_buffer += '"';
+    const char* unescapedBegin = begin;
+    for (const char* current = begin; current != end; ++current)
+    {
+        const unsigned char c = static_cast<unsigned char>(*current);
+        if (c >= 0x20 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+
+        m_buffer.append(unescapedBegin, current);
+        unescapedBegin = current + 1;
+        switch (c)
+        {
+        case '"':
+            m_buffer += "\\\"";
+            break;
+        case '\\':
+            m_buffer += "\\\\";
+            break;
+        case '\b':
+            m_buffer += "\\b";
+            break;
+        case '\f':
+            m_buffer += "\\f";
+            break;
+        case '\n':
+            m_buffer += "\\n";
+            break;
+        case '\r':
+            m_buffer += "\\r";
+            break;
+        case '\t':
+            m_buffer += "\\t";
+            break;
+        default:
+            m_buffer += "\\u00";
+            m_buffer += hexDigits[c >> 4];
+            m_buffer += hexDigits[c & 0xF];
+            break;
+        }
+    }
+    m_buffer.append(unescapedBegin, end);
+    m_buffer += '"';
+}
+
+void CardWriter::SortMembers(const Scope& scope)
+{
+    const size_t firstMember = scope.firstMember;
+    const size_t memberCount = m_memberCount - firstMember;
+
+    bool isSorted = true;
+    for (size_t i = firstMember + 1; i < m_memberCount && isSorted; ++i)
+    {
+        isSorted = m_members[i - 1].name < m_members[i].name;
+    }
+    if (isSorted)
+    {
+        return;
+    }
+
+    m_memberOrder.resize(memberCount);
+    for (size_t i = 0; i < memberCount; ++i)
+    {
+        m_memberOrder[i] = firstMember + i;
+    }
+    std::stable_sort(m_memberOrder.begin(), m_memberOrder.end(),
+        [this](size_t lhs, size_t rhs) { return m_members[lhs].name < m_members[rhs].name; });
+
+    // Small objects are rewritten in place, which is cheaper than tracking their members, unless
+    // they hold objects already recorded for ApplyReorders. Copying only small objects bounds how
+    // many times a byte is copied however deep it is nested.
+    const bool holdsReorders = !m_reorders.empty() && m_reorders.back().begin >= scope.contentBegin;
+    if (!holdsReorders && m_buffer.size() - scope.contentBegin <= InPlaceReorderLimit)
+    {
+        m_reorderBuffer.assign(m_buffer, scope.contentBegin, std::string::npos);
+        m_buffer.resize(scope.contentBegin);
+        for (size_t i = 0; i < memberCount; ++i)
+        {
+            const Member& member = m_members[m_memberOrder[i]];
+            if (i + 1 < memberCount && m_members[m_memberOrder[i + 1]].name == member.name)
+            {
+                continue;
+            }
+
+            if (m_buffer.size() != scope.contentBegin)
+            {
+                m_buffer += ',';
+            }
+            m_buffer.append(m_reorderBuffer, member.begin - scope.contentBegin, member.end - member.begin);
+        }
+        return;
+    }
+
+    // Record the members in order, keeping the last of repeated names
+    const Reorder reorder = { scope.contentBegin, m_buffer.size(), m_pieces.size(), 0 };
+    m_reorders.push_back(reorder);
+    for (size_t i = 0; i < memberCount; ++i)
+    {
+        const Member& member = m_members[m_memberOrder[i]];
+        if (i + 1 < memberCount && m_members[m_memberOrder[i + 1]].name == member.name)
+        {
+            continue;
+        }
+
+        m_pieces.emplace_back(member.begin, member.end);
+        ++m_reorders.back().pieceCount;
+    }
+}
+
+void CardWriter::ApplyReorders()
+{
+    if (m_reorders.empty())
+    {
+        return;
+    }
+
+    // Objects are closed innermost first; sorting by start puts every object before the ones in it
+    std::sort(m_reorders.begin(), m_reorders.end(),
+        [](const Reorder& lhs, const Reorder& rhs) { return lhs.begin < rhs.begin; });
+
+    // Copies the buffer through a stack of ranges still to copy. A range entering a reordered
+    // object continues past it, and the object's members are copied in order as ranges of their
+    // own, which may contain further reordered objects.
+    struct Range
+    {
+        size_t current;
+        size_t end;
+        size_t reorder;
+        size_t nextPiece;
+    };
+    const size_t noReorder = m_reorders.size();
+
+    std::string output;
+    output.reserve(m_buffer.size());
+    std::vector<Range> ranges;
+    ranges.push_back({ 0, m_buffer.size(), noReorder, 0 });
+    while (!ranges.empty())
+    {
+        Range& range = ranges.back();
+        if (range.current == range.end)
+        {
+            if (range.reorder == noReorder || range.nextPiece == m_reorders[range.reorder].pieceCount)
+            {
+                ranges.pop_back();
+                continue;
+            }
+
+            if (range.nextPiece != 0)
+            {
+                output += ',';
+            }
+            const std::pair<size_t, size_t>& piece = m_pieces[m_reorders[range.reorder].firstPiece + range.nextPiece++];
+            range.current = piece.first;
+            range.end = piece.second;
+            continue;
+        }
+
+        // A member starts with its key, before any object in its value, so searching past the
+        // current position never finds the object whose member is being copied
+        auto next = std::upper_bound(m_reorders.begin(), m_reorders.end(), range.current,
+            [](size_t position, const Reorder& reorder) { return position < reorder.begin; });
+        if (next == m_reorders.end() || next->begin >= range.end)
+        {
+            output.append(m_buffer, range.current, range.end - range.current);
+            range.current = range.end;
+            continue;
+        }
+
+        output.append(m_buffer, range.current, next->begin - range.current);
+        range.current = next->end;
+        const Range members = { next->end, next->end, static_cast<size_t>(next - m_reorders.begin()), 0 };
+        ranges.push_back(members);
+    }
+
+    m_buffer.swap(output);
+    m_reorders.clear();
+    m_pieces.clear();
+}
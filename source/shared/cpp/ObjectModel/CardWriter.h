@@ -0,0 +1,93 @@
+#pragma once
+
+#include "pch.h"
+#include "Enums.h"
+#include "json/json.h"
+
+AdaptiveSharedNamespaceStart
+
+// Writes JSON text directly into a growable buffer, producing exactly what Json::FastWriter
+// produces for the equivalent Json::Value: no whitespace, object members sorted by name (a
+// repeated name keeps its last value) and a line feed after the top-level value. Members can be
+// written in any order; each object is put in order when it is closed, or for large ones once the
+// top-level value is complete, so that deeply nested objects are not copied once per level.
+class CardWriter
+{
+public:
+    CardWriter();
+
+    void BeginObject();
+    void EndObject();
+    void BeginArray();
+    void EndArray();
+
+    void WriteKey(AdaptiveCardSchemaKey key);
+    void WriteKey(const std::string& key);
+
+    void WriteValue(const std::string& value);
+    void WriteValue(const char* value);
+    void WriteValue(bool value);
+    void WriteValue(int value);
+    void WriteValue(unsigned int value);
+    void WriteValue(double value);
+    void WriteValue(const Json::Value& value);
+
+    template <typename T>
+    void WriteProperty(AdaptiveCardSchemaKey key, const T& value);
+
+    const std::string& GetString() const;
+    void WriteTo(std::ostream& stream) const;
+
+private:
+    struct Scope
+    {
+        bool isObject;
+        bool isEmpty;
+        size_t contentBegin;
+        size_t firstMember;
+    };
+
+    struct Member
+    {
+        std::string name;
+        size_t begin;
+        size_t end;
+    };
+
+    // An object whose content [begin, end) is to be replaced by its members in order, given as
+    // the pieceCount ranges of m_pieces from firstPiece
+    struct Reorder
+    {
+        size_t begin;
+        size_t end;
+        size_t firstPiece;
+        size_t pieceCount;
+    };
+
+    void BeginValue();
+    void EndValue();
+    void WriteQuotedString(const char* begin, const char* end);
+    void SortMembers(const Scope& scope);
+    void ApplyReorders();
+
+    std::string m_buffer;
+    std::vector<Scope> m_scopes;
+
+    // Members of all open objects. Entries past m_memberCount are kept to reuse their storage.
+    std::vector<Member> m_members;
+    size_t m_memberCount;
+
+    std::vector<size_t> m_memberOrder;
+    std::string m_reorderBuffer;
+    std::vector<Reorder> m_reorders;
+    std::vector<std::pair<size_t, size_t>> m_pieces;
+};
+
+template <typename T>
+void CardWriter::WriteProperty(AdaptiveCardSchemaKey key, const T& value)
+{
+    WriteKey(key);
+    WriteValue(value);
+}
+
+AdaptiveSharedNamespaceEnd
@@ -32,8 +32,9 @@ std::shared_ptr<ChoiceInput> ChoiceInput::DeserializeFromString(
 
 std::string ChoiceInput::Serialize()
 {
-    Json::FastWriter writer;
-    return writer.write(SerializeToJsonValue());
+    CardWriter writer;
+    SerializeToWriter(writer);
+    return writer.GetString();
 }
 
 Json::Value ChoiceInput::SerializeToJsonValue()
@@ -46,6 +47,14 @@ Json::Value ChoiceInput::SerializeToJsonValue()
     return root;
 }
 
+void ChoiceInput::SerializeToWriter(CardWriter& writer)
+{
+    writer.BeginObject();
+    writer.WriteProperty(AdaptiveCardSchemaKey::Title, GetTitle());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Value, GetValue());
+    writer.EndObject();
+}
+
 std::string ChoiceInput::GetTitle() const
 {
     return m_title;
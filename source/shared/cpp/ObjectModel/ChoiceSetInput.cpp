@@ -7,7 +7,6 @@ using namespace AdaptiveSharedNamespace;
 
 ChoiceSetInput::ChoiceSetInput() : BaseInputElement(CardElementType::ChoiceSetInput)
 {
-    PopulateKnownPropertiesSet();
 }
 
 ChoiceSetInput::ChoiceSetInput(
@@ -17,7 +16,6 @@ ChoiceSetInput::ChoiceSetInput(
     BaseInputElement(CardElementType::ChoiceSetInput, spacing, separation),
     m_choices(choices)
 {
-    PopulateKnownPropertiesSet();
 }
 
 ChoiceSetInput::ChoiceSetInput(
@@ -55,6 +53,30 @@ Json::Value ChoiceSetInput::SerializeToJsonValue()
     return root;
 }
 
+void ChoiceSetInput::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(ChoiceSetInput)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseInputElement::SerializeProperties(writer);
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::Style, ChoiceSetStyleToString(GetChoiceSetStyle()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::IsMultiSelect, GetIsMultiSelect());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Value, GetValue());
+
+    writer.WriteKey(AdaptiveCardSchemaKey::Choices);
+    writer.BeginArray();
+    for (const auto& choice : GetChoices())
+    {
+        choice->SerializeToWriter(writer);
+    }
+    writer.EndArray();
+    writer.EndObject();
+}
+
 bool ChoiceSetInput::GetIsMultiSelect() const
 {
     return m_isMultiSelect;
@@ -98,7 +120,14 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::Deserialize(
     choiceSet->SetIsMultiSelect(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsMultiSelect, false));
     choiceSet->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, false));
 
-    // Parse Choices
+    // Parse Choices, turning down sets with more than the limit before parsing any of them
+    if (ParseUtil::GetArray(json, AdaptiveCardSchemaKey::Choices, false).size() > ParseUtil::GetLimits().maxChoiceCount)
+    {
+        ParseUtil::RaiseError(ErrorStatusCode::ParseLimitExceeded,
+            "Maximum choice count of " + std::to_string(ParseUtil::GetLimits().maxChoiceCount) + " exceeded", AdaptiveCardSchemaKey::Choices);
+        return choiceSet;
+    }
+
     auto choices = ParseUtil::GetElementCollectionOfSingleType<ChoiceInput>(elementParserRegistration, actionParserRegistration, json, AdaptiveCardSchemaKey::Choices, ChoiceInput::Deserialize, true);
     choiceSet->m_choices = std::move(choices);
 
@@ -113,10 +142,13 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::DeserializeFromString(
     return ChoiceSetInputParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void ChoiceSetInput::PopulateKnownPropertiesSet() 
+const KnownPropertySet& ChoiceSetInput::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Choices));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiSelect));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value));
+    static const KnownPropertySet knownProperties(BaseInputElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Choices,
+        AdaptiveCardSchemaKey::IsMultiSelect,
+        AdaptiveCardSchemaKey::Style,
+        AdaptiveCardSchemaKey::Value
+    });
+    return knownProperties;
 }
@@ -17,6 +17,7 @@ public:
     ChoiceSetInput(Spacing spacing, bool separation, std::vector<std::shared_ptr<ChoiceInput>>& choices);
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     bool GetIsMultiSelect() const;
     void SetIsMultiSelect(const bool isMultiSelect);
@@ -30,9 +31,10 @@ public:
     std::string GetValue() const;
     void SetValue(std::string value);
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     std::string m_value;
     bool m_isMultiSelect;
     ChoiceSetStyle m_choiceSetStyle;
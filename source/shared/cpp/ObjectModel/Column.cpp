@@ -2,12 +2,12 @@
 #include "ChoiceSetInput.h"
 #include "Column.h"
 #include "Util.h"
+#include "CardTraversal.h"
 
 using namespace AdaptiveSharedNamespace;
 
 Column::Column() : BaseCardElement(CardElementType::Column), m_width("Auto")
 {
-    PopulateKnownPropertiesSet();
 }
 
 Column::Column(
@@ -19,7 +19,6 @@ Column::Column(
     std::vector<std::shared_ptr<BaseCardElement>>& items) :
     BaseCardElement(CardElementType::Column, spacing, separation), m_width(size), m_explicitWidth(explicitWidth), m_style(style), m_items(items)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Column::Column(
@@ -30,7 +29,11 @@ Column::Column(
     ContainerStyle style) :
     BaseCardElement(CardElementType::Column, spacing, separation), m_width(width), m_explicitWidth(explicitWidth), m_style(style)
 {
-    PopulateKnownPropertiesSet();
+}
+
+Column::~Column()
+{
+    CardTraversal::Release(m_items);
 }
 
 std::string Column::GetWidth() const
@@ -76,8 +79,9 @@ std::vector<std::shared_ptr<BaseCardElement>>& Column::GetItems()
 
 std::string Column::Serialize()
 {
-    Json::FastWriter writer;
-    return writer.write(SerializeToJsonValue());
+    CardWriter writer;
+    SerializeToWriter(writer);
+    return writer.GetString();
 }
 
 Json::Value Column::SerializeToJsonValue()
@@ -108,6 +112,45 @@ Json::Value Column::SerializeToJsonValue()
     return root;
 }
 
+void Column::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(Column)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseCardElement::SerializeProperties(writer);
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::Width, GetWidth());
+
+    ContainerStyle style = GetStyle();
+    if (style != ContainerStyle::None)
+    {
+        writer.WriteProperty(AdaptiveCardSchemaKey::Style, ContainerStyleToString(style));
+    }
+
+    writer.WriteKey(AdaptiveCardSchemaKey::Items);
+    writer.BeginArray();
+    for (const auto& cardElement : GetItems())
+    {
+        CardTraversal::Schedule([&writer, cardElement = cardElement.get()]() { cardElement->SerializeToWriter(writer); });
+    }
+
+    CardTraversal::Schedule([&writer, this]()
+    {
+        writer.EndArray();
+
+        std::shared_ptr<BaseActionElement> selectAction = GetSelectAction();
+        if (selectAction != nullptr)
+        {
+            writer.WriteKey(AdaptiveCardSchemaKey::SelectAction);
+            selectAction->SerializeToWriter(writer);
+        }
+        CardTraversal::Schedule([&writer]() { writer.EndObject(); });
+    });
+}
+
 std::shared_ptr<Column> Column::Deserialize(
     std::shared_ptr<ElementParserRegistration> elementParserRegistration,
     std::shared_ptr<ActionParserRegistration> actionParserRegistration,
@@ -139,7 +182,7 @@ std::shared_ptr<Column> Column::Deserialize(
         }
         else if(foundIndex != std::string::npos)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "unit is in inproper form: " + columnWidth);
+            ParseUtil::RaiseError(ErrorStatusCode::InvalidPropertyValue, "unit is in inproper form: " + columnWidth, AdaptiveCardSchemaKey::Width);
         }
     }
 
@@ -149,11 +192,17 @@ std::shared_ptr<Column> Column::Deserialize(
         ParseUtil::GetEnumValue<ContainerStyle>(value, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString));
 
     // Parse Items
-    auto cardElements = ParseUtil::GetElementCollection(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::Items, false);
-    column->m_items = std::move(cardElements);
+    ParseUtil::GetElementCollection(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::Items, false,
+        std::shared_ptr<std::vector<std::shared_ptr<BaseCardElement>>>(column, &column->m_items));
 
-    // Parse optional selectAction
-    column->SetSelectAction(ParseUtil::GetSelectAction(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::SelectAction, false));
+    // Parse optional selectAction, after the items
+    if (ParseUtil::FindValue(value, AdaptiveCardSchemaKey::SelectAction) != nullptr)
+    {
+        ParseUtil::Defer([=, &value]()
+        {
+            column->SetSelectAction(ParseUtil::GetSelectAction(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::SelectAction, false));
+        });
+    }
 
     return column;
 }
@@ -176,25 +225,32 @@ void Column::SetSelectAction(const std::shared_ptr<BaseActionElement> action)
     m_selectAction = action;
 }
 
-void Column::PopulateKnownPropertiesSet() 
+const KnownPropertySet& Column::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style));
+    static const KnownPropertySet knownProperties(BaseCardElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Items,
+        AdaptiveCardSchemaKey::SelectAction,
+        AdaptiveCardSchemaKey::Width,
+        AdaptiveCardSchemaKey::Style
+    });
+    return knownProperties;
 }
 
 void Column::SetLanguage(const std::string& language)
 {
     PropagateLanguage(language, m_items);
+    PropagateLanguage(language, m_selectAction);
 }
 
 void Column::GetResourceUris(std::vector<std::string>& resourceUris)
 {
-    auto columnItems = GetItems();
-    for (auto item : columnItems)
+    for (const auto& item : m_items)
+    {
+        CardTraversal::Schedule([&resourceUris, item = item.get()]() { item->GetResourceUris(resourceUris); });
+    }
+
+    if (m_selectAction != nullptr)
     {
-        item->GetResourceUris(resourceUris);
+        CardTraversal::Schedule([&resourceUris, item = m_selectAction.get()]() { item->GetResourceUris(resourceUris); });
     }
-    return;
 }
\ No newline at end of file
@@ -12,9 +12,11 @@ public:
     Column();
     Column(Spacing spacing, bool separation, std::string size, unsigned int explicitWidth, ContainerStyle style);
     Column(Spacing spacing, bool separation, std::string size, unsigned int explicitWidth, ContainerStyle style, std::vector<std::shared_ptr<BaseCardElement>>& items);
+    ~Column();
 
     virtual std::string Serialize();
     virtual Json::Value SerializeToJsonValue();
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     static std::shared_ptr<Column> Deserialize(
         std::shared_ptr<ElementParserRegistration> elementParserRegistration,
@@ -46,9 +48,10 @@ public:
 
     virtual void GetResourceUris(std::vector<std::string>& resourceUris) override;
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     std::string m_width;
     unsigned int m_explicitWidth;
     std::vector<std::shared_ptr<AdaptiveSharedNamespace::BaseCardElement>> m_items;
@@ -3,17 +3,22 @@
 #include "ParseUtil.h"
 #include "Image.h"
 #include "TextBlock.h"
+#include "CardTraversal.h"
+#include "Util.h"
 
 using namespace AdaptiveSharedNamespace;
 
 ColumnSet::ColumnSet() : BaseCardElement(CardElementType::ColumnSet)
 {
-    PopulateKnownPropertiesSet();
 }
 
 ColumnSet::ColumnSet(std::vector<std::shared_ptr<Column>>& columns) : BaseCardElement(CardElementType::ColumnSet), m_columns(columns)
 {
-    PopulateKnownPropertiesSet();
+}
+
+ColumnSet::~ColumnSet()
+{
+    CardTraversal::Release(m_columns);
 }
 
 const std::vector<std::shared_ptr<Column>>& ColumnSet::GetColumns() const
@@ -38,10 +43,11 @@ void ColumnSet::SetSelectAction(const std::shared_ptr<BaseActionElement> action)
 
 void ColumnSet::SetLanguage(const std::string& language)
 {
-    for (auto& column : m_columns)
+    for (const auto& column : m_columns)
     {
         column->SetLanguage(language);
     }
+    PropagateLanguage(language, m_selectAction);
 }
 
 Json::Value ColumnSet::SerializeToJsonValue()
@@ -64,6 +70,37 @@ Json::Value ColumnSet::SerializeToJsonValue()
     return root;
 }
 
+void ColumnSet::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(ColumnSet)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseCardElement::SerializeProperties(writer);
+
+    writer.WriteKey(AdaptiveCardSchemaKey::Columns);
+    writer.BeginArray();
+    for (const auto& column : GetColumns())
+    {
+        CardTraversal::Schedule([&writer, column = column.get()]() { column->SerializeToWriter(writer); });
+    }
+
+    CardTraversal::Schedule([&writer, this]()
+    {
+        writer.EndArray();
+
+        std::shared_ptr<BaseActionElement> selectAction = GetSelectAction();
+        if (selectAction != nullptr)
+        {
+            writer.WriteKey(AdaptiveCardSchemaKey::SelectAction);
+            selectAction->SerializeToWriter(writer);
+        }
+        CardTraversal::Schedule([&writer]() { writer.EndObject(); });
+    });
+}
+
 std::shared_ptr<BaseCardElement> ColumnSetParser::Deserialize(
     std::shared_ptr<ElementParserRegistration> elementParserRegistration,
     std::shared_ptr<ActionParserRegistration> actionParserRegistration,
@@ -74,11 +111,17 @@ std::shared_ptr<BaseCardElement> ColumnSetParser::Deserialize(
     auto container = BaseCardElement::Deserialize<ColumnSet>(value);
 
     // Parse Columns
-    auto cardElements = ParseUtil::GetElementCollectionOfSingleType<Column>(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::Columns, Column::Deserialize, true);
-    container->m_columns = std::move(cardElements);
+    ParseUtil::GetElementCollectionOfSingleType<Column>(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::Columns, Column::Deserialize, true,
+        std::shared_ptr<std::vector<std::shared_ptr<Column>>>(container, &container->m_columns));
 
-    // Parse optional selectAction
-    container->SetSelectAction(ParseUtil::GetSelectAction(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::SelectAction, false));
+    // Parse optional selectAction, after the columns
+    if (ParseUtil::FindValue(value, AdaptiveCardSchemaKey::SelectAction) != nullptr)
+    {
+        ParseUtil::Defer([=, &value]()
+        {
+            container->SetSelectAction(ParseUtil::GetSelectAction(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::SelectAction, false));
+        });
+    }
 
     return container;
 }
@@ -91,18 +134,24 @@ std::shared_ptr<BaseCardElement> ColumnSetParser::DeserializeFromString(
     return ColumnSetParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void ColumnSet::PopulateKnownPropertiesSet() 
+const KnownPropertySet& ColumnSet::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction));
+    static const KnownPropertySet knownProperties(BaseCardElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Columns,
+        AdaptiveCardSchemaKey::SelectAction
+    });
+    return knownProperties;
 }
 
 void ColumnSet::GetResourceUris(std::vector<std::string>& resourceUris)
 {
-    auto columns = GetColumns();
-    for (auto column : columns)
+    for (const auto& column : m_columns)
+    {
+        CardTraversal::Schedule([&resourceUris, column = column.get()]() { column->GetResourceUris(resourceUris); });
+    }
+
+    if (m_selectAction != nullptr)
     {
-        column->GetResourceUris(resourceUris);
+        CardTraversal::Schedule([&resourceUris, item = m_selectAction.get()]() { item->GetResourceUris(resourceUris); });
     }
-    return;
 }
\ No newline at end of file
@@ -13,8 +13,10 @@ friend class ColumnSetParser;
 public:
     ColumnSet();
     ColumnSet(std::vector<std::shared_ptr<Column>>& columns);
+    ~ColumnSet();
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     std::vector<std::shared_ptr<Column>>& GetColumns();
     const std::vector<std::shared_ptr<Column>>& GetColumns() const;
@@ -26,9 +28,10 @@ public:
 
     virtual void GetResourceUris(std::vector<std::string>& resourceUris) override;
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     static const std::unordered_map<CardElementType, std::function<std::shared_ptr<Column>(const Json::Value&)>, EnumHash> ColumnParser;
     std::vector<std::shared_ptr<Column>> m_columns;
     std::shared_ptr<BaseActionElement> m_selectAction;
@@ -3,12 +3,12 @@
 #include "TextBlock.h"
 #include "ColumnSet.h"
 #include "Util.h"
+#include "CardTraversal.h"
 
 using namespace AdaptiveSharedNamespace;
 
 Container::Container() : BaseCardElement(CardElementType::Container), m_style(ContainerStyle::None)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Container::Container(
@@ -20,7 +20,6 @@ Container::Container(
     m_style(style),
     m_items(items)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Container::Container(
@@ -32,6 +31,11 @@ Container::Container(
 {
 }
 
+Container::~Container()
+{
+    CardTraversal::Release(m_items);
+}
+
 const std::vector<std::shared_ptr<BaseCardElement>>& Container::GetItems() const
 {
     return m_items;
@@ -65,6 +69,7 @@ void Container::SetSelectAction(const std::shared_ptr<BaseActionElement> action)
 void Container::SetLanguage(const std::string& value)
 {
     PropagateLanguage(value, m_items);
+    PropagateLanguage(value, m_selectAction);
 }
 
 Json::Value Container::SerializeToJsonValue()
@@ -93,6 +98,43 @@ Json::Value Container::SerializeToJsonValue()
     return root;
 }
 
+void Container::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(Container)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseCardElement::SerializeProperties(writer);
+
+    ContainerStyle style = GetStyle();
+    if (style != ContainerStyle::None)
+    {
+        writer.WriteProperty(AdaptiveCardSchemaKey::Style, ContainerStyleToString(style));
+    }
+
+    writer.WriteKey(AdaptiveCardSchemaKey::Items);
+    writer.BeginArray();
+    for (const auto& cardElement : GetItems())
+    {
+        CardTraversal::Schedule([&writer, cardElement = cardElement.get()]() { cardElement->SerializeToWriter(writer); });
+    }
+
+    CardTraversal::Schedule([&writer, this]()
+    {
+        writer.EndArray();
+
+        std::shared_ptr<BaseActionElement> selectAction = GetSelectAction();
+        if (selectAction != nullptr)
+        {
+            writer.WriteKey(AdaptiveCardSchemaKey::SelectAction);
+            selectAction->SerializeToWriter(writer);
+        }
+        CardTraversal::Schedule([&writer]() { writer.EndObject(); });
+    });
+}
+
 std::shared_ptr<BaseCardElement> ContainerParser::Deserialize(
     std::shared_ptr<ElementParserRegistration> elementParserRegistration,
     std::shared_ptr<ActionParserRegistration> actionParserRegistration,
@@ -106,11 +148,17 @@ std::shared_ptr<BaseCardElement> ContainerParser::Deserialize(
         ParseUtil::GetEnumValue<ContainerStyle>(value, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString));
 
     // Parse Items
-    auto cardElements = ParseUtil::GetElementCollection(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::Items, false);
-    container->m_items = std::move(cardElements);
+    ParseUtil::GetElementCollection(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::Items, false,
+        std::shared_ptr<std::vector<std::shared_ptr<BaseCardElement>>>(container, &container->m_items));
 
-    // Parse optional selectAction
-    container->SetSelectAction(ParseUtil::GetSelectAction(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::SelectAction, false));
+    // Parse optional selectAction, after the items
+    if (ParseUtil::FindValue(value, AdaptiveCardSchemaKey::SelectAction) != nullptr)
+    {
+        ParseUtil::Defer([=, &value]()
+        {
+            container->SetSelectAction(ParseUtil::GetSelectAction(elementParserRegistration, actionParserRegistration, value, AdaptiveCardSchemaKey::SelectAction, false));
+        });
+    }
 
     return container;
 }
@@ -123,19 +171,25 @@ std::shared_ptr<BaseCardElement> ContainerParser::DeserializeFromString(
     return ContainerParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void Container::PopulateKnownPropertiesSet() 
+const KnownPropertySet& Container::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items));
+    static const KnownPropertySet knownProperties(BaseCardElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Style,
+        AdaptiveCardSchemaKey::SelectAction,
+        AdaptiveCardSchemaKey::Items
+    });
+    return knownProperties;
 }
 
 void Container::GetResourceUris(std::vector<std::string>& resourceUris)
 {
-    auto items = GetItems();
-    for (auto item : items)
+    for (const auto& item : m_items)
+    {
+        CardTraversal::Schedule([&resourceUris, item = item.get()]() { item->GetResourceUris(resourceUris); });
+    }
+
+    if (m_selectAction != nullptr)
     {
-        item->GetResourceUris(resourceUris);
+        CardTraversal::Schedule([&resourceUris, item = m_selectAction.get()]() { item->GetResourceUris(resourceUris); });
     }
-    return;
 }
\ No newline at end of file
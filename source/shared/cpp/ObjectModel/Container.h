@@ -14,8 +14,10 @@ public:
     Container();
     Container(Spacing spacing, bool separator, ContainerStyle style);
     Container(Spacing spacing, bool separator, ContainerStyle style, std::vector<std::shared_ptr<BaseCardElement>>& items);
+    ~Container();
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     std::vector<std::shared_ptr<BaseCardElement>>& GetItems();
     const std::vector<std::shared_ptr<BaseCardElement>>& GetItems() const;
@@ -30,9 +32,10 @@ public:
 
     virtual void GetResourceUris(std::vector<std::string>& resourceUris) override;
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     ContainerStyle m_style;
     std::vector<std::shared_ptr<AdaptiveSharedNamespace::BaseCardElement>> m_items;
     std::shared_ptr<BaseActionElement> m_selectAction;
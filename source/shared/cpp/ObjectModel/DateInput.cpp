@@ -7,7 +7,6 @@ using namespace AdaptiveSharedNamespace;
 DateInput::DateInput() :
     BaseInputElement(CardElementType::DateInput)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value DateInput::SerializeToJsonValue()
@@ -22,6 +21,23 @@ Json::Value DateInput::SerializeToJsonValue()
     return root;
 }
 
+void DateInput::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(DateInput)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseInputElement::SerializeProperties(writer);
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::Max, GetMax());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Min, GetMin());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Placeholder, GetPlaceholder());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Value, GetValue());
+    writer.EndObject();
+}
+
 std::string DateInput::GetMax() const
 {
     return m_max;
@@ -87,10 +103,13 @@ std::shared_ptr<BaseCardElement> DateInputParser::DeserializeFromString(
     return DateInputParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void DateInput::PopulateKnownPropertiesSet() 
+const KnownPropertySet& DateInput::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder));
+    static const KnownPropertySet knownProperties(BaseInputElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Max,
+        AdaptiveCardSchemaKey::Min,
+        AdaptiveCardSchemaKey::Value,
+        AdaptiveCardSchemaKey::Placeholder
+    });
+    return knownProperties;
 }
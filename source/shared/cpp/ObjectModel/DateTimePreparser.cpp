@@ -13,6 +13,7 @@
 #include <time.h>
 #include "ElementParserRegistration.h"
 #include "DateTimePreparser.h"
+#include "TextScanner.h"
 #include <iomanip>
 #include <regex>
 #include <iostream>
@@ -25,9 +26,18 @@ DateTimePreparser::DateTimePreparser() :
 {
 }
 
-DateTimePreparser::DateTimePreparser(std::string in)
+DateTimePreparser::DateTimePreparser(std::string in) :
+    m_hasDateTokens(false)
 {
-    ParseDateTime(in);
+    // only text that may have a date is matched against the pattern
+    if (TextScanner::Scan(in).HasDateTime())
+    {
+        ParseDateTime(in);
+    }
+    else
+    {
+        AddTextToken(in, DateTimePreparsedTokenFormat::RegularString);
+    }
 }
 
 std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparser::GetTextTokens() const
@@ -0,0 +1,231 @@
+#include "pch.h"
+#include "ElementIdIndex.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "ImageSet.h"
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    template <typename T>
+    void AppendAll(const std::vector<std::shared_ptr<T>>& elements, std::vector<std::shared_ptr<BaseCardElement>>& children)
+    {
+        children.insert(children.end(), elements.begin(), elements.end());
+    }
+}
+
+ElementIdIndex::ElementIdIndex()
+{
+}
+
+void ElementIdIndex::Add(const std::shared_ptr<BaseCardElement>& element,
+    const BaseCardElement* parent,
+    const std::vector<std::shared_ptr<BaseCardElement>>& body,
+    std::vector<std::string>& duplicateIds)
+{
+    // Walked on a stack of its own, in document order so that the elements under element that
+    // share an id are appended in order without being compared
+    std::vector<std::pair<std::shared_ptr<BaseCardElement>, const BaseCardElement*>> pending;
+    std::vector<std::shared_ptr<BaseCardElement>> children;
+    pending.emplace_back(element, parent);
+    while (!pending.empty())
+    {
+        std::shared_ptr<BaseCardElement> current = std::move(pending.back().first);
+        const BaseCardElement* currentParent = pending.back().second;
+        pending.pop_back();
+
+        Node& node = m_nodes[current.get()];
+        node.element = current;
+        node.parent = currentParent;
+
+        const std::string id = current->GetId();
+        if (!id.empty() && !AddId(id, current.get(), body))
+        {
+            duplicateIds.push_back(id);
+        }
+
+        children.clear();
+        GetChildren(*current, children);
+        for (auto child = children.rbegin(); child != children.rend(); ++child)
+        {
+            pending.emplace_back(std::move(*child), current.get());
+        }
+    }
+}
+
+void ElementIdIndex::Remove(const BaseCardElement* element)
+{
+    std::vector<const BaseCardElement*> pending;
+    std::vector<std::shared_ptr<BaseCardElement>> children;
+    pending.push_back(element);
+    while (!pending.empty())
+    {
+        const BaseCardElement* current = pending.back();
+        pending.pop_back();
+
+        m_nodes.erase(current);
+        const std::string id = current->GetId();
+        if (!id.empty())
+        {
+            RemoveId(id, current);
+        }
+
+        children.clear();
+        GetChildren(*current, children);
+        for (const auto& child : children)
+        {
+            pending.push_back(child.get());
+        }
+    }
+}
+
+bool ElementIdIndex::UpdateId(const BaseCardElement* element, const std::string& oldId, const std::vector<std::shared_ptr<BaseCardElement>>& body)
+{
+    if (!oldId.empty())
+    {
+        RemoveId(oldId, element);
+    }
+
+    const std::string id = element->GetId();
+    return id.empty() || AddId(id, element, body);
+}
+
+std::shared_ptr<BaseCardElement> ElementIdIndex::GetElement(const std::string& id) const
+{
+    auto holders = m_ids.find(id);
+    return (holders != m_ids.end()) ? Lock(holders->second.front()) : nullptr;
+}
+
+std::vector<std::shared_ptr<BaseCardElement>> ElementIdIndex::GetParentPath(const std::string& id) const
+{
+    std::vector<std::shared_ptr<BaseCardElement>> path;
+    auto holders = m_ids.find(id);
+    if (holders == m_ids.end())
+    {
+        return path;
+    }
+
+    for (auto node = m_nodes.find(holders->second.front()); node != m_nodes.end() && node->second.parent != nullptr;
+        node = m_nodes.find(node->second.parent))
+    {
+        path.push_back(Lock(node->second.parent));
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+std::shared_ptr<BaseCardElement> ElementIdIndex::GetParent(const BaseCardElement* element) const
+{
+    auto node = m_nodes.find(element);
+    return (node != m_nodes.end() && node->second.parent != nullptr) ? Lock(node->second.parent) : nullptr;
+}
+
+bool ElementIdIndex::Contains(const BaseCardElement* element) const
+{
+    return m_nodes.find(element) != m_nodes.end();
+}
+
+size_t ElementIdIndex::GetElementCount() const
+{
+    return m_nodes.size();
+}
+
+void ElementIdIndex::GetChildren(const BaseCardElement& element, std::vector<std::shared_ptr<BaseCardElement>>& children)
+{
+    switch (element.GetElementType())
+    {
+    case CardElementType::Container:
+        AppendAll(static_cast<const Container&>(element).GetItems(), children);
+        break;
+    case CardElementType::Column:
+        AppendAll(static_cast<const Column&>(element).GetItems(), children);
+        break;
+    case CardElementType::ColumnSet:
+        AppendAll(static_cast<const ColumnSet&>(element).GetColumns(), children);
+        break;
+    case CardElementType::ImageSet:
+        AppendAll(static_cast<const ImageSet&>(element).GetImages(), children);
+        break;
+    default:
+        break;
+    }
+}
+
+bool ElementIdIndex::AddId(const std::string& id, const BaseCardElement* element, const std::vector<std::shared_ptr<BaseCardElement>>& body)
+{
+    std::vector<const BaseCardElement*>& holders = m_ids[id];
+    if (std::find(holders.begin(), holders.end(), element) != holders.end())
+    {
+        return true;
+    }
+
+    // Elements are usually added after the others with their id, so the search starts at the end
+    auto position = holders.end();
+    while (position != holders.begin() && IsBefore(element, *(position - 1), body))
+    {
+        --position;
+    }
+    holders.insert(position, element);
+    return holders.size() == 1;
+}
+
+void ElementIdIndex::RemoveId(const std::string& id, const BaseCardElement* element)
+{
+    auto holders = m_ids.find(id);
+    if (holders == m_ids.end())
+    {
+        return;
+    }
+
+    auto& elements = holders->second;
+    elements.erase(std::remove(elements.begin(), elements.end(), element), elements.end());
+    if (elements.empty())
+    {
+        m_ids.erase(holders);
+    }
+}
+
+bool ElementIdIndex::IsBefore(const BaseCardElement* element, const BaseCardElement* other, const std::vector<std::shared_ptr<BaseCardElement>>& body) const
+{
+    // An ancestor's position is a prefix of its descendants', and comes first as it does in a walk
+    const std::vector<size_t> elementPosition = GetPosition(element, body);
+    const std::vector<size_t> otherPosition = GetPosition(other, body);
+    return std::lexicographical_compare(elementPosition.begin(), elementPosition.end(), otherPosition.begin(), otherPosition.end());
+}
+
+std::vector<size_t> ElementIdIndex::GetPosition(const BaseCardElement* element, const std::vector<std::shared_ptr<BaseCardElement>>& body) const
+{
+    // Index of the element and of each of its ancestors among their siblings, outermost first
+    std::vector<size_t> position;
+    std::vector<std::shared_ptr<BaseCardElement>> children;
+    for (auto node = m_nodes.find(element); node != m_nodes.end(); node = m_nodes.find(node->second.parent))
+    {
+        const BaseCardElement* parent = node->second.parent;
+        children.clear();
+        if (parent != nullptr)
+        {
+            if (auto lockedParent = Lock(parent))
+            {
+                GetChildren(*lockedParent, children);
+            }
+        }
+
+        const auto& siblings = (parent == nullptr) ? body : children;
+        auto sibling = std::find_if(siblings.begin(), siblings.end(),
+            [&node](const std::shared_ptr<BaseCardElement>& item) { return item.get() == node->first; });
+        position.push_back(static_cast<size_t>(sibling - siblings.begin()));
+        if (parent == nullptr)
+        {
+            break;
+        }
+    }
+    std::reverse(position.begin(), position.end());
+    return position;
+}
+
+std::shared_ptr<BaseCardElement> ElementIdIndex::Lock(const BaseCardElement* element) const
+{
+    auto node = m_nodes.find(element);
+    return (node != m_nodes.end()) ? node->second.element.lock() : nullptr;
+}
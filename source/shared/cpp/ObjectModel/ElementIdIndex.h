@@ -0,0 +1,71 @@
+#pragma once
+
+#include "pch.h"
+#include "BaseCardElement.h"
+
+AdaptiveSharedNamespaceStart
+
+// Index of the elements of one card by id, along with the parent of each, so that elements can
+// be looked up without walking the body. It covers the body and everything nested in Containers,
+// ColumnSets, Columns and ImageSets, but not the cards of Action.ShowCard, which are indexed on
+// their own. Elements are held by weak reference.
+//
+// The index follows changes made through the AdaptiveCard mutation helpers. Changes made any
+// other way, such as through GetBody, GetItems or SetId, are not seen until it is rebuilt.
+class ElementIdIndex
+{
+public:
+    ElementIdIndex();
+
+    // Indexes element and everything under it as a child of parent, which is null for the body.
+    // Elements whose id is already taken are still indexed, and their ids appended to duplicateIds.
+    // The body is the one the element is in, and is used to order elements that share an id.
+    void Add(const std::shared_ptr<BaseCardElement>& element,
+        const BaseCardElement* parent,
+        const std::vector<std::shared_ptr<BaseCardElement>>& body,
+        std::vector<std::string>& duplicateIds);
+
+    // Drops element and everything under it
+    void Remove(const BaseCardElement* element);
+
+    // Moves element from oldId to the id it has now. Returns false if that id was already taken.
+    bool UpdateId(const BaseCardElement* element, const std::string& oldId, const std::vector<std::shared_ptr<BaseCardElement>>& body);
+
+    // Element with the given id, or null. If several elements share the id, the first of them in
+    // document order, as with a walk of the body.
+    std::shared_ptr<BaseCardElement> GetElement(const std::string& id) const;
+
+    // Ancestors of the element with the given id, outermost first, ending with its parent. Empty
+    // for elements of the body and for ids that are not in the index.
+    std::vector<std::shared_ptr<BaseCardElement>> GetParentPath(const std::string& id) const;
+
+    // Parent of an indexed element, or null for elements of the body
+    std::shared_ptr<BaseCardElement> GetParent(const BaseCardElement* element) const;
+
+    bool Contains(const BaseCardElement* element) const;
+    size_t GetElementCount() const;
+
+    // Appends the elements nested directly in element, in document order
+    static void GetChildren(const BaseCardElement& element, std::vector<std::shared_ptr<BaseCardElement>>& children);
+
+private:
+    struct Node
+    {
+        std::weak_ptr<BaseCardElement> element;
+        const BaseCardElement* parent;
+    };
+
+    bool AddId(const std::string& id, const BaseCardElement* element, const std::vector<std::shared_ptr<BaseCardElement>>& body);
+    void RemoveId(const std::string& id, const BaseCardElement* element);
+    bool IsBefore(const BaseCardElement* element, const BaseCardElement* other, const std::vector<std::shared_ptr<BaseCardElement>>& body) const;
+    std::vector<size_t> GetPosition(const BaseCardElement* element, const std::vector<std::shared_ptr<BaseCardElement>>& body) const;
+    std::shared_ptr<BaseCardElement> Lock(const BaseCardElement* element) const;
+
+    std::unordered_map<const BaseCardElement*, Node> m_nodes;
+
+    // Elements with each id in document order. The first holds the id, and the next takes over
+    // when it is removed.
+    std::unordered_map<std::string, std::vector<const BaseCardElement*>> m_ids;
+};
+
+AdaptiveSharedNamespaceEnd
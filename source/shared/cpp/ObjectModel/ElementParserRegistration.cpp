@@ -15,25 +15,28 @@
 #include "UnknownElement.h"
 
 AdaptiveSharedNamespaceStart
-    ElementParserRegistration::ElementParserRegistration()
+    ElementParserRegistration::ElementParserRegistration() :
+        m_isReadOnly(false),
+        m_isIdIndexingEnabled(false),
+        m_generation(0)
     {
-        m_knownElements.insert({ 
-            CardElementTypeToString(CardElementType::Container),
-            CardElementTypeToString(CardElementType::ColumnSet),
-            CardElementTypeToString(CardElementType::FactSet),
-            CardElementTypeToString(CardElementType::Image),
-            CardElementTypeToString(CardElementType::ImageSet),
-            CardElementTypeToString(CardElementType::ChoiceSetInput),
-            CardElementTypeToString(CardElementType::DateInput),
-            CardElementTypeToString(CardElementType::NumberInput),
-            CardElementTypeToString(CardElementType::TextBlock),
-            CardElementTypeToString(CardElementType::TextInput),
-            CardElementTypeToString(CardElementType::TimeInput),
-            CardElementTypeToString(CardElementType::ToggleInput),
-            CardElementTypeToString(CardElementType::Unknown),
-        });
+    }
+
+    std::shared_ptr<ElementParserRegistration> ElementParserRegistration::GetDefault()
+    {
+        static const std::shared_ptr<ElementParserRegistration> defaultRegistration = []()
+        {
+            auto registration = std::make_shared<ElementParserRegistration>();
+            registration->m_isReadOnly = true;
+            return registration;
+        }();
+        return defaultRegistration;
+    }
 
-        m_cardElementParsers.insert({
+    const ElementParserRegistration::ParserMap& ElementParserRegistration::GetKnownParsers()
+    {
+        static const ParserMap knownParsers =
+        {
             { CardElementTypeToString(CardElementType::Container), std::make_shared<ContainerParser>() },
             { CardElementTypeToString(CardElementType::ColumnSet), std::make_shared<ColumnSetParser>() },
             { CardElementTypeToString(CardElementType::FactSet), std::make_shared<FactSetParser>() },
@@ -47,37 +50,72 @@ AdaptiveSharedNamespaceStart
             { CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>() },
             { CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>() },
             { CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>() }
-        });
+        };
+        return knownParsers;
     }
 
-    void ElementParserRegistration::AddParser(std::string elementType, std::shared_ptr<BaseCardElementParser> parser)
+    void ElementParserRegistration::ThrowIfKnownOrReadOnly(const std::string& elementType) const
     {
-        if (m_knownElements.find(elementType) == m_knownElements.end())
+        if (GetKnownParsers().find(elementType) != GetKnownParsers().end())
         {
-            ElementParserRegistration::m_cardElementParsers[elementType] = parser;
+            throw AdaptiveCardParseException(ErrorStatusCode::UnsupportedParserOverride, "Overriding known element parsers is unsupported");
         }
-        else
+
+        if (m_isReadOnly)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::UnsupportedParserOverride, "Overriding known element parsers is unsupported");
+            throw AdaptiveCardParseException(ErrorStatusCode::UnsupportedParserOverride, "The default element parser registration cannot be modified");
         }
     }
 
+    void ElementParserRegistration::AddParser(std::string elementType, std::shared_ptr<BaseCardElementParser> parser)
+    {
+        ThrowIfKnownOrReadOnly(elementType);
+        m_cardElementParsers[elementType] = parser;
+        ++m_generation;
+    }
+
     void ElementParserRegistration::RemoveParser(std::string elementType)
     {
-        if (m_knownElements.find(elementType) == m_knownElements.end())
-        {
-            ElementParserRegistration::m_cardElementParsers.erase(elementType);
-        }
-        else
+        ThrowIfKnownOrReadOnly(elementType);
+        m_cardElementParsers.erase(elementType);
+        ++m_generation;
+    }
+
+    bool ElementParserRegistration::IsKnownType(const std::string& elementType)
+    {
+        return GetKnownParsers().find(elementType) != GetKnownParsers().end();
+    }
+
+    unsigned long long ElementParserRegistration::GetGeneration() const
+    {
+        return m_generation;
+    }
+
+    void ElementParserRegistration::SetIdIndexingEnabled(bool isEnabled)
+    {
+        if (m_isReadOnly)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::UnsupportedParserOverride, "Overriding known element parsers is unsupported");
+            throw AdaptiveCardParseException(ErrorStatusCode::UnsupportedParserOverride, "The default element parser registration cannot be modified");
         }
+        m_isIdIndexingEnabled = isEnabled;
+        ++m_generation;
+    }
+
+    bool ElementParserRegistration::IsIdIndexingEnabled() const
+    {
+        return m_isIdIndexingEnabled;
     }
 
-    std::shared_ptr<BaseCardElementParser> ElementParserRegistration::GetParser(std::string elementType)
+    std::shared_ptr<BaseCardElementParser> ElementParserRegistration::GetParser(const std::string& elementType) const
     {
+        auto knownParser = GetKnownParsers().find(elementType);
+        if (knownParser != GetKnownParsers().end())
+        {
+            return knownParser->second;
+        }
+
         auto parser = m_cardElementParsers.find(elementType);
-        if (parser != ElementParserRegistration::m_cardElementParsers.end())
+        if (parser != m_cardElementParsers.end())
         {
             return parser->second;
         }
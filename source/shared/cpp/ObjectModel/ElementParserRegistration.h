@@ -22,14 +22,40 @@ AdaptiveSharedNamespaceStart
     {
     public:
 
+        // Starts out with only the built-in parsers. The built-in table is shared by every
+        // registration, so construction is cheap and only custom parsers are stored per instance.
         ElementParserRegistration();
 
+        // Process-wide registration with only the built-in parsers, used when callers don't
+        // supply one. It is shared across threads, so AddParser and RemoveParser on it throw.
+        static std::shared_ptr<ElementParserRegistration> GetDefault();
+
         void AddParser(std::string elementType, std::shared_ptr<AdaptiveSharedNamespace::BaseCardElementParser> parser);
         void RemoveParser(std::string elementType);
-        std::shared_ptr<AdaptiveSharedNamespace::BaseCardElementParser> GetParser(std::string elementType);
+        std::shared_ptr<AdaptiveSharedNamespace::BaseCardElementParser> GetParser(const std::string& elementType) const;
+
+        // True for the built-in element types, whose parsers cannot be replaced
+        static bool IsKnownType(const std::string& elementType);
+
+        // Changes whenever a parser is added or removed or a setting changes, so that results
+        // cached for this registration (see ParseCache) can tell when they are stale
+        unsigned long long GetGeneration() const;
+
+        // When set, parsed cards come with an index of their elements by id (see
+        // AdaptiveCard::GetElementIndex), and ids used more than once raise
+        // WarningStatusCode::DuplicateId. Off by default.
+        void SetIdIndexingEnabled(bool isEnabled);
+        bool IsIdIndexingEnabled() const;
 
     private:
-        std::unordered_set<std::string> m_knownElements;
-        std::unordered_map<std::string, std::shared_ptr<AdaptiveSharedNamespace::BaseCardElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_cardElementParsers;
+        typedef std::unordered_map<std::string, std::shared_ptr<AdaptiveSharedNamespace::BaseCardElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> ParserMap;
+
+        static const ParserMap& GetKnownParsers();
+        void ThrowIfKnownOrReadOnly(const std::string& elementType) const;
+
+        ParserMap m_cardElementParsers;
+        bool m_isReadOnly;
+        bool m_isIdIndexingEnabled;
+        unsigned long long m_generation;
     };
 AdaptiveSharedNamespaceEnd
@@ -3,11 +3,9 @@
 
 AdaptiveSharedNamespaceStart
 
-void GetAdaptiveCardSchemaKeyEnumMappings(
-    std::unordered_map<AdaptiveCardSchemaKey, std::string, EnumHash> * adaptiveCardSchemaKeyEnumToNameOut,
-    std::unordered_map<std::string, AdaptiveCardSchemaKey, CaseInsensitiveHash, CaseInsensitiveEqualTo> * adaptiveCardSchemaKeyNameToEnumOut)
+const EnumMappings<AdaptiveCardSchemaKey>& GetAdaptiveCardSchemaKeyEnumMappings()
 {
-    static std::unordered_map<AdaptiveCardSchemaKey, std::string, EnumHash> adaptiveCardSchemaKeyEnumToName =
+    static const EnumMappings<AdaptiveCardSchemaKey> adaptiveCardSchemaKeyEnumMappings(
     {
         { AdaptiveCardSchemaKey::Accent, "accent" },
         { AdaptiveCardSchemaKey::ActionAlignment, "actionAlignment" },
@@ -127,25 +125,14 @@ void GetAdaptiveCardSchemaKeyEnumMappings(
         { AdaptiveCardSchemaKey::Weight, "weight" },
         { AdaptiveCardSchemaKey::Width, "width" },
         { AdaptiveCardSchemaKey::Wrap, "wrap" }
-    };
-    static std::unordered_map<std::string, AdaptiveCardSchemaKey, CaseInsensitiveHash, CaseInsensitiveEqualTo> adaptiveCardSchemaKeyNameToEnum = GenerateStringToEnumMap<AdaptiveCardSchemaKey>(adaptiveCardSchemaKeyEnumToName);
+    });
 
-    if (adaptiveCardSchemaKeyEnumToNameOut != nullptr)
-    {
-        *adaptiveCardSchemaKeyEnumToNameOut = adaptiveCardSchemaKeyEnumToName;
-    }
-
-    if (adaptiveCardSchemaKeyNameToEnumOut != nullptr)
-    {
-        *adaptiveCardSchemaKeyNameToEnumOut = adaptiveCardSchemaKeyNameToEnum;
-    }
+    return adaptiveCardSchemaKeyEnumMappings;
 }
 
-void GetCardElementTypeEnumMappings(
-    std::unordered_map<CardElementType, std::string, EnumHash> * cardElementTypeEnumToNameOut,
-    std::unordered_map<std::string, CardElementType, CaseInsensitiveHash, CaseInsensitiveEqualTo> * cardElementTypeNameToEnumOut)
+const EnumMappings<CardElementType>& GetCardElementTypeEnumMappings()
 {
-    static std::unordered_map<CardElementType, std::string, EnumHash> cardElementTypeEnumToName =
+    static const EnumMappings<CardElementType> cardElementTypeEnumMappings(
     {
         { CardElementType::AdaptiveCard, "AdaptiveCard" },
         { CardElementType::Column, "Column" },
@@ -164,861 +151,404 @@ void GetCardElementTypeEnumMappings(
         { CardElementType::TextBlock, "TextBlock" },
         { CardElementType::Custom, "Custom" },
         { CardElementType::Unknown, "Unknown" }
-    };
-    static std::unordered_map<std::string, CardElementType, CaseInsensitiveHash, CaseInsensitiveEqualTo> cardElementTypeNameToEnum = GenerateStringToEnumMap<CardElementType>(cardElementTypeEnumToName);
-
-    if (cardElementTypeEnumToNameOut != nullptr)
-    {
-        *cardElementTypeEnumToNameOut = cardElementTypeEnumToName;
-    }
+    });
 
-    if (cardElementTypeNameToEnumOut != nullptr)
-    {
-        *cardElementTypeNameToEnumOut = cardElementTypeNameToEnum;
-    }
+    return cardElementTypeEnumMappings;
 }
 
-void GetActionTypeEnumMappings(
-    std::unordered_map<ActionType, std::string, EnumHash> * actionTypeEnumToNameOut,
-    std::unordered_map<std::string, ActionType, CaseInsensitiveHash, CaseInsensitiveEqualTo> * actionTypeNameToEnumOut)
+const EnumMappings<ActionType>& GetActionTypeEnumMappings()
 {
-    static std::unordered_map<ActionType, std::string, EnumHash> actionTypeEnumToName =
+    static const EnumMappings<ActionType> actionTypeEnumMappings(
     {
         { ActionType::OpenUrl, "Action.OpenUrl" },
         { ActionType::ShowCard, "Action.ShowCard" },
         { ActionType::Submit, "Action.Submit" },
         { ActionType::Custom, "Custom" }
-    };
-    static std::unordered_map<std::string, ActionType, CaseInsensitiveHash, CaseInsensitiveEqualTo> actionTypeNameToEnum = GenerateStringToEnumMap<ActionType>(actionTypeEnumToName);
+    });
 
-    if (actionTypeEnumToNameOut != nullptr)
-    {
-        *actionTypeEnumToNameOut = actionTypeEnumToName;
-    }
-
-    if (actionTypeNameToEnumOut != nullptr)
-    {
-        *actionTypeNameToEnumOut = actionTypeNameToEnum;
-    }
+    return actionTypeEnumMappings;
 }
 
-void GetSpacingMappings(
-    std::unordered_map<Spacing, std::string, EnumHash> * spacingEnumToNameOut,
-    std::unordered_map<std::string, Spacing, CaseInsensitiveHash, CaseInsensitiveEqualTo> * spacingNameToEnumOut)
+const EnumMappings<Spacing>& GetSpacingMappings()
 {
-    static std::unordered_map<Spacing, std::string, EnumHash> spacingEnumToName =
-        {
-            { Spacing::Default, "default" },
-            { Spacing::None, "none" },
-            { Spacing::Small, "small" },
-            { Spacing::Medium, "medium" },
-            { Spacing::Large, "large" },
-            { Spacing::ExtraLarge, "extraLarge" },
-            { Spacing::Padding, "padding" },
-        };
-    static std::unordered_map<std::string, Spacing, CaseInsensitiveHash, CaseInsensitiveEqualTo> spacingNameToEnum = GenerateStringToEnumMap<Spacing>(spacingEnumToName);
-
-    if (spacingEnumToNameOut != nullptr)
+    static const EnumMappings<Spacing> spacingEnumMappings(
     {
-        *spacingEnumToNameOut = spacingEnumToName;
-    }
+        { Spacing::Default, "default" },
+        { Spacing::None, "none" },
+        { Spacing::Small, "small" },
+        { Spacing::Medium, "medium" },
+        { Spacing::Large, "large" },
+        { Spacing::ExtraLarge, "extraLarge" },
+        { Spacing::Padding, "padding" }
+    });
 
-    if (spacingNameToEnumOut != nullptr)
-    {
-        *spacingNameToEnumOut = spacingNameToEnum;
-    }
+    return spacingEnumMappings;
 }
 
-void GetSeparatorThicknessEnumMappings(
-    std::unordered_map<SeparatorThickness, std::string, EnumHash> *separatorThicknessEnumToNameOut,
-    std::unordered_map<std::string, SeparatorThickness, CaseInsensitiveHash, CaseInsensitiveEqualTo> * separatorThicknessNameToEnumOut)
+const EnumMappings<SeparatorThickness>& GetSeparatorThicknessEnumMappings()
 {
-    static std::unordered_map<SeparatorThickness, std::string, EnumHash> separatorThicknessEnumToName =
+    static const EnumMappings<SeparatorThickness> separatorThicknessEnumMappings(
     {
         { SeparatorThickness::Default, "default" },
-        { SeparatorThickness::Thick, "thick" },
-    };
-    static std::unordered_map<std::string, SeparatorThickness, CaseInsensitiveHash, CaseInsensitiveEqualTo> separatorThicknessNameToEnum = GenerateStringToEnumMap<SeparatorThickness>(separatorThicknessEnumToName);
-
-    if (separatorThicknessEnumToNameOut != nullptr)
-    {
-        *separatorThicknessEnumToNameOut = separatorThicknessEnumToName;
-    }
+        { SeparatorThickness::Thick, "thick" }
+    });
 
-    if (separatorThicknessNameToEnumOut != nullptr)
-    {
-        *separatorThicknessNameToEnumOut = separatorThicknessNameToEnum;
-    }
+    return separatorThicknessEnumMappings;
 }
 
-void GetImageStyleEnumMappings(
-    std::unordered_map<ImageStyle, std::string, EnumHash> * imageStyleEnumToNameOut,
-    std::unordered_map<std::string, ImageStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> * imageStyleNameToEnumOut)
+const EnumMappings<ImageStyle>& GetImageStyleEnumMappings()
 {
-    static std::unordered_map<ImageStyle, std::string, EnumHash> imageStyleEnumToName =
+    static const EnumMappings<ImageStyle> imageStyleEnumMappings(
     {
         { ImageStyle::Default, "default" },
         { ImageStyle::Person, "person" }
-    };
-
-    static std::unordered_map<std::string, ImageStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> imageStyleNameToEnum =
+    },
     {
-        { "default", ImageStyle::Default },
-        { "person", ImageStyle::Person },
         { "normal", ImageStyle::Default } // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-    };
-
-    if (imageStyleEnumToNameOut != nullptr)
-    {
-        *imageStyleEnumToNameOut = imageStyleEnumToName;
-    }
+    });
 
-    if (imageStyleNameToEnumOut != nullptr)
-    {
-        *imageStyleNameToEnumOut = imageStyleNameToEnum;
-    }
+    return imageStyleEnumMappings;
 }
 
-void GetImageSizeEnumMappings(
-    std::unordered_map<ImageSize, std::string, EnumHash> * imageSizeEnumToNameOut,
-    std::unordered_map<std::string, ImageSize, CaseInsensitiveHash, CaseInsensitiveEqualTo> * imageSizeNameToEnumOut)
+const EnumMappings<ImageSize>& GetImageSizeEnumMappings()
 {
-    static std::unordered_map<ImageSize, std::string, EnumHash> imageSizeEnumToName =
+    static const EnumMappings<ImageSize> imageSizeEnumMappings(
     {
         { ImageSize::Auto, "Auto" },
         { ImageSize::Large, "Large" },
         { ImageSize::Medium, "Medium" },
         { ImageSize::Small, "Small" },
-        { ImageSize::Stretch, "Stretch" },
-    };
-    static std::unordered_map<std::string, ImageSize, CaseInsensitiveHash, CaseInsensitiveEqualTo> imageSizeNameToEnum = GenerateStringToEnumMap<ImageSize>(imageSizeEnumToName);
+        { ImageSize::Stretch, "Stretch" }
+    });
 
-    if (imageSizeEnumToNameOut != nullptr)
-    {
-        *imageSizeEnumToNameOut = imageSizeEnumToName;
-    }
-
-    if (imageSizeNameToEnumOut != nullptr)
-    {
-        *imageSizeNameToEnumOut = imageSizeNameToEnum;
-    }
-};
+    return imageSizeEnumMappings;
+}
 
-void GetHorizontalAlignmentEnumMappings(
-    std::unordered_map<HorizontalAlignment, std::string, EnumHash> * horizontalAlignmentEnumToNameOut,
-    std::unordered_map<std::string, HorizontalAlignment, CaseInsensitiveHash, CaseInsensitiveEqualTo> * horizontalAlignmentNameToEnumOut)
+const EnumMappings<HorizontalAlignment>& GetHorizontalAlignmentEnumMappings()
 {
-    static std::unordered_map<HorizontalAlignment, std::string, EnumHash> horizontalAlignmentEnumToName =
-    {
-        {HorizontalAlignment::Center, "Center"},
-        {HorizontalAlignment::Left, "Left"},
-        {HorizontalAlignment::Right, "Right"}
-    };
-    static std::unordered_map<std::string, HorizontalAlignment, CaseInsensitiveHash, CaseInsensitiveEqualTo> horizontalAlignmentNameToEnum = GenerateStringToEnumMap<HorizontalAlignment>(horizontalAlignmentEnumToName);
-
-    if (horizontalAlignmentEnumToNameOut != nullptr)
+    static const EnumMappings<HorizontalAlignment> horizontalAlignmentEnumMappings(
     {
-        *horizontalAlignmentEnumToNameOut = horizontalAlignmentEnumToName;
-    }
+        { HorizontalAlignment::Center, "Center" },
+        { HorizontalAlignment::Left, "Left" },
+        { HorizontalAlignment::Right, "Right" }
+    });
 
-    if (horizontalAlignmentNameToEnumOut != nullptr)
-    {
-        *horizontalAlignmentNameToEnumOut = horizontalAlignmentNameToEnum;
-    }
-};
+    return horizontalAlignmentEnumMappings;
+}
 
-void GetColorEnumMappings(
-    std::unordered_map<ForegroundColor, std::string, EnumHash> * colorEnumToNameOut,
-    std::unordered_map<std::string, ForegroundColor, CaseInsensitiveHash, CaseInsensitiveEqualTo> * colorNameToEnumOut)
+const EnumMappings<ForegroundColor>& GetColorEnumMappings()
 {
-    static std::unordered_map<ForegroundColor, std::string, EnumHash> colorEnumToName =
-    {
-        {ForegroundColor::Accent, "Accent"},
-        {ForegroundColor::Attention, "Attention"},
-        {ForegroundColor::Dark, "Dark" },
-        {ForegroundColor::Default, "Default"},
-        {ForegroundColor::Good, "Good"},
-        {ForegroundColor::Light, "Light" },
-        {ForegroundColor::Warning, "Warning"},
-    };
-    static std::unordered_map<std::string, ForegroundColor, CaseInsensitiveHash, CaseInsensitiveEqualTo> colorNameToEnum = GenerateStringToEnumMap<ForegroundColor>(colorEnumToName);
-
-    if (colorEnumToNameOut != nullptr)
+    static const EnumMappings<ForegroundColor> colorEnumMappings(
     {
-        *colorEnumToNameOut = colorEnumToName;
-    }
+        { ForegroundColor::Accent, "Accent" },
+        { ForegroundColor::Attention, "Attention" },
+        { ForegroundColor::Dark, "Dark" },
+        { ForegroundColor::Default, "Default" },
+        { ForegroundColor::Good, "Good" },
+        { ForegroundColor::Light, "Light" },
+        { ForegroundColor::Warning, "Warning" }
+    });
 
-    if (colorNameToEnumOut != nullptr)
-    {
-        *colorNameToEnumOut = colorNameToEnum;
-    }
+    return colorEnumMappings;
 }
 
-void GetTextWeightEnumMappings(
-    std::unordered_map<TextWeight, std::string, EnumHash> * textWeightEnumToNameOut,
-    std::unordered_map<std::string, TextWeight, CaseInsensitiveHash, CaseInsensitiveEqualTo> * textWeightNameToEnumOut)
+const EnumMappings<TextWeight>& GetTextWeightEnumMappings()
 {
-    static std::unordered_map<TextWeight, std::string, EnumHash> textWeightEnumToName =
+    static const EnumMappings<TextWeight> textWeightEnumMappings(
     {
-        {TextWeight::Bolder, "Bolder"},
-        {TextWeight::Lighter, "Lighter"},
-        {TextWeight::Default, "Default"},
-    };
-
-    static std::unordered_map<std::string, TextWeight, CaseInsensitiveHash, CaseInsensitiveEqualTo> textWeightNameToEnum =
+        { TextWeight::Bolder, "Bolder" },
+        { TextWeight::Lighter, "Lighter" },
+        { TextWeight::Default, "Default" }
+    },
     {
-        { "Bolder", TextWeight::Bolder },
-        { "Lighter", TextWeight::Lighter },
-        { "Default", TextWeight::Default },
-        { "Normal", TextWeight::Default }, // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-    };
+        { "Normal", TextWeight::Default } // Back compat to support "Normal" for "Default" for pre V1.0 payloads
+    });
 
-    if (textWeightEnumToNameOut != nullptr)
-    {
-        *textWeightEnumToNameOut = textWeightEnumToName;
-    }
-
-    if (textWeightNameToEnumOut != nullptr)
-    {
-        *textWeightNameToEnumOut = textWeightNameToEnum;
-    }
+    return textWeightEnumMappings;
 }
 
-void GetTextSizeEnumMappings(
-    std::unordered_map<TextSize, std::string, EnumHash> * textSizeEnumToNameOut,
-    std::unordered_map<std::string, TextSize, CaseInsensitiveHash, CaseInsensitiveEqualTo> * textSizeNameToEnumOut)
+const EnumMappings<TextSize>& GetTextSizeEnumMappings()
 {
-    static std::unordered_map<TextSize, std::string, EnumHash> textSizeEnumToName =
-    {
-        {TextSize::ExtraLarge, "ExtraLarge"},
-        {TextSize::Large, "Large"},
-        {TextSize::Medium, "Medium"},
-        {TextSize::Default, "Default"},
-        {TextSize::Small, "Small"},
-    };
-
-    static std::unordered_map<std::string, TextSize, CaseInsensitiveHash, CaseInsensitiveEqualTo> textSizeNameToEnum =
+    static const EnumMappings<TextSize> textSizeEnumMappings(
     {
-        { "ExtraLarge", TextSize::ExtraLarge },
-        { "Large", TextSize::Large },
-        { "Medium", TextSize::Medium },
-        { "Default", TextSize::Default },
-        { "Small", TextSize::Small },
-        { "Normal", TextSize::Default }, // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-    };
-
-    if (textSizeEnumToNameOut != nullptr)
+        { TextSize::ExtraLarge, "ExtraLarge" },
+        { TextSize::Large, "Large" },
+        { TextSize::Medium, "Medium" },
+        { TextSize::Default, "Default" },
+        { TextSize::Small, "Small" }
+    },
     {
-        *textSizeEnumToNameOut = textSizeEnumToName;
-    }
+        { "Normal", TextSize::Default } // Back compat to support "Normal" for "Default" for pre V1.0 payloads
+    });
 
-    if (textSizeNameToEnumOut != nullptr)
-    {
-        *textSizeNameToEnumOut = textSizeNameToEnum;
-    }
+    return textSizeEnumMappings;
 }
 
-void GetActionsOrientationEnumMappings(
-    std::unordered_map<ActionsOrientation, std::string, EnumHash> * actionsOrientationEnumToNameOut,
-    std::unordered_map<std::string, ActionsOrientation, CaseInsensitiveHash, CaseInsensitiveEqualTo> * actionsOrientationNameToEnumOut)
+const EnumMappings<ActionsOrientation>& GetActionsOrientationEnumMappings()
 {
-    static std::unordered_map<ActionsOrientation, std::string, EnumHash> actionsOrientationEnumToName =
+    static const EnumMappings<ActionsOrientation> actionsOrientationEnumMappings(
     {
         { ActionsOrientation::Horizontal, "Horizontal" },
-        { ActionsOrientation::Vertical, "Vertical" },
-    };
-    static std::unordered_map<std::string, ActionsOrientation, CaseInsensitiveHash, CaseInsensitiveEqualTo> actionsOrientationNameToEnum = GenerateStringToEnumMap<ActionsOrientation>(actionsOrientationEnumToName);
+        { ActionsOrientation::Vertical, "Vertical" }
+    });
 
-    if (actionsOrientationEnumToNameOut != nullptr)
-    {
-        *actionsOrientationEnumToNameOut = actionsOrientationEnumToName;
-    }
-
-    if (actionsOrientationNameToEnumOut != nullptr)
-    {
-        *actionsOrientationNameToEnumOut = actionsOrientationNameToEnum;
-    }
+    return actionsOrientationEnumMappings;
 }
 
-void GetActionModeEnumMappings(
-    std::unordered_map<ActionMode, std::string, EnumHash> * actionModeEnumToNameOut,
-    std::unordered_map<std::string, ActionMode, CaseInsensitiveHash, CaseInsensitiveEqualTo> * actionModeNameToEnumOut)
+const EnumMappings<ActionMode>& GetActionModeEnumMappings()
 {
-    static std::unordered_map<ActionMode, std::string, EnumHash> actionModeEnumToName =
+    static const EnumMappings<ActionMode> actionModeEnumMappings(
     {
         { ActionMode::Inline, "Inline" },
         { ActionMode::Popup, "Popup" }
-    };
-    static std::unordered_map<std::string, ActionMode, CaseInsensitiveHash, CaseInsensitiveEqualTo> actionModeNameToEnum = GenerateStringToEnumMap<ActionMode>(actionModeEnumToName);
+    });
 
-    if (actionModeEnumToNameOut != nullptr)
-    {
-        *actionModeEnumToNameOut = actionModeEnumToName;
-    }
-
-    if (actionModeNameToEnumOut != nullptr)
-    {
-        *actionModeNameToEnumOut = actionModeNameToEnum;
-    }
+    return actionModeEnumMappings;
 }
 
-void GetChoiceSetStyleEnumMappings(
-    std::unordered_map<ChoiceSetStyle, std::string, EnumHash> * choiceSetStyleEnumToNameOut,
-    std::unordered_map<std::string, ChoiceSetStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> * choiceSetStyleNameToEnumOut)
+const EnumMappings<ChoiceSetStyle>& GetChoiceSetStyleEnumMappings()
 {
-    static std::unordered_map<ChoiceSetStyle, std::string, EnumHash> choiceSetStyleEnumToName =
+    static const EnumMappings<ChoiceSetStyle> choiceSetStyleEnumMappings(
     {
         { ChoiceSetStyle::Compact, "Compact" },
         { ChoiceSetStyle::Expanded, "Expanded" }
-    };
-    static std::unordered_map<std::string, ChoiceSetStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> choiceSetStyleNameToEnum = GenerateStringToEnumMap<ChoiceSetStyle>(choiceSetStyleEnumToName);
+    });
 
-    if (choiceSetStyleEnumToNameOut != nullptr)
-    {
-        *choiceSetStyleEnumToNameOut = choiceSetStyleEnumToName;
-    }
-
-    if (choiceSetStyleNameToEnumOut != nullptr)
-    {
-        *choiceSetStyleNameToEnumOut = choiceSetStyleNameToEnum;
-    }
-};
+    return choiceSetStyleEnumMappings;
+}
 
-void GetTextInputStyleEnumMappings(
-    std::unordered_map<TextInputStyle, std::string, EnumHash> * textInputStyleEnumToNameOut,
-    std::unordered_map<std::string, TextInputStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> * textInputStyleNameToEnumOut)
+const EnumMappings<TextInputStyle>& GetTextInputStyleEnumMappings()
 {
-    static std::unordered_map<TextInputStyle, std::string, EnumHash> textInputStyleEnumToName =
+    static const EnumMappings<TextInputStyle> textInputStyleEnumMappings(
     {
         { TextInputStyle::Email, "Email" },
         { TextInputStyle::Tel, "Tel" },
         { TextInputStyle::Text, "Text" },
-        { TextInputStyle::Url, "Url" },
-    };
-    static std::unordered_map<std::string, TextInputStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> textInputStyleNameToEnum = GenerateStringToEnumMap<TextInputStyle>(textInputStyleEnumToName);
-
-    if (textInputStyleEnumToNameOut != nullptr)
-    {
-        *textInputStyleEnumToNameOut = textInputStyleEnumToName;
-    }
+        { TextInputStyle::Url, "Url" }
+    });
 
-    if (textInputStyleNameToEnumOut != nullptr)
-    {
-        *textInputStyleNameToEnumOut = textInputStyleNameToEnum;
-    }
+    return textInputStyleEnumMappings;
 }
 
-void GetContainerStyleEnumMappings(
-    std::unordered_map<ContainerStyle, std::string, EnumHash> * containerStyleEnumToNameOut,
-    std::unordered_map<std::string, ContainerStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> * containerStyleNameToEnumOut)
+const EnumMappings<ContainerStyle>& GetContainerStyleEnumMappings()
 {
-    static std::unordered_map<ContainerStyle, std::string, EnumHash> containerStyleEnumToName =
+    static const EnumMappings<ContainerStyle> containerStyleEnumMappings(
     {
         { ContainerStyle::Default, "Default" },
-        { ContainerStyle::Emphasis, "Emphasis" },
-    };
-    static std::unordered_map<std::string, ContainerStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> containerStyleNameToEnum = GenerateStringToEnumMap<ContainerStyle>(containerStyleEnumToName);
-
-    if (containerStyleEnumToNameOut != nullptr)
-    {
-        *containerStyleEnumToNameOut = containerStyleEnumToName;
-    }
+        { ContainerStyle::Emphasis, "Emphasis" }
+    });
 
-    if (containerStyleNameToEnumOut != nullptr)
-    {
-        *containerStyleNameToEnumOut = containerStyleNameToEnum;
-    }
+    return containerStyleEnumMappings;
 }
 
-void GetActionAlignmentEnumMappings(
-    std::unordered_map<ActionAlignment, std::string, EnumHash> * actionAlignmentEnumToNameOut,
-    std::unordered_map<std::string, ActionAlignment, CaseInsensitiveHash, CaseInsensitiveEqualTo> * actionAlignmentNameToEnumOut)
+const EnumMappings<ActionAlignment>& GetActionAlignmentEnumMappings()
 {
-    static std::unordered_map<ActionAlignment, std::string, EnumHash> actionAlignmentEnumToName =
+    static const EnumMappings<ActionAlignment> actionAlignmentEnumMappings(
     {
         { ActionAlignment::Left, "Left" },
         { ActionAlignment::Center, "Center" },
         { ActionAlignment::Right, "Right" },
-        { ActionAlignment::Stretch, "Stretch" },
-    };
-    static std::unordered_map<std::string, ActionAlignment, CaseInsensitiveHash, CaseInsensitiveEqualTo> actionAlignmentNameToEnum = GenerateStringToEnumMap<ActionAlignment>(actionAlignmentEnumToName);
-
-    if (actionAlignmentEnumToNameOut != nullptr)
-    {
-        *actionAlignmentEnumToNameOut = actionAlignmentEnumToName;
-    }
+        { ActionAlignment::Stretch, "Stretch" }
+    });
 
-    if (actionAlignmentNameToEnumOut != nullptr)
-    {
-        *actionAlignmentNameToEnumOut = actionAlignmentNameToEnum;
-    }
+    return actionAlignmentEnumMappings;
 }
 
-void GetIconPlacementEnumMappings(
-    std::unordered_map<IconPlacement, std::string, EnumHash> * iconPlacementEnumToNameOut,
-    std::unordered_map<std::string, IconPlacement, CaseInsensitiveHash, CaseInsensitiveEqualTo> * iconPlacementNameToEnumOut)
+const EnumMappings<IconPlacement>& GetIconPlacementEnumMappings()
 {
-    static std::unordered_map<IconPlacement, std::string, EnumHash> iconPlacementnumToName =
+    static const EnumMappings<IconPlacement> iconPlacementEnumMappings(
     {
-        {IconPlacement::AboveTitle , "AboveTitle"},
-        {IconPlacement::LeftOfTitle, "LeftOfTitle"}
-    };
-    static std::unordered_map<std::string, IconPlacement, CaseInsensitiveHash, CaseInsensitiveEqualTo> iconPlacementNameToEnum = GenerateStringToEnumMap<IconPlacement>(iconPlacementnumToName);
+        { IconPlacement::AboveTitle, "AboveTitle" },
+        { IconPlacement::LeftOfTitle, "LeftOfTitle" }
+    });
 
-    if (iconPlacementEnumToNameOut != nullptr)
-    {
-        *iconPlacementEnumToNameOut = iconPlacementnumToName;
-    }
-
-    if (iconPlacementNameToEnumOut != nullptr)
-    {
-        *iconPlacementNameToEnumOut = iconPlacementNameToEnum;
-    }
+    return iconPlacementEnumMappings;
 }
 
-const std::string AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey type)
+const std::string& AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey type)
 {
-    std::unordered_map<AdaptiveCardSchemaKey, std::string, EnumHash> adaptiveCardSchemaKeyEnumToName;
-    GetAdaptiveCardSchemaKeyEnumMappings(&adaptiveCardSchemaKeyEnumToName, nullptr);
-
-    if (adaptiveCardSchemaKeyEnumToName.find(type) == adaptiveCardSchemaKeyEnumToName.end())
-    {
-        throw std::out_of_range("Invalid AdaptiveCardSchemaKey");
-    }
-
-    return adaptiveCardSchemaKeyEnumToName[type];
+    return GetAdaptiveCardSchemaKeyEnumMappings().ToString(type, "Invalid AdaptiveCardSchemaKey");
 }
 
 AdaptiveCardSchemaKey AdaptiveCardSchemaKeyFromString(const std::string& type)
 {
-    std::unordered_map<std::string, AdaptiveCardSchemaKey, CaseInsensitiveHash, CaseInsensitiveEqualTo> adaptiveCardSchemaKeyNameToEnum;
-    GetAdaptiveCardSchemaKeyEnumMappings(nullptr, &adaptiveCardSchemaKeyNameToEnum);
-
-    if (adaptiveCardSchemaKeyNameToEnum.find(type) == adaptiveCardSchemaKeyNameToEnum.end())
+    AdaptiveCardSchemaKey value;
+    if (!GetAdaptiveCardSchemaKeyEnumMappings().TryFromString(type, value))
     {
         throw std::out_of_range("Invalid AdaptiveCardSchemaKey: " + type);
     }
 
-    return adaptiveCardSchemaKeyNameToEnum[type];
+    return value;
 }
 
-const std::string CardElementTypeToString(CardElementType elementType)
+const std::string& CardElementTypeToString(CardElementType elementType)
 {
-    std::unordered_map<CardElementType, std::string, EnumHash> cardElementTypeEnumToName;
-    GetCardElementTypeEnumMappings(&cardElementTypeEnumToName, nullptr);
-
-    if (cardElementTypeEnumToName.find(elementType) == cardElementTypeEnumToName.end())
-    {
-        throw std::out_of_range("Invalid CardElementType");
-    }
-
-    return cardElementTypeEnumToName[elementType];
+    return GetCardElementTypeEnumMappings().ToString(elementType, "Invalid CardElementType");
 }
 
 CardElementType CardElementTypeFromString(const std::string& elementType)
 {
-    std::unordered_map<std::string, CardElementType, CaseInsensitiveHash, CaseInsensitiveEqualTo> cardElementTypeNameToEnum;
-    GetCardElementTypeEnumMappings(nullptr, &cardElementTypeNameToEnum);
-
-    if (cardElementTypeNameToEnum.find(elementType) == cardElementTypeNameToEnum.end())
-    {
-        return CardElementType::Unsupported;
-    }
-
-    return cardElementTypeNameToEnum[elementType];
+    return GetCardElementTypeEnumMappings().FromString(elementType, CardElementType::Unsupported);
 }
 
-const std::string ActionTypeToString(ActionType actionType)
+const std::string& ActionTypeToString(ActionType actionType)
 {
-    std::unordered_map<ActionType, std::string, EnumHash> actionTypeEnumToName;
-    GetActionTypeEnumMappings(&actionTypeEnumToName, nullptr);
-
-    if (actionTypeEnumToName.find(actionType) == actionTypeEnumToName.end())
-    {
-        throw std::out_of_range("Invalid ActionType");
-    }
-
-    return actionTypeEnumToName[actionType];
+    return GetActionTypeEnumMappings().ToString(actionType, "Invalid ActionType");
 }
 
 ActionType ActionTypeFromString(const std::string& actionType)
 {
-    std::unordered_map<std::string, ActionType, CaseInsensitiveHash, CaseInsensitiveEqualTo> actionTypeNameToEnum;
-    GetActionTypeEnumMappings(nullptr, &actionTypeNameToEnum);
-
-    if (actionTypeNameToEnum.find(actionType) == actionTypeNameToEnum.end())
-    {
-        return ActionType::Unsupported;
-    }
-
-    return actionTypeNameToEnum[actionType];
+    return GetActionTypeEnumMappings().FromString(actionType, ActionType::Unsupported);
 }
 
-const std::string HorizontalAlignmentToString(HorizontalAlignment alignment)
+const std::string& HorizontalAlignmentToString(HorizontalAlignment alignment)
 {
-    std::unordered_map<HorizontalAlignment, std::string, EnumHash> horizontalAlignmentEnumToName;
-    GetHorizontalAlignmentEnumMappings(&horizontalAlignmentEnumToName, nullptr);
-
-    if (horizontalAlignmentEnumToName.find(alignment) == horizontalAlignmentEnumToName.end())
-    {
-        throw std::out_of_range("Invalid HorizontalAlignment type");
-    }
-    return horizontalAlignmentEnumToName[alignment];
+    return GetHorizontalAlignmentEnumMappings().ToString(alignment, "Invalid HorizontalAlignment type");
 }
 
 HorizontalAlignment HorizontalAlignmentFromString(const std::string& alignment)
 {
-    std::unordered_map<std::string, HorizontalAlignment, CaseInsensitiveHash, CaseInsensitiveEqualTo> horizontalAlignmentNameToEnum;
-    GetHorizontalAlignmentEnumMappings(nullptr, &horizontalAlignmentNameToEnum);
-
-    if (horizontalAlignmentNameToEnum.find(alignment) == horizontalAlignmentNameToEnum.end())
-    {
-        return HorizontalAlignment::Left;
-    }
-
-    return horizontalAlignmentNameToEnum[alignment];
+    return GetHorizontalAlignmentEnumMappings().FromString(alignment, HorizontalAlignment::Left);
 }
 
-const std::string ForegroundColorToString(ForegroundColor color)
+const std::string& ForegroundColorToString(ForegroundColor color)
 {
-    std::unordered_map<ForegroundColor, std::string, EnumHash> colorEnumToName;
-    GetColorEnumMappings(&colorEnumToName, nullptr);
-
-    if (colorEnumToName.find(color) == colorEnumToName.end())
-    {
-        throw std::out_of_range("Invalid ForegroundColor type");
-    }
-    return colorEnumToName[color];
+    return GetColorEnumMappings().ToString(color, "Invalid ForegroundColor type");
 }
 
 ForegroundColor ForegroundColorFromString(const std::string& color)
 {
-    std::unordered_map<std::string, ForegroundColor, CaseInsensitiveHash, CaseInsensitiveEqualTo> colorNameToEnum;
-    GetColorEnumMappings(nullptr, &colorNameToEnum);
-
-    if (colorNameToEnum.find(color) == colorNameToEnum.end())
-    {
-        return ForegroundColor::Default;
-    }
-
-    return colorNameToEnum[color];
+    return GetColorEnumMappings().FromString(color, ForegroundColor::Default);
 }
 
-const std::string TextWeightToString(TextWeight weight)
+const std::string& TextWeightToString(TextWeight weight)
 {
-    std::unordered_map<TextWeight, std::string, EnumHash> textWeightEnumToName;
-    GetTextWeightEnumMappings(&textWeightEnumToName, nullptr);
-
-    if (textWeightEnumToName.find(weight) == textWeightEnumToName.end())
-    {
-        throw std::out_of_range("Invalid TextWeight type");
-    }
-    return textWeightEnumToName[weight];
+    return GetTextWeightEnumMappings().ToString(weight, "Invalid TextWeight type");
 }
 
 TextWeight TextWeightFromString(const std::string& weight)
 {
-    std::unordered_map<std::string, TextWeight, CaseInsensitiveHash, CaseInsensitiveEqualTo> textWeightNameToEnum;
-    GetTextWeightEnumMappings(nullptr, &textWeightNameToEnum);
-
-    if (textWeightNameToEnum.find(weight) == textWeightNameToEnum.end())
-    {
-        return TextWeight::Default;
-    }
-
-    return textWeightNameToEnum[weight];
+    return GetTextWeightEnumMappings().FromString(weight, TextWeight::Default);
 }
 
-const std::string TextSizeToString(TextSize size)
+const std::string& TextSizeToString(TextSize size)
 {
-    std::unordered_map<TextSize, std::string, EnumHash> textSizeEnumToName;
-    GetTextSizeEnumMappings(&textSizeEnumToName, nullptr);
-
-    if (textSizeEnumToName.find(size) == textSizeEnumToName.end())
-    {
-        throw std::out_of_range("Invalid TextSize type");
-    }
-    return textSizeEnumToName[size];
+    return GetTextSizeEnumMappings().ToString(size, "Invalid TextSize type");
 }
 
 TextSize TextSizeFromString(const std::string& size)
 {
-    std::unordered_map<std::string, TextSize, CaseInsensitiveHash, CaseInsensitiveEqualTo> textSizeNameToEnum;
-    GetTextSizeEnumMappings(nullptr, &textSizeNameToEnum);
-
-    if (textSizeNameToEnum.find(size) == textSizeNameToEnum.end())
-    {
-        return TextSize::Default;
-    }
-
-    return textSizeNameToEnum[size];
+    return GetTextSizeEnumMappings().FromString(size, TextSize::Default);
 }
 
-const std::string ImageSizeToString(ImageSize size)
+const std::string& ImageSizeToString(ImageSize size)
 {
-    std::unordered_map<ImageSize, std::string, EnumHash> imageSizeEnumToName;
-    GetImageSizeEnumMappings(&imageSizeEnumToName, nullptr);
-
-    if (imageSizeEnumToName.find(size) == imageSizeEnumToName.end())
-    {
-        throw std::out_of_range("Invalid ImageSize type");
-    }
-    return imageSizeEnumToName[size];
+    return GetImageSizeEnumMappings().ToString(size, "Invalid ImageSize type");
 }
 
 ImageSize ImageSizeFromString(const std::string& size)
 {
-    std::unordered_map<std::string, ImageSize, CaseInsensitiveHash, CaseInsensitiveEqualTo> imageSizeNameToEnum;
-    GetImageSizeEnumMappings(nullptr, &imageSizeNameToEnum);
-
-    if (imageSizeNameToEnum.find(size) == imageSizeNameToEnum.end())
-    {
-        return ImageSize::Auto;
-    }
-
-    return imageSizeNameToEnum[size];
+    return GetImageSizeEnumMappings().FromString(size, ImageSize::Auto);
 }
 
-const std::string SpacingToString(Spacing spacing)
+const std::string& SpacingToString(Spacing spacing)
 {
-    std::unordered_map<Spacing, std::string, EnumHash> spacingEnumToName;
-    GetSpacingMappings(&spacingEnumToName, nullptr);
-
-    if (spacingEnumToName.find(spacing) == spacingEnumToName.end())
-    {
-        throw std::out_of_range("Invalid Spacing type");
-    }
-    return spacingEnumToName[spacing];
+    return GetSpacingMappings().ToString(spacing, "Invalid Spacing type");
 }
 
 Spacing SpacingFromString(const std::string& spacing)
 {
-    std::unordered_map<std::string, Spacing, CaseInsensitiveHash, CaseInsensitiveEqualTo> spacingNameToEnum;
-    GetSpacingMappings(nullptr, &spacingNameToEnum);
-
-    if (spacingNameToEnum.find(spacing) == spacingNameToEnum.end())
-    {
-        return Spacing::Default;
-    }
-
-    return spacingNameToEnum[spacing];
+    return GetSpacingMappings().FromString(spacing, Spacing::Default);
 }
 
-const std::string SeparatorThicknessToString(SeparatorThickness thickness)
+const std::string& SeparatorThicknessToString(SeparatorThickness thickness)
 {
-    std::unordered_map<SeparatorThickness, std::string, EnumHash> separatorThicknessEnumToName;
-    GetSeparatorThicknessEnumMappings(&separatorThicknessEnumToName, nullptr);
-
-    if (separatorThicknessEnumToName.find(thickness) == separatorThicknessEnumToName.end())
-    {
-        throw std::out_of_range("Invalid SeparatorThickness type");
-    }
-    return separatorThicknessEnumToName[thickness];
+    return GetSeparatorThicknessEnumMappings().ToString(thickness, "Invalid SeparatorThickness type");
 }
 
 SeparatorThickness SeparatorThicknessFromString(const std::string& thickness)
 {
-    std::unordered_map<std::string, SeparatorThickness, CaseInsensitiveHash, CaseInsensitiveEqualTo> separatorThicknessNameToEnum;
-    GetSeparatorThicknessEnumMappings(nullptr, &separatorThicknessNameToEnum);
-
-    if (separatorThicknessNameToEnum.find(thickness) == separatorThicknessNameToEnum.end())
-    {
-        return SeparatorThickness::Default;
-    }
-
-    return separatorThicknessNameToEnum[thickness];
+    return GetSeparatorThicknessEnumMappings().FromString(thickness, SeparatorThickness::Default);
 }
 
-const std::string ImageStyleToString(ImageStyle style)
+const std::string& ImageStyleToString(ImageStyle style)
 {
-    std::unordered_map<ImageStyle, std::string, EnumHash> imageStyleEnumToName;
-    GetImageStyleEnumMappings(&imageStyleEnumToName, nullptr);
-
-    if (imageStyleEnumToName.find(style) == imageStyleEnumToName.end())
-    {
-        throw std::out_of_range("Invalid ImageStyle style");
-    }
-    return imageStyleEnumToName[style];
+    return GetImageStyleEnumMappings().ToString(style, "Invalid ImageStyle style");
 }
 
 ImageStyle ImageStyleFromString(const std::string& style)
 {
-    std::unordered_map<std::string, ImageStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> imageStyleNameToEnum;
-    GetImageStyleEnumMappings(nullptr, &imageStyleNameToEnum);
-
-    if (imageStyleNameToEnum.find(style) == imageStyleNameToEnum.end())
-    {
-        return ImageStyle::Default;
-    }
-
-    return imageStyleNameToEnum[style];
+    return GetImageStyleEnumMappings().FromString(style, ImageStyle::Default);
 }
 
-const std::string ActionsOrientationToString(ActionsOrientation orientation)
+const std::string& ActionsOrientationToString(ActionsOrientation orientation)
 {
-    std::unordered_map<ActionsOrientation, std::string, EnumHash> actionsOrientationEnumToName;
-    GetActionsOrientationEnumMappings(&actionsOrientationEnumToName, nullptr);
-
-    if (actionsOrientationEnumToName.find(orientation) == actionsOrientationEnumToName.end())
-    {
-        throw std::out_of_range("Invalid ActionsOrientation type");
-    }
-    return actionsOrientationEnumToName[orientation];
+    return GetActionsOrientationEnumMappings().ToString(orientation, "Invalid ActionsOrientation type");
 }
 
 ActionsOrientation ActionsOrientationFromString(const std::string& orientation)
 {
-    std::unordered_map<std::string, ActionsOrientation, CaseInsensitiveHash, CaseInsensitiveEqualTo> actionsOrientationNameToEnum;
-    GetActionsOrientationEnumMappings(nullptr, &actionsOrientationNameToEnum);
-
-    if (actionsOrientationNameToEnum.find(orientation) == actionsOrientationNameToEnum.end())
-    {
-        return ActionsOrientation::Horizontal;
-    }
-    return actionsOrientationNameToEnum[orientation];
+    return GetActionsOrientationEnumMappings().FromString(orientation, ActionsOrientation::Horizontal);
 }
 
-const std::string ActionModeToString(ActionMode mode)
+const std::string& ActionModeToString(ActionMode mode)
 {
-    std::unordered_map<ActionMode, std::string, EnumHash> actionModeEnumToName;
-    GetActionModeEnumMappings(&actionModeEnumToName, nullptr);
-
-    if (actionModeEnumToName.find(mode) == actionModeEnumToName.end())
-    {
-        throw std::out_of_range("Invalid ActionMode type");
-    }
-    return actionModeEnumToName[mode];
+    return GetActionModeEnumMappings().ToString(mode, "Invalid ActionMode type");
 }
 
 ActionMode ActionModeFromString(const std::string& mode)
 {
-    std::unordered_map<std::string, ActionMode, CaseInsensitiveHash, CaseInsensitiveEqualTo> actionModeNameToEnum;
-    GetActionModeEnumMappings(nullptr, &actionModeNameToEnum);
-
-    if (actionModeNameToEnum.find(mode) == actionModeNameToEnum.end())
-    {
-        return ActionMode::Inline;
-    }
-    return actionModeNameToEnum[mode];
+    return GetActionModeEnumMappings().FromString(mode, ActionMode::Inline);
 }
 
-const std::string ChoiceSetStyleToString(ChoiceSetStyle style)
+const std::string& ChoiceSetStyleToString(ChoiceSetStyle style)
 {
-    std::unordered_map<ChoiceSetStyle, std::string, EnumHash> choiceSetStyleEnumToName;
-    GetChoiceSetStyleEnumMappings(&choiceSetStyleEnumToName, nullptr);
-
-    if (choiceSetStyleEnumToName.find(style) == choiceSetStyleEnumToName.end())
-    {
-        throw std::out_of_range("Invalid ChoiceSetStyle");
-    }
-    return choiceSetStyleEnumToName[style];
+    return GetChoiceSetStyleEnumMappings().ToString(style, "Invalid ChoiceSetStyle");
 }
-ChoiceSetStyle ChoiceSetStyleFromString(const std::string & style)
-{
-    std::unordered_map<std::string, ChoiceSetStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> choiceSetStyleNameToEnum;
-    GetChoiceSetStyleEnumMappings(nullptr, &choiceSetStyleNameToEnum);
 
-    if (choiceSetStyleNameToEnum.find(style) == choiceSetStyleNameToEnum.end())
-    {
-        return ChoiceSetStyle::Compact;
-    }
-    return choiceSetStyleNameToEnum[style];
+ChoiceSetStyle ChoiceSetStyleFromString(const std::string& style)
+{
+    return GetChoiceSetStyleEnumMappings().FromString(style, ChoiceSetStyle::Compact);
 }
 
-const std::string TextInputStyleToString(TextInputStyle style)
+const std::string& TextInputStyleToString(TextInputStyle style)
 {
-    std::unordered_map<TextInputStyle, std::string, EnumHash> textInputStyleEnumToName;
-    GetTextInputStyleEnumMappings(&textInputStyleEnumToName, nullptr);
-
-    if (textInputStyleEnumToName.find(style) == textInputStyleEnumToName.end())
-    {
-        throw std::out_of_range("Invalid TextInputStyle");
-    }
-    return textInputStyleEnumToName[style];
+    return GetTextInputStyleEnumMappings().ToString(style, "Invalid TextInputStyle");
 }
 
-TextInputStyle TextInputStyleFromString(const std::string & style)
+TextInputStyle TextInputStyleFromString(const std::string& style)
 {
-    std::unordered_map<std::string, TextInputStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> textInputStyleNameToEnum;
-    GetTextInputStyleEnumMappings(nullptr, &textInputStyleNameToEnum);
-
-    if (textInputStyleNameToEnum.find(style) == textInputStyleNameToEnum.end())
-    {
-        return TextInputStyle::Text;
-    }
-    return textInputStyleNameToEnum[style];
+    return GetTextInputStyleEnumMappings().FromString(style, TextInputStyle::Text);
 }
 
-const std::string ContainerStyleToString(ContainerStyle style)
+const std::string& ContainerStyleToString(ContainerStyle style)
 {
-    std::unordered_map<ContainerStyle, std::string, EnumHash> containerStyleEnumToName;
-    GetContainerStyleEnumMappings(&containerStyleEnumToName, nullptr);
-
-    if (containerStyleEnumToName.find(style) == containerStyleEnumToName.end())
-    {
-        throw std::out_of_range("Invalid ContainerStyle");
-    }
-    return containerStyleEnumToName[style];
+    return GetContainerStyleEnumMappings().ToString(style, "Invalid ContainerStyle");
 }
 
-ContainerStyle ContainerStyleFromString(const std::string & style)
+ContainerStyle ContainerStyleFromString(const std::string& style)
 {
-    std::unordered_map<std::string, ContainerStyle, CaseInsensitiveHash, CaseInsensitiveEqualTo> containerStyleNameToEnum;
-    GetContainerStyleEnumMappings(nullptr, &containerStyleNameToEnum);
-
-    if (containerStyleNameToEnum.find(style) == containerStyleNameToEnum.end())
-    {
-        return ContainerStyle::Default;
-    }
-    return containerStyleNameToEnum[style];
+    return GetContainerStyleEnumMappings().FromString(style, ContainerStyle::Default);
 }
 
-const std::string ActionAlignmentToString(ActionAlignment alignment)
+const std::string& ActionAlignmentToString(ActionAlignment alignment)
 {
-    std::unordered_map<ActionAlignment, std::string, EnumHash> actionAlignmentEnumToName;
-    GetActionAlignmentEnumMappings(&actionAlignmentEnumToName, nullptr);
-
-    if (actionAlignmentEnumToName.find(alignment) == actionAlignmentEnumToName.end())
-    {
-        throw std::out_of_range("Invalid ActionAlignment");
-    }
-    return actionAlignmentEnumToName[alignment];
+    return GetActionAlignmentEnumMappings().ToString(alignment, "Invalid ActionAlignment");
 }
 
-ActionAlignment ActionAlignmentFromString(const std::string & alignment)
+ActionAlignment ActionAlignmentFromString(const std::string& alignment)
 {
-    std::unordered_map<std::string, ActionAlignment, CaseInsensitiveHash, CaseInsensitiveEqualTo> actionAlignmentNameToEnum;
-    GetActionAlignmentEnumMappings(nullptr, &actionAlignmentNameToEnum);
-
-    if (actionAlignmentNameToEnum.find(alignment) == actionAlignmentNameToEnum.end())
-    {
-        return ActionAlignment::Left;
-    }
-    return actionAlignmentNameToEnum[alignment];
+    return GetActionAlignmentEnumMappings().FromString(alignment, ActionAlignment::Left);
 }
 
-const std::string IconPlacementToString(IconPlacement placement)
+const std::string& IconPlacementToString(IconPlacement placement)
 {
-    std::unordered_map<IconPlacement, std::string, EnumHash> iconPlacementEnumToName;
-    GetIconPlacementEnumMappings(&iconPlacementEnumToName, nullptr);
-
-    if (iconPlacementEnumToName.find(placement) == iconPlacementEnumToName.end())
-    {
-        throw std::out_of_range("Invalid IconPlacement");
-    }
-    return iconPlacementEnumToName[placement];
+    return GetIconPlacementEnumMappings().ToString(placement, "Invalid IconPlacement");
 }
 
 IconPlacement IconPlacementFromString(const std::string& placement)
 {
-    std::unordered_map<std::string, IconPlacement, CaseInsensitiveHash, CaseInsensitiveEqualTo> iconPlacementNameToEnum;
-    GetIconPlacementEnumMappings(nullptr, &iconPlacementNameToEnum);
-
-    if (iconPlacementNameToEnum.find(placement) == iconPlacementNameToEnum.end())
-    {
-        return IconPlacement::AboveTitle;
-    }
-    return iconPlacementNameToEnum[placement];
+    return GetIconPlacementEnumMappings().FromString(placement, IconPlacement::AboveTitle);
 }
 
 AdaptiveSharedNamespaceEnd
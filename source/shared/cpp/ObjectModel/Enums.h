@@ -21,13 +21,15 @@ struct EnumHash
 
 struct CaseInsensitiveEqualTo {
     bool operator() (const std::string& lhs, const std::string& rhs) const {
-        return strncasecmp(lhs.c_str(), rhs.c_str(), CHAR_MAX) == 0;
+        return lhs.size() == rhs.size() && strncasecmp(lhs.c_str(), rhs.c_str(), lhs.size()) == 0;
     }
 };
 
 struct CaseInsensitiveHash {
     size_t operator() (const std::string& keyval) const {
-        return std::accumulate(keyval.begin(), keyval.end(), size_t{ 0 }, [](size_t acc, char c) { return acc + static_cast<size_t>(std::tolower(c)); });
+        // FNV-1a over the lowercased characters. Summing the characters (as this used to) makes
+        // anagrams and most short schema keys collide, which degrades lookups to linear scans.
+        return std::accumulate(keyval.begin(), keyval.end(), size_t{ 2166136261u }, [](size_t acc, char c) { return (acc ^ static_cast<size_t>(std::tolower(static_cast<unsigned char>(c)))) * size_t{ 16777619u }; });
     }
 };
 
@@ -287,7 +289,8 @@ enum class ErrorStatusCode {
     RenderFailed,
     RequiredPropertyMissing,
     InvalidPropertyValue,
-    UnsupportedParserOverride
+    UnsupportedParserOverride,
+    ParseLimitExceeded
 };
 
 enum class WarningStatusCode {
@@ -299,6 +302,7 @@ enum class WarningStatusCode {
     MaxActionsExceeded,
     AssetLoadFailed,
     UnsupportedSchemaVersion,
+    DuplicateId,
 };
 
 enum class DateTimePreparsedTokenFormat {
@@ -315,69 +319,129 @@ enum class IconPlacement
     LeftOfTitle
 };
 
-const std::string AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey type);
+const std::string& AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey type);
 AdaptiveCardSchemaKey AdaptiveCardSchemaKeyFromString(const std::string& type);
 
-const std::string CardElementTypeToString(CardElementType elementType);
+const std::string& CardElementTypeToString(CardElementType elementType);
 CardElementType CardElementTypeFromString(const std::string& elementType);
 
-const std::string ActionTypeToString(ActionType actionType);
+const std::string& ActionTypeToString(ActionType actionType);
 ActionType ActionTypeFromString(const std::string& actionType);
 
-const std::string HorizontalAlignmentToString(HorizontalAlignment alignment);
+const std::string& HorizontalAlignmentToString(HorizontalAlignment alignment);
 HorizontalAlignment HorizontalAlignmentFromString(const std::string& alignment);
 
-const std::string ForegroundColorToString(ForegroundColor type);
+const std::string& ForegroundColorToString(ForegroundColor type);
 ForegroundColor ForegroundColorFromString(const std::string& type);
 
-const std::string TextWeightToString(TextWeight type);
+const std::string& TextWeightToString(TextWeight type);
 TextWeight TextWeightFromString(const std::string& type);
 
-const std::string TextSizeToString(TextSize size);
+const std::string& TextSizeToString(TextSize size);
 TextSize TextSizeFromString(const std::string& size);
 
-const std::string ImageSizeToString(ImageSize size);
+const std::string& ImageSizeToString(ImageSize size);
 ImageSize ImageSizeFromString(const std::string& size);
 
-const std::string SpacingToString(Spacing spacing);
+const std::string& SpacingToString(Spacing spacing);
 Spacing SpacingFromString(const std::string& spacing);
 
-const std::string SeparatorThicknessToString(SeparatorThickness separatorThickness);
+const std::string& SeparatorThicknessToString(SeparatorThickness separatorThickness);
 SeparatorThickness SeparatorThicknessFromString(const std::string& separatorThickness);
 
-const std::string ImageStyleToString(ImageStyle style);
+const std::string& ImageStyleToString(ImageStyle style);
 ImageStyle ImageStyleFromString(const std::string& style);
 
-const std::string ActionsOrientationToString(ActionsOrientation orientation);
+const std::string& ActionsOrientationToString(ActionsOrientation orientation);
 ActionsOrientation ActionsOrientationFromString(const std::string& orientation);
 
-const std::string ActionModeToString(ActionMode mode);
+const std::string& ActionModeToString(ActionMode mode);
 ActionMode ActionModeFromString(const std::string& mode);
 
-const std::string ChoiceSetStyleToString(ChoiceSetStyle style);
+const std::string& ChoiceSetStyleToString(ChoiceSetStyle style);
 ChoiceSetStyle ChoiceSetStyleFromString(const std::string& style);
 
-const std::string TextInputStyleToString(TextInputStyle style);
+const std::string& TextInputStyleToString(TextInputStyle style);
 TextInputStyle TextInputStyleFromString(const std::string& style);
 
-const std::string ContainerStyleToString(ContainerStyle style);
+const std::string& ContainerStyleToString(ContainerStyle style);
 ContainerStyle ContainerStyleFromString(const std::string& style);
 
-const std::string ActionAlignmentToString(ActionAlignment alignment);
+const std::string& ActionAlignmentToString(ActionAlignment alignment);
 ActionAlignment ActionAlignmentFromString(const std::string& alignment);
 
-const std::string IconPlacementToString(IconPlacement placement);
+const std::string& IconPlacementToString(IconPlacement placement);
 IconPlacement IconPlacementFromString(const std::string& placement);
 
+// Immutable lookup tables between an enum and its names. Each table is built once and shared;
+// enum-to-name lookups index directly into a vector and name-to-enum lookups are a single hash
+// probe, so neither direction copies the table or allocates.
 template <typename T>
-const std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqualTo>
-GenerateStringToEnumMap(const std::unordered_map<T, std::string, EnumHash>& keyToStringMap)
+class EnumMappings
 {
-    std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqualTo> result;
-    for (auto& kv : keyToStringMap)
+public:
+    EnumMappings(
+        std::initializer_list<std::pair<T, std::string>> enumToName,
+        std::initializer_list<std::pair<std::string, T>> additionalNameToEnum = {})
     {
-        result[kv.second] = kv.first;
+        for (const auto& kv : enumToName)
+        {
+            const size_t index = static_cast<size_t>(kv.first);
+            if (index >= m_enumToName.size())
+            {
+                m_enumToName.resize(index + 1);
+                m_hasName.resize(index + 1, false);
+            }
+
+            if (!m_hasName[index])
+            {
+                m_enumToName[index] = kv.second;
+                m_hasName[index] = true;
+            }
+
+            m_nameToEnum.emplace(kv.second, kv.first);
+        }
+
+        for (const auto& kv : additionalNameToEnum)
+        {
+            m_nameToEnum.emplace(kv.first, kv.second);
+        }
     }
-    return result;
-}
+
+    // Throws std::out_of_range with the given message if the value has no name
+    const std::string& ToString(T value, const char* errorMessage) const
+    {
+        const size_t index = static_cast<size_t>(value);
+        if (index >= m_enumToName.size() || !m_hasName[index])
+        {
+            throw std::out_of_range(errorMessage);
+        }
+
+        return m_enumToName[index];
+    }
+
+    bool TryFromString(const std::string& name, T& value) const
+    {
+        auto found = m_nameToEnum.find(name);
+        if (found == m_nameToEnum.end())
+        {
+            return false;
+        }
+
+        value = found->second;
+        return true;
+    }
+
+    T FromString(const std::string& name, T defaultValue) const
+    {
+        T value;
+        return TryFromString(name, value) ? value : defaultValue;
+    }
+
+private:
+    std::vector<std::string> m_enumToName;
+    std::vector<bool> m_hasName;
+    std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_nameToEnum;
+};
+
 AdaptiveSharedNamespaceEnd
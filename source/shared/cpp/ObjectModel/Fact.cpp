@@ -35,8 +35,9 @@ std::shared_ptr<Fact> Fact::DeserializeFromString(
 
 std::string Fact::Serialize()
 {
-    Json::FastWriter writer;
-    return writer.write(SerializeToJsonValue());
+    CardWriter writer;
+    SerializeToWriter(writer);
+    return writer.GetString();
 }
 
 Json::Value Fact::SerializeToJsonValue()
@@ -48,6 +49,14 @@ Json::Value Fact::SerializeToJsonValue()
     return root;
 }
 
+void Fact::SerializeToWriter(CardWriter& writer)
+{
+    writer.BeginObject();
+    writer.WriteProperty(AdaptiveCardSchemaKey::Title, GetTitle());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Value, GetValue());
+    writer.EndObject();
+}
+
 std::string Fact::GetTitle() const
 {
     return m_title;
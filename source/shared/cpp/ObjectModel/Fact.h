@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "Enums.h"
 #include "json/json.h"
+#include "CardWriter.h"
 #include "ElementParserRegistration.h"
 
 AdaptiveSharedNamespaceStart
@@ -14,6 +15,7 @@ public:
 
     std::string Serialize();
     Json::Value SerializeToJsonValue();
+    void SerializeToWriter(CardWriter& writer);
 
     std::string GetTitle() const;
     void SetTitle(const std::string value);
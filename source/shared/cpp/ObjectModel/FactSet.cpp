@@ -7,7 +7,6 @@ using namespace AdaptiveSharedNamespace;
 
 FactSet::FactSet() : BaseCardElement(CardElementType::FactSet)
 {
-    PopulateKnownPropertiesSet();
 }
 
 FactSet::FactSet(
@@ -17,7 +16,6 @@ FactSet::FactSet(
     BaseCardElement(CardElementType::FactSet, spacing, separation),
     m_facts(facts)
 {
-    PopulateKnownPropertiesSet();
 }
 
 FactSet::FactSet(
@@ -25,7 +23,6 @@ FactSet::FactSet(
     bool separation) :
     BaseCardElement(CardElementType::FactSet, spacing, separation)
 {
-    PopulateKnownPropertiesSet();
 }
 
 const std::vector<std::shared_ptr<Fact>>& FactSet::GetFacts() const
@@ -52,6 +49,26 @@ Json::Value FactSet::SerializeToJsonValue()
     return root;
 }
 
+void FactSet::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(FactSet)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseCardElement::SerializeProperties(writer);
+
+    writer.WriteKey(AdaptiveCardSchemaKey::Facts);
+    writer.BeginArray();
+    for (const auto& fact : GetFacts())
+    {
+        fact->SerializeToWriter(writer);
+    }
+    writer.EndArray();
+    writer.EndObject();
+}
+
 std::shared_ptr<BaseCardElement> FactSetParser::Deserialize(
     std::shared_ptr<ElementParserRegistration> elementParserRegistration,
     std::shared_ptr<ActionParserRegistration> actionParserRegistration,
@@ -76,7 +93,10 @@ std::shared_ptr<BaseCardElement> FactSetParser::DeserializeFromString(
     return FactSetParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void FactSet::PopulateKnownPropertiesSet() 
+const KnownPropertySet& FactSet::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts));
+    static const KnownPropertySet knownProperties(BaseCardElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Facts
+    });
+    return knownProperties;
 }
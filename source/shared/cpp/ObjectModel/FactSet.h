@@ -17,13 +17,15 @@ public:
     FactSet(Spacing spacing, bool separation, std::vector<std::shared_ptr<Fact>>& facts);
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     std::vector<std::shared_ptr<Fact>>& GetFacts();
     const std::vector<std::shared_ptr<Fact>>& GetFacts() const;
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     std::vector<std::shared_ptr<Fact>> m_facts; 
 };
 
@@ -2,6 +2,7 @@
 #include "Image.h"
 #include "ParseUtil.h"
 #include "Util.h"
+#include "CardTraversal.h"
 
 using namespace AdaptiveSharedNamespace;
 
@@ -13,7 +14,6 @@ Image::Image() :
     m_height(0),
     m_hAlignment(HorizontalAlignment::Left)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Image::Image(
@@ -35,7 +35,6 @@ Image::Image(
     m_altText(altText),
     m_hAlignment(hAlignment)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value Image::SerializeToJsonValue()
@@ -63,6 +62,37 @@ Json::Value Image::SerializeToJsonValue()
     return root;
 }
 
+void Image::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(Image)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseCardElement::SerializeProperties(writer);
+
+    ImageSize imageSize = GetImageSize();
+    if (imageSize != ImageSize::None)
+    {
+        writer.WriteProperty(AdaptiveCardSchemaKey::Size, ImageSizeToString(imageSize));
+    }
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::Style, ImageStyleToString(GetImageStyle()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::Url, GetUrl());
+    writer.WriteProperty(AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentToString(GetHorizontalAlignment()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::AltText, GetAltText());
+
+    // An Action.ShowCard writes its card as scheduled tasks, so the object is closed after them
+    std::shared_ptr<BaseActionElement> selectAction = GetSelectAction();
+    if (selectAction != nullptr)
+    {
+        writer.WriteKey(AdaptiveCardSchemaKey::SelectAction);
+        selectAction->SerializeToWriter(writer);
+    }
+    CardTraversal::Schedule([&writer]() { writer.EndObject(); });
+}
+
 std::string Image::GetUrl() const
 {
     return m_url;
@@ -191,21 +221,26 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(
     return image;
 }
 
-void Image::PopulateKnownPropertiesSet() 
+const KnownPropertySet& Image::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction));
+    static const KnownPropertySet knownProperties(BaseCardElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Url,
+        AdaptiveCardSchemaKey::Style,
+        AdaptiveCardSchemaKey::Size,
+        AdaptiveCardSchemaKey::AltText,
+        AdaptiveCardSchemaKey::HorizontalAlignment,
+        AdaptiveCardSchemaKey::Width,
+        AdaptiveCardSchemaKey::Height,
+        AdaptiveCardSchemaKey::SelectAction
+    });
+    return knownProperties;
 }
 
 void Image::GetResourceUris(std::vector<std::string>& resourceUris)
 {
-    auto url = GetUrl();
-    resourceUris.push_back(url);
-    return;
+    resourceUris.push_back(GetUrl());
+    if (m_selectAction != nullptr)
+    {
+        CardTraversal::Schedule([&resourceUris, item = m_selectAction.get()]() { item->GetResourceUris(resourceUris); });
+    }
 }
\ No newline at end of file
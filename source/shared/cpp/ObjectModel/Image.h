@@ -23,6 +23,7 @@ public:
         HorizontalAlignment hAlignment);
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     std::string GetUrl() const;
     void SetUrl(const std::string value);
@@ -50,9 +51,10 @@ public:
 
     virtual void GetResourceUris(std::vector<std::string>& resourceUris) override;
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     std::string m_url;
     ImageStyle m_imageStyle;
     ImageSize m_imageSize;
@@ -2,6 +2,7 @@
 #include "ImageSet.h"
 #include "ParseUtil.h"
 #include "Image.h"
+#include "CardTraversal.h"
 
 using namespace AdaptiveSharedNamespace;
 
@@ -9,7 +10,6 @@ ImageSet::ImageSet() :
     BaseCardElement(CardElementType::ImageSet),
     m_imageSize(ImageSize::None)
 {
-    PopulateKnownPropertiesSet();
 }
 
 ImageSet::ImageSet(
@@ -20,7 +20,6 @@ ImageSet::ImageSet(
     m_images(images),
     m_imageSize(ImageSize::None)
 {
-    PopulateKnownPropertiesSet();
 }
 
 ImageSet::ImageSet(
@@ -29,7 +28,6 @@ ImageSet::ImageSet(
     BaseCardElement(CardElementType::ImageSet, spacing, separation),
     m_imageSize(ImageSize::None)
 {
-    PopulateKnownPropertiesSet();
 }
 
 ImageSize ImageSet::GetImageSize() const
@@ -72,6 +70,36 @@ Json::Value ImageSet::SerializeToJsonValue()
     return root;
 }
 
+void ImageSet::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(ImageSet)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseCardElement::SerializeProperties(writer);
+
+    ImageSize imageSize = GetImageSize();
+    if (imageSize != ImageSize::None)
+    {
+        writer.WriteProperty(AdaptiveCardSchemaKey::ImageSize, ImageSizeToString(imageSize));
+    }
+
+    writer.WriteKey(AdaptiveCardSchemaKey::Images);
+    writer.BeginArray();
+    for (const auto& image : GetImages())
+    {
+        CardTraversal::Schedule([&writer, image = image.get()]() { image->SerializeToWriter(writer); });
+    }
+
+    CardTraversal::Schedule([&writer]()
+    {
+        writer.EndArray();
+        writer.EndObject();
+    });
+}
+
 std::shared_ptr<BaseCardElement> ImageSetParser::Deserialize(
     std::shared_ptr<ElementParserRegistration> elementParserRegistration,
     std::shared_ptr<ActionParserRegistration> actionParserRegistration,
@@ -103,18 +131,19 @@ std::shared_ptr<BaseCardElement> ImageSetParser::DeserializeFromString(
     return ImageSetParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void ImageSet::PopulateKnownPropertiesSet() 
+const KnownPropertySet& ImageSet::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ImageSize));
+    static const KnownPropertySet knownProperties(BaseCardElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Images,
+        AdaptiveCardSchemaKey::ImageSize
+    });
+    return knownProperties;
 }
 
 void ImageSet::GetResourceUris(std::vector<std::string>& resourceUris)
 {
-    auto images = GetImages();
-    for (auto image : images)
+    for (const auto& image : m_images)
     {
         image->GetResourceUris(resourceUris);
     }
-    return;
 }
\ No newline at end of file
@@ -16,6 +16,7 @@ public:
     ImageSet(Spacing spacing, bool separation, std::vector<std::shared_ptr<Image>>& images);
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     ImageSize GetImageSize() const;
     void SetImageSize(const ImageSize value);
@@ -25,9 +26,10 @@ public:
 
     virtual void GetResourceUris(std::vector<std::string>& resourceUris) override;
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     std::vector<std::shared_ptr<Image>> m_images;
     ImageSize m_imageSize;
 };
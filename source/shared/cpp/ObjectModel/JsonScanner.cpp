@@ -0,0 +1,329 @@
+#include "pch.h"
+#include "JsonScanner.h"
+#include "AdaptiveCardParseException.h"
+#include <cstring>
+
+using namespace AdaptiveSharedNamespace;
+
+JsonScanner::JsonScanner(const char* begin, const char* end) :
+    m_current(begin),
+    m_end(end)
+{
+}
+
+void JsonScanner::BeginObject()
+{
+    SkipWhitespace();
+    Expect('{');
+    m_isFirstInScope.push_back(true);
+}
+
+bool JsonScanner::NextMember(const char*& keyBegin, const char*& keyEnd)
+{
+    SkipWhitespace();
+    if (Peek() == '}')
+    {
+        ++m_current;
+        m_isFirstInScope.pop_back();
+        return false;
+    }
+
+    if (!m_isFirstInScope.back())
+    {
+        Expect(',');
+        SkipWhitespace();
+    }
+    m_isFirstInScope.back() = false;
+
+    keyBegin = m_current;
+    SkipString();
+    keyEnd = m_current;
+
+    SkipWhitespace();
+    Expect(':');
+    return true;
+}
+
+void JsonScanner::BeginArray()
+{
+    SkipWhitespace();
+    Expect('[');
+    m_isFirstInScope.push_back(true);
+}
+
+bool JsonScanner::NextElement()
+{
+    SkipWhitespace();
+    if (Peek() == ']')
+    {
+        ++m_current;
+        m_isFirstInScope.pop_back();
+        return false;
+    }
+
+    if (!m_isFirstInScope.back())
+    {
+        Expect(',');
+    }
+    m_isFirstInScope.back() = false;
+    return true;
+}
+
+bool JsonScanner::IsAtObject()
+{
+    SkipWhitespace();
+    return Peek() == '{';
+}
+
+bool JsonScanner::IsAtArray()
+{
+    SkipWhitespace();
+    return Peek() == '[';
+}
+
+void JsonScanner::SkipValue(const char*& valueBegin, const char*& valueEnd)
+{
+    SkipWhitespace();
+    valueBegin = m_current;
+
+    // Closing characters of the containers we are inside of. Kept on the heap rather than
+    // recursing so that deeply nested payloads cannot exhaust the stack.
+    std::vector<char> closers;
+    for (;;)
+    {
+        bool valueComplete = true;
+        switch (Peek())
+        {
+        case '{':
+            ++m_current;
+            SkipWhitespace();
+            if (Peek() == '}')
+            {
+                ++m_current;
+            }
+            else
+            {
+                closers.push_back('}');
+                SkipString();
+                SkipWhitespace();
+                Expect(':');
+                SkipWhitespace();
+                valueComplete = false;
+            }
+            break;
+        case '[':
+            ++m_current;
+            SkipWhitespace();
+            if (Peek() == ']')
+            {
+                ++m_current;
+            }
+            else
+            {
+                closers.push_back(']');
+                valueComplete = false;
+            }
+            break;
+        case '"':
+            SkipString();
+            break;
+        case 't':
+            SkipLiteral("true");
+            break;
+        case 'f':
+            SkipLiteral("false");
+            break;
+        case 'n':
+            SkipLiteral("null");
+            break;
+        default:
+            SkipNumber();
+            break;
+        }
+
+        if (!valueComplete)
+        {
+            continue;
+        }
+
+        // A value has ended; close any containers that end with it and position on the next value
+        for (;;)
+        {
+            if (closers.empty())
+            {
+                valueEnd = m_current;
+                return;
+            }
+
+            SkipWhitespace();
+            const char next = Peek();
+            if (next == closers.back())
+            {
+                ++m_current;
+                closers.pop_back();
+            }
+            else if (next == ',')
+            {
+                ++m_current;
+                SkipWhitespace();
+                if (closers.back() == '}')
+                {
+                    SkipString();
+                    SkipWhitespace();
+                    Expect(':');
+                    SkipWhitespace();
+                }
+                break;
+            }
+            else
+            {
+                ThrowInvalid();
+            }
+        }
+    }
+}
+
+const char* JsonScanner::GetPosition() const
+{
+    return m_current;
+}
+
+std::string JsonScanner::DecodeKey(const char* keyBegin, const char* keyEnd)
+{
+    if (std::find(keyBegin, keyEnd, '\\') == keyEnd)
+    {
+        // Strip the quotes
+        return std::string(keyBegin + 1, keyEnd - 1);
+    }
+
+    return ParseValue(keyBegin, keyEnd).asString();
+}
+
+Json::Value JsonScanner::ParseValue(const char* begin, const char* end)
+{
+    Json::Reader reader;
+    Json::Value value;
+    if (!reader.parse(begin, end, value, false))
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Expected JSON Object\n");
+    }
+    return value;
+}
+
+void JsonScanner::SkipWhitespace()
+{
+    while (m_current != m_end)
+    {
+        const char c = *m_current;
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+        {
+            ++m_current;
+        }
+        else if (c == '/' && (m_end - m_current) > 1 && m_current[1] == '/')
+        {
+            // Comments are accepted to match Json::Reader's default features
+            while (m_current != m_end && *m_current != '\n')
+            {
+                ++m_current;
+            }
+        }
+        else if (c == '/' && (m_end - m_current) > 1 && m_current[1] == '*')
+        {
+            m_current += 2;
+            while ((m_end - m_current) > 1 && !(m_current[0] == '*' && m_current[1] == '/'))
+            {
+                ++m_current;
+            }
+            if ((m_end - m_current) < 2)
+            {
+                ThrowInvalid();
+            }
+            m_current += 2;
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+void JsonScanner::SkipString()
+{
+    Expect('"');
+    const char* contentBegin = m_current;
+
+    // Jump from quote to quote; a quote ends the string unless an odd run of backslashes escapes it
+    while (m_current != m_end)
+    {
+        const char* quote = static_cast<const char*>(std::memchr(m_current, '"', m_end - m_current));
+        if (quote == nullptr)
+        {
+            break;
+        }
+
+        const char* escape = quote;
+        while (escape != contentBegin && escape[-1] == '\\')
+        {
+            --escape;
+        }
+
+        m_current = quote + 1;
+        if ((quote - escape) % 2 == 0)
+        {
+            return;
+        }
+    }
+    ThrowInvalid();
+}
+
+void JsonScanner::SkipLiteral(const char* literal)
+{
+    for (; *literal != '\0'; ++literal)
+    {
+        Expect(*literal);
+    }
+}
+
+void JsonScanner::SkipNumber()
+{
+    const char* start = m_current;
+    if (Peek() == '-')
+    {
+        ++m_current;
+    }
+
+    // Same character set Json::Reader accepts; it validates the digits when the value is parsed
+    while (m_current != m_end && ((*m_current >= '0' && *m_current <= '9') ||
+        *m_current == '.' || *m_current == 'e' || *m_current == 'E' || *m_current == '+' || *m_current == '-'))
+    {
+        ++m_current;
+    }
+
+    if (m_current == start || (m_current - start == 1 && *start == '-'))
+    {
+        ThrowInvalid();
+    }
+}
+
+char JsonScanner::Peek()
+{
+    if (m_current == m_end)
+    {
+        ThrowInvalid();
+    }
+    return *m_current;
+}
+
+void JsonScanner::Expect(char c)
+{
+    if (Peek() != c)
+    {
+        ThrowInvalid();
+    }
+    ++m_current;
+}
+
+void JsonScanner::ThrowInvalid() const
+{
+    throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Expected JSON Object\n");
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "pch.h"
+#include "json/json.h"
+
+AdaptiveSharedNamespaceStart
+
+// Forward-only scanner over raw JSON text. It validates structure and hands out the byte range
+// of each value without building a Json::Value, so callers can choose which parts of a payload
+// to materialize. Malformed input throws AdaptiveCardParseException with ErrorStatusCode::InvalidJson.
+class JsonScanner
+{
+public:
+    JsonScanner(const char* begin, const char* end);
+
+    // Object iteration. Call BeginObject, then NextMember until it returns false; after each
+    // member the caller must consume the value (SkipValue, or BeginArray/BeginObject).
+    void BeginObject();
+    bool NextMember(const char*& keyBegin, const char*& keyEnd);
+
+    // Array iteration, same pattern as objects
+    void BeginArray();
+    bool NextElement();
+
+    bool IsAtObject();
+    bool IsAtArray();
+
+    // Skips the next value and returns its range, excluding surrounding whitespace
+    void SkipValue(const char*& valueBegin, const char*& valueEnd);
+
+    const char* GetPosition() const;
+
+    // Decodes a quoted key range returned by NextMember
+    static std::string DecodeKey(const char* keyBegin, const char* keyEnd);
+
+    // Parses the given range into a Json::Value
+    static Json::Value ParseValue(const char* begin, const char* end);
+
+private:
+    void SkipWhitespace();
+    void SkipString();
+    void SkipLiteral(const char* literal);
+    void SkipNumber();
+    char Peek();
+    void Expect(char c);
+    [[noreturn]] void ThrowInvalid() const;
+
+    const char* m_current;
+    const char* m_end;
+    std::vector<bool> m_isFirstInScope;
+};
+
+AdaptiveSharedNamespaceEnd
@@ -0,0 +1,55 @@
+#include "pch.h"
+#include "KnownPropertySet.h"
+
+using namespace AdaptiveSharedNamespace;
+
+KnownPropertySet::KnownPropertySet(std::initializer_list<AdaptiveCardSchemaKey> keys)
+{
+    for (const auto key : keys)
+    {
+        Add(AdaptiveCardSchemaKeyToString(key));
+    }
+}
+
+KnownPropertySet::KnownPropertySet(const KnownPropertySet& baseProperties, std::initializer_list<AdaptiveCardSchemaKey> keys) :
+    m_names(baseProperties.m_names)
+{
+    for (const auto key : keys)
+    {
+        Add(AdaptiveCardSchemaKeyToString(key));
+    }
+}
+
+KnownPropertySet::KnownPropertySet(const KnownPropertySet& baseProperties, std::initializer_list<std::string> names) :
+    m_names(baseProperties.m_names)
+{
+    for (const auto& name : names)
+    {
+        Add(name);
+    }
+}
+
+bool KnownPropertySet::Contains(const std::string& name) const
+{
+    return Contains(name.data(), name.data() + name.size());
+}
+
+bool KnownPropertySet::Contains(const char* nameBegin, const char* nameEnd) const
+{
+    const size_t length = nameEnd - nameBegin;
+    auto it = std::lower_bound(m_names.begin(), m_names.end(), nameBegin,
+        [length](const std::string& lhs, const char* rhs)
+        {
+            return lhs.compare(0, std::string::npos, rhs, length) < 0;
+        });
+    return it != m_names.end() && it->compare(0, std::string::npos, nameBegin, length) == 0;
+}
+
+void KnownPropertySet::Add(const std::string& name)
+{
+    auto it = std::lower_bound(m_names.begin(), m_names.end(), name);
+    if (it == m_names.end() || *it != name)
+    {
+        m_names.insert(it, name);
+    }
+}
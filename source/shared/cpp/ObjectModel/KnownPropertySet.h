@@ -0,0 +1,28 @@
+#pragma once
+
+#include "pch.h"
+#include "Enums.h"
+
+AdaptiveSharedNamespaceStart
+
+// Immutable set of the JSON property names an element or action type consumes while deserializing.
+// Each type keeps a single static instance that extends the set of its base type, so element
+// instances carry no copy of it. Custom elements can extend it with their own property names.
+class KnownPropertySet
+{
+public:
+    KnownPropertySet(std::initializer_list<AdaptiveCardSchemaKey> keys);
+    KnownPropertySet(const KnownPropertySet& baseProperties, std::initializer_list<AdaptiveCardSchemaKey> keys);
+    KnownPropertySet(const KnownPropertySet& baseProperties, std::initializer_list<std::string> names);
+
+    bool Contains(const std::string& name) const;
+    bool Contains(const char* nameBegin, const char* nameEnd) const;
+
+private:
+    void Add(const std::string& name);
+
+    // Kept sorted so lookups need neither hashing nor a temporary string
+    std::vector<std::string> m_names;
+};
+
+AdaptiveSharedNamespaceEnd
@@ -1,20 +1,19 @@
 #include "pch.h"
-#include <iostream>
 #include "MarkDownBlockParser.h"
 
 using namespace AdaptiveSharedNamespace;
 
 // Parses according to each key words
-void MarkDownBlockParser::ParseBlock(std::stringstream &stream)
+void MarkDownBlockParser::ParseBlock(MarkDownCursor& cursor)
 {
-    switch (stream.peek())
+    switch (cursor.Peek())
     {
         // parses link
     case '[':
     {
-        LinkParser linkParser;
+        LinkParser linkParser(m_generator);
         // do syntax check of link
-        linkParser.Match(stream);
+        linkParser.Match(cursor);
         // append link result to the rest
         m_parsedResult.AppendParseResult(linkParser.GetParsedResult());
         break;
@@ -24,21 +23,25 @@ void MarkDownBlockParser::ParseBlock(std::stringstream &stream)
     case ']': case ')':
     {
         // add these char as token to code gen list
-        m_parsedResult.AddNewTokenToParsedResult((char)stream.get());
+        const size_t offset = cursor.GetPosition();
+        cursor.Get();
+        m_parsedResult.AddNewTokenToParsedResult(offset, 1);
         break;
     }
     case '\n': case '\r':
     {
         // add new line char as token to code gen list
-        m_parsedResult.AddNewLineTokenToParsedResult((char)stream.get());
+        const size_t offset = cursor.GetPosition();
+        cursor.Get();
+        m_parsedResult.AddNewLineTokenToParsedResult(offset);
         break;
     }
     // handles list block
     case '-':
     {
-        ListParser listParser;
+        ListParser listParser(m_generator);
         // do syntax check of list
-        listParser.Match(stream);
+        listParser.Match(cursor);
         // append list result to the rest
         m_parsedResult.AppendParseResult(listParser.GetParsedResult());
         break;
@@ -46,18 +49,18 @@ void MarkDownBlockParser::ParseBlock(std::stringstream &stream)
     case '0': case '1': case '2': case '3': case'4':
     case '5': case '6': case '7': case '8': case'9':
     {
-        OrderedListParser orderedListParser;
+        OrderedListParser orderedListParser(m_generator);
         // do syntax check of list
-        orderedListParser.Match(stream);
+        orderedListParser.Match(cursor);
         // append list result to the rest
         m_parsedResult.AppendParseResult(orderedListParser.GetParsedResult());
         break;
     }
     // everything else is treated as normal text + emphasis
     default:
-        EmphasisParser emphasisParser;
+        EmphasisParser emphasisParser(m_generator);
         // do syntax check of normal text + emphasis
-        emphasisParser.Match(stream);
+        emphasisParser.Match(cursor);
         // append result to the rest
         m_parsedResult.AppendParseResult(emphasisParser.GetParsedResult());
     }
@@ -68,125 +71,128 @@ void MarkDownBlockParser::ParseBlock(std::stringstream &stream)
 // capture until it can't capture anymore.
 // it moves two states, emphasis state and text state,
 // at each transition of state, one token is captured
-void EmphasisParser::Match(std::stringstream &stream)
+void EmphasisParser::Match(MarkDownCursor& cursor)
 {
     while (m_current_state != EmphasisState::Captured)
     {
-        m_current_state = m_stateMachine[m_current_state](*this, stream, m_current_token);
+        m_current_state = (m_current_state == EmphasisState::Text) ? MatchText(cursor) : MatchEmphasis(cursor);
     }
 }
 
 /// captures text until it see emphasis character. When it does, switch to Emphasis state
-EmphasisParser::EmphasisState EmphasisParser::MatchText(EmphasisParser &parser, std::stringstream &stream, std::string& token)
+EmphasisParser::EmphasisState EmphasisParser::MatchText(MarkDownCursor& cursor)
 {
+    const int ch = cursor.Peek();
+
     /// MarkDown keywords
-    if (stream.peek() == '[' || stream.peek() == ']' || stream.peek() == ')' || stream.peek() == '\n' || stream.peek() == '\r' || stream.eof())
+    if (ch == '[' || ch == ']' || ch == ')' || ch == '\n' || ch == '\r' || cursor.IsAtEnd())
     {
-        parser.Flush(stream.peek(), token);
+        Flush(ch);
         return EmphasisState::Captured;
     }
 
-    if (parser.IsMarkDownDelimiter(stream.peek()))
+    if (IsMarkDownDelimiter(ch))
     {
         // encounterred first emphasis delimiter
-        parser.CaptureCurrentCollectedStringAsRegularToken();
-        DelimiterType emphasisType = EmphasisParser::GetDelimiterTypeForCharAtCurrentPosition(stream.peek());
-        // get previous character and update the look behind if it was captured before 
-        if (stream.tellg())
+        CaptureCurrentCollectedStringAsRegularToken();
+        DelimiterType emphasisType = GetDelimiterTypeForCharAtCurrentPosition(ch);
+        // get previous character and update the look behind if it was captured before
+        if (cursor.GetPosition())
         {
-            stream.unget();
-            parser.UpdateLookBehind(stream.get());
+            cursor.Unget();
+            UpdateLookBehind(cursor.Get());
         }
 
-        parser.UpdateCurrentEmphasisRunState(emphasisType);
-        token += (char)stream.get();
+        UpdateCurrentEmphasisRunState(emphasisType);
+        AppendToCurrentToken(cursor, cursor.Get());
         return EmphasisState::Emphasis;
     }
     else
     {
-        parser.UpdateLookBehind(stream.peek());
-        token += (char)stream.get();
+        UpdateLookBehind(ch);
+        AppendToCurrentToken(cursor, cursor.Get());
         return EmphasisState::Text;
     }
 }
 
 /// captures text untill it see none-emphasis character. When it does, switch to text state
-EmphasisParser::EmphasisState EmphasisParser::MatchEmphasis(EmphasisParser &parser, std::stringstream &stream, std::string& token)
+EmphasisParser::EmphasisState EmphasisParser::MatchEmphasis(MarkDownCursor& cursor)
 {
+    const int ch = cursor.Peek();
+
     // key word is encountered, flush what is being processed, and have those keyword
     // handled by ParseBlock()
-    if (stream.peek() == '[' || stream.peek() == ']' || stream.peek() == ')' || stream.peek() == '\n' || stream.peek() == '\r' || stream.eof())
+    if (ch == '[' || ch == ']' || ch == ')' || ch == '\n' || ch == '\r' || cursor.IsAtEnd())
     {
-        parser.Flush(stream.peek(), token);
+        Flush(ch);
         return EmphasisState::Captured;
     }
 
     /// if another emphasis delimiter is encounterred, it is delimiter run
-    if (parser.IsMarkDownDelimiter(stream.peek()))
+    if (IsMarkDownDelimiter(ch))
     {
-        DelimiterType emphasisType = EmphasisParser::GetDelimiterTypeForCharAtCurrentPosition((stream.peek()));
-        if (parser.IsEmphasisDelimiterRun(emphasisType))
+        DelimiterType emphasisType = GetDelimiterTypeForCharAtCurrentPosition(ch);
+        if (IsEmphasisDelimiterRun(emphasisType))
         {
-            parser.UpdateCurrentEmphasisRunState(emphasisType);
+            UpdateCurrentEmphasisRunState(emphasisType);
         }
 
-        token += (char)stream.get();
+        AppendToCurrentToken(cursor, cursor.Get());
     }
     /// delimiter run is ended, capture the current accumulated token as emphasis
     else
     {
-        parser.CaptureEmphasisToken(stream.peek(), token);
+        CaptureEmphasisToken(ch);
 
-        if (stream.peek() == '\\')
+        if (cursor.Peek() == '\\')
         {
             // skips escape char
-            stream.get();
+            cursor.Get();
         }
 
-        parser.ResetCurrentEmphasisState();
-        parser.UpdateLookBehind(stream.peek());
-        token += (char)stream.get();
+        ResetCurrentEmphasisState();
+        UpdateLookBehind(cursor.Peek());
+        AppendToCurrentToken(cursor, cursor.Get());
         return EmphasisState::Text;
     }
     return EmphasisState::Emphasis;
 }
 
-// Captures remaining charaters in given token
+// Captures remaining charaters in current token
 // and causes the emphasis parsing to terminate
-void EmphasisParser::Flush(int ch, std::string& currentToken)
+void EmphasisParser::Flush(int ch)
 {
     if (m_current_state == EmphasisState::Emphasis)
     {
-        CaptureEmphasisToken(ch, currentToken);
+        CaptureEmphasisToken(ch);
         m_delimiterCnts = 0;
     }
     else
     {
-        CaptureCurrentCollectedStringAsRegularToken(currentToken);
+        CaptureCurrentCollectedStringAsRegularToken();
     }
-    currentToken.clear();
+    ClearCurrentToken();
 }
 
-bool EmphasisParser::IsMarkDownDelimiter(int ch)
+bool EmphasisParser::IsMarkDownDelimiter(int ch) const
 {
     return ((ch == '*' || ch == '_') && (m_lookBehind != Escape));
 }
 
-void EmphasisParser::CaptureCurrentCollectedStringAsRegularToken(std::string& currentToken)
+void EmphasisParser::CaptureCurrentCollectedStringAsRegularToken()
 {
-    if (currentToken.empty())
+    if (IsCurrentTokenEmpty())
+    {
         return;
-    std::shared_ptr<MarkDownHtmlGenerator> codeGen =
-        std::make_shared<MarkDownStringHtmlGenerator>(currentToken);
-
-    m_parsedResult.AppendToTokens(codeGen);
+    }
 
-    currentToken.clear();
-}
+    // a token read past the end holds EOF as a char
+    const int token = m_isTokenEof ?
+        m_generator.AddCharToken(static_cast<char>(EOF)) :
+        m_generator.AddToken(MarkDownTokenKind::Text, m_tokenOffset, m_tokenLength);
+    m_parsedResult.AppendToTokens(token);
 
-void EmphasisParser::CaptureCurrentCollectedStringAsRegularToken()
-{
-    CaptureCurrentCollectedStringAsRegularToken(m_current_token);
+    ClearCurrentToken();
 }
 
 void EmphasisParser::UpdateCurrentEmphasisRunState(DelimiterType emphasisType)
@@ -200,7 +206,7 @@ void EmphasisParser::UpdateCurrentEmphasisRunState(DelimiterType emphasisType)
     m_currentDelimiterType = emphasisType;
 }
 
-bool EmphasisParser::IsRightEmphasisDelimiter(int ch)
+bool EmphasisParser::IsRightEmphasisDelimiter(int ch) const
 {
     if ((std::isspace(ch) || (ch == EOF)) &&
         (m_lookBehind != WhiteSpace) &&
@@ -229,54 +235,42 @@ bool EmphasisParser::IsRightEmphasisDelimiter(int ch)
         return true;
     }
 
-    return false;;
+    return false;
 }
 
-bool EmphasisParser::TryCapturingRightEmphasisToken(int ch, std::string &currentToken)
+bool EmphasisParser::TryCapturingRightEmphasisToken(int ch)
 {
     if (IsRightEmphasisDelimiter(ch))
     {
-        std::shared_ptr<MarkDownEmphasisHtmlGenerator> codeGen = nullptr;
-        // right emphasis can be also left emphasis
-        if (IsLeftEmphasisDelimiter(ch))
-        {
-            // since it is both left and right emphasis, create one accordingly
-            codeGen =
-                std::make_shared<MarkDownLeftAndRightEmphasisHtmlGenerator>(currentToken, m_delimiterCnts,
-                    m_currentDelimiterType);
-        }
-        else
-        {
-            codeGen =
-                std::make_shared<MarkDownRightEmphasisHtmlGenerator>(currentToken, m_delimiterCnts,
-                    m_currentDelimiterType);
-        }
+        // right emphasis can be also left emphasis, in which case it is created as both
+        const MarkDownTokenKind kind = IsLeftEmphasisDelimiter(ch) ?
+            MarkDownTokenKind::LeftAndRightEmphasis : MarkDownTokenKind::RightEmphasis;
+        const int token = m_generator.AddEmphasisToken(kind, m_tokenOffset, m_tokenLength, m_delimiterCnts, m_currentDelimiterType);
 
-        m_parsedResult.AppendToLookUpTable(codeGen);
+        m_parsedResult.AppendToLookUpTable(token);
 
-        m_parsedResult.AppendToTokens(codeGen);
+        m_parsedResult.AppendToTokens(token);
 
-        currentToken.clear();
+        ClearCurrentToken();
 
         return true;
     }
     return false;
 }
 
-bool EmphasisParser::TryCapturingLeftEmphasisToken(int ch, std::string &currentToken)
+bool EmphasisParser::TryCapturingLeftEmphasisToken(int ch)
 {
     // left emphasis detected, save emphasis for later reference
     if (IsLeftEmphasisDelimiter(ch))
     {
-        std::shared_ptr<MarkDownEmphasisHtmlGenerator> codeGen =
-            std::make_shared<MarkDownLeftEmphasisHtmlGenerator>(currentToken, m_delimiterCnts,
-                m_currentDelimiterType);
+        const int token = m_generator.AddEmphasisToken(MarkDownTokenKind::LeftEmphasis, m_tokenOffset, m_tokenLength,
+            m_delimiterCnts, m_currentDelimiterType);
 
-        m_parsedResult.AppendToLookUpTable(codeGen);
+        m_parsedResult.AppendToLookUpTable(token);
 
-        m_parsedResult.AppendToTokens(codeGen);
+        m_parsedResult.AppendToTokens(token);
 
-        currentToken.clear();
+        ClearCurrentToken();
         return true;
     }
     return false;
@@ -301,26 +295,49 @@ void EmphasisParser::UpdateLookBehind(int ch)
     }
 }
 
-void EmphasisParser::CaptureEmphasisToken(int ch, std::string &currentToken)
+void EmphasisParser::CaptureEmphasisToken(int ch)
 {
-    if (!TryCapturingRightEmphasisToken(ch, currentToken) &&
-        !TryCapturingLeftEmphasisToken(ch, currentToken) &&
-        !currentToken.empty())
+    if (!TryCapturingRightEmphasisToken(ch) &&
+        !TryCapturingLeftEmphasisToken(ch) &&
+        !IsCurrentTokenEmpty())
     {
         // no valid emphasis delimiter runs found during current emphasis delimiter run
         // treat them as regular string tokens
-        CaptureCurrentCollectedStringAsRegularToken(currentToken);
+        CaptureCurrentCollectedStringAsRegularToken();
+    }
+}
+
+// Chars are only ever added to the current token in the order they are read, so the token is the
+// run of chars from the first one
+void EmphasisParser::AppendToCurrentToken(const MarkDownCursor& cursor, int ch)
+{
+    if (ch == EOF)
+    {
+        m_isTokenEof = true;
+        return;
     }
+
+    if (m_tokenLength == 0)
+    {
+        m_tokenOffset = cursor.GetPosition() - 1;
+    }
+    ++m_tokenLength;
 }
 
-void LinkParser::Match(std::stringstream &stream)
+void EmphasisParser::ClearCurrentToken()
+{
+    m_tokenLength = 0;
+    m_isTokenEof = false;
+}
+
+void LinkParser::Match(MarkDownCursor& cursor)
 {
     // link syntax check, match keyword at each stage
-    if (MatchAtLinkInit(stream) &&
-        MatchAtLinkTextRun(stream) &&
-        MatchAtLinkTextEnd(stream) &&
-        MatchAtLinkDestinationStart(stream) &&
-        MatchAtLinkDestinationRun(stream))
+    if (MatchAtLinkInit(cursor) &&
+        MatchAtLinkTextRun(cursor) &&
+        MatchAtLinkTextEnd(cursor) &&
+        MatchAtLinkDestinationStart(cursor) &&
+        MatchAtLinkDestinationRun(cursor))
     {
         /// Link is in correct syntax, capture it as link
         CaptureLinkToken();
@@ -328,11 +345,12 @@ void LinkParser::Match(std::stringstream &stream)
 }
 
 // link is in form of [txt](url), this method matches '['
-bool LinkParser::MatchAtLinkInit(std::stringstream &lookahead)
+bool LinkParser::MatchAtLinkInit(MarkDownCursor& lookahead)
 {
-    if (lookahead.peek() == '[')
+    if (lookahead.Peek() == '[')
     {
-        m_linkTextParsedResult.AddNewTokenToParsedResult((char)lookahead.get());
+        m_linkTextParsedResult.AddNewTokenToParsedResult(lookahead.GetPosition(), 1);
+        lookahead.Get();
         return true;
     }
 
@@ -342,30 +360,32 @@ bool LinkParser::MatchAtLinkInit(std::stringstream &lookahead)
 }
 
 // link is in form of [txt](url), this method matches txt
-bool LinkParser::MatchAtLinkTextRun(std::stringstream &lookahead)
+bool LinkParser::MatchAtLinkTextRun(MarkDownCursor& lookahead)
 {
-    if (lookahead.peek() == ']')
+    if (lookahead.Peek() == ']')
     {
-        m_linkTextParsedResult.AddNewTokenToParsedResult((char)lookahead.get());
+        m_linkTextParsedResult.AddNewTokenToParsedResult(lookahead.GetPosition(), 1);
+        lookahead.Get();
         return true;
     }
     else
     {
-        if (lookahead.peek() == '[')
+        if (lookahead.Peek() == '[')
         {
             m_parsedResult.AppendParseResult(m_linkTextParsedResult);
             return false;
         }
         else
         {
-            // Block() will process the inline items within Link Text block 
+            // Block() will process the inline items within Link Text block
             ParseBlock(lookahead);
             m_linkTextParsedResult.AppendParseResult(m_parsedResult);
 
-            if (lookahead.peek() == ']')
+            if (lookahead.Peek() == ']')
             {
-                // move code gen objects to link text list to further process it 
-                m_linkTextParsedResult.AddNewTokenToParsedResult((char)lookahead.get());
+                // move code gen objects to link text list to further process it
+                m_linkTextParsedResult.AddNewTokenToParsedResult(lookahead.GetPosition(), 1);
+                lookahead.Get();
                 return true;
             }
 
@@ -376,11 +396,12 @@ bool LinkParser::MatchAtLinkTextRun(std::stringstream &lookahead)
 }
 
 // link is in form of [txt](url), this method matches ']'
-bool LinkParser::MatchAtLinkTextEnd(std::stringstream &lookahead)
+bool LinkParser::MatchAtLinkTextEnd(MarkDownCursor& lookahead)
 {
-    if (lookahead.peek() == '(')
+    if (lookahead.Peek() == '(')
     {
-        m_linkTextParsedResult.AddNewTokenToParsedResult((char)lookahead.get());
+        m_linkTextParsedResult.AddNewTokenToParsedResult(lookahead.GetPosition(), 1);
+        lookahead.Get();
         return true;
     }
 
@@ -389,25 +410,25 @@ bool LinkParser::MatchAtLinkTextEnd(std::stringstream &lookahead)
 }
 
 // link is in form of [txt](url), this method matches '('
-bool LinkParser::MatchAtLinkDestinationStart(std::stringstream &lookahead)
+bool LinkParser::MatchAtLinkDestinationStart(MarkDownCursor& lookahead)
 {
     // control key is detected, syntax check failed
-    if (iscntrl(lookahead.peek()))
+    if (iscntrl(lookahead.Peek()))
     {
         m_parsedResult.AppendParseResult(m_linkTextParsedResult);
         return false;
     }
 
-    if (lookahead.peek() == ')')
+    if (lookahead.Peek() == ')')
     {
-        lookahead.get();
+        lookahead.Get();
         return true;
     }
 
     // parses destination
     ParseBlock(lookahead);
 
-    if (lookahead.peek() == ')')
+    if (lookahead.Peek() == ')')
     {
         return true;
     }
@@ -417,17 +438,17 @@ bool LinkParser::MatchAtLinkDestinationStart(std::stringstream &lookahead)
 }
 
 // link is in form of [txt](url), this method matches ')'
-bool LinkParser::MatchAtLinkDestinationRun(std::stringstream &lookahead)
+bool LinkParser::MatchAtLinkDestinationRun(MarkDownCursor& lookahead)
 {
-    if (isspace(lookahead.peek()) || iscntrl(lookahead.peek()))
+    if (isspace(lookahead.Peek()) || iscntrl(lookahead.Peek()))
     {
         m_parsedResult.AppendParseResult(m_linkTextParsedResult);
         return false;
     }
 
-    if (lookahead.peek() == ')')
+    if (lookahead.Peek() == ')')
     {
-        lookahead.get();
+        lookahead.Get();
         return true;
     }
 
@@ -437,22 +458,15 @@ bool LinkParser::MatchAtLinkDestinationRun(std::stringstream &lookahead)
 }
 
 // this method is called when link syntax check is complete
-// it processes the parsed result from link destination  and link text
-// and build a MarkDownStringHtmlGenerator that will output 
-// string in link syntax (text)[destination) will converts to
+// it processes the parsed result from link destination and link text
+// and builds a single token of the link; [text](destination) converts to
 // <a href=\destination\>text</a>
 void LinkParser::CaptureLinkToken()
 {
-    std::ostringstream html;
-    html << "<a href=\"";
-    // process link destination
-    html << m_parsedResult.GenerateHtmlString();
-    html << "\">";
-
     // when syntax check is complete, we have seen
     // '[', ']', '(', these keywords are not
     // needed anymore, so pop them from the parse result
-    // if syntax check failed for link, then they must be 
+    // if syntax check failed for link, then they must be
     // retained as part of parse result
     m_linkTextParsedResult.PopFront();
     m_linkTextParsedResult.PopBack();
@@ -461,50 +475,44 @@ void LinkParser::CaptureLinkToken()
     // translate what is captured in text of link
     // emphasis are processed here
     m_linkTextParsedResult.Translate();
-    html << m_linkTextParsedResult.GenerateHtmlString();
-    html << "</a>";
-
-    std::string html_string = html.str();
-
-    // Generate a MarkDownStringHtmlGenerator object
-    std::shared_ptr<MarkDownHtmlGenerator> codeGen =
-        std::make_shared<MarkDownStringHtmlGenerator>(html_string);
 
+    const int token = m_generator.AddLinkToken(m_linkTextParsedResult.GetFirstToken(), m_parsedResult.GetFirstToken());
+    m_linkTextParsedResult.Clear();
     m_parsedResult.Clear();
-    m_parsedResult.AppendToTokens(codeGen);
+    m_parsedResult.AppendToTokens(token);
 }
 
 // list marker have form of ^-\s+ or \r-\s+
 // this method matches -\s
-bool ListParser::MatchNewListItem(std::stringstream &stream)
+bool ListParser::MatchNewListItem(MarkDownCursor& cursor)
 {
-    if (IsHyphen(stream.peek()))
+    if (IsHyphen(cursor.Peek()))
     {
-        stream.get();
-        if (stream.peek() == ' ')
+        cursor.Get();
+        if (cursor.Peek() == ' ')
         {
-            stream.unget();
+            cursor.Unget();
             return true;
         }
-        stream.unget();
+        cursor.Unget();
     }
     return false;
 }
 
 // if lines are seperated by more than two new lines,
 // they are new block items
-// caller of this method is expected to have matched new line char 
+// caller of this method is expected to have matched new line char
 // before calling this method
 // this method will return true, after it mataches new line char
 // at least once.
-bool ListParser::MatchNewBlock(std::stringstream &stream)
+bool ListParser::MatchNewBlock(MarkDownCursor& cursor)
 {
-    if (IsNewLine(stream.peek()))
+    if (IsNewLine(cursor.Peek()))
     {
         do
         {
-            stream.get();
-        } while (IsNewLine(stream.peek()));
+            cursor.Get();
+        } while (IsNewLine(cursor.Peek()));
 
         return true;
     }
@@ -514,17 +522,17 @@ bool ListParser::MatchNewBlock(std::stringstream &stream)
 
 // ordered list marker has form of ^\d+\.\s* or [\r,\n]\d+\.\s*, and this method checks the syntax
 // this method matches \d+\.
-bool ListParser::MatchNewOrderedListItem(std::stringstream &stream, std::string &number_string)
+bool ListParser::MatchNewOrderedListItem(MarkDownCursor& cursor)
 {
     do
     {
-        number_string += (char)stream.get();
-    } while (isdigit(stream.peek()));
+        cursor.Get();
+    } while (isdigit(cursor.Peek()));
 
-    if (stream.peek() == '.')
+    if (cursor.Peek() == '.')
     {
         // ordered list syntax check complete
-        stream.unget();
+        cursor.Unget();
         return true;
     }
 
@@ -534,53 +542,54 @@ bool ListParser::MatchNewOrderedListItem(std::stringstream &stream, std::string
 // parse blocks that wasn't captured
 // if what we encounter is one of following items, start of new list, list item, or new block element,
 // we do not include in the current block, we return, and have it handled by the caller
-void ListParser::ParseSubBlocks(std::stringstream &stream)
+void ListParser::ParseSubBlocks(MarkDownCursor& cursor)
 {
-    while (!stream.eof())
+    while (!cursor.IsAtEnd())
     {
-        if (IsNewLine(stream.peek()))
+        if (IsNewLine(cursor.Peek()))
         {
-            int newLineChar = stream.get();
+            const size_t newLineOffset = cursor.GetPosition();
+            cursor.Get();
             // check if it is the start of new block items
-            if (isdigit(stream.peek()))
+            if (isdigit(cursor.Peek()))
             {
-                std::string number_string = "";
-                if (MatchNewOrderedListItem(stream, number_string))
+                const size_t numberOffset = cursor.GetPosition();
+                if (MatchNewOrderedListItem(cursor))
                 {
                     break;
                 }
                 else
                 {
-                    m_parsedResult.AddNewTokenToParsedResult(number_string);
+                    m_parsedResult.AddNewTokenToParsedResult(numberOffset, cursor.GetPosition() - numberOffset);
                 }
             }
-            else if (MatchNewListItem(stream) || MatchNewBlock(stream))
+            else if (MatchNewListItem(cursor) || MatchNewBlock(cursor))
             {
                 break;
             }
 
-            m_parsedResult.AddNewTokenToParsedResult((char)newLineChar);
+            m_parsedResult.AddNewTokenToParsedResult(newLineOffset, 1);
         }
-        ParseBlock(stream);
+        ParseBlock(cursor);
     }
 }
 
-bool ListParser::CompleteListParsing(std::stringstream &stream)
+bool ListParser::CompleteListParsing(MarkDownCursor& cursor)
 {
     // check for - of -\s+ list marker
-    if (stream.peek() == ' ')
+    if (cursor.Peek() == ' ')
     {
-        // at this point, syntax check is complete, 
+        // at this point, syntax check is complete,
         // thus any other spaces are ignored
         // remove space
         do
         {
-            stream.get();
-        } while (stream.peek() == ' ');
+            cursor.Get();
+        } while (cursor.Peek() == ' ');
 
-        ParseBlock(stream);
+        ParseBlock(cursor);
         // parse blocks that follows
-        ParseSubBlocks(stream);
+        ParseSubBlocks(cursor);
 
         return true;
     }
@@ -588,91 +597,77 @@ bool ListParser::CompleteListParsing(std::stringstream &stream)
 }
 
 // list marker has a form of ^-\s+ or [\r, \n]-\s+, and this method checks the syntax
-void ListParser::Match(std::stringstream &stream)
+void ListParser::Match(MarkDownCursor& cursor)
 {
     // check for - of -\s+ list marker
-    if (IsHyphen(stream.peek()))
+    if (IsHyphen(cursor.Peek()))
     {
-        stream.get();
-        if (CompleteListParsing(stream))
+        const size_t hyphenOffset = cursor.GetPosition();
+        cursor.Get();
+        if (CompleteListParsing(cursor))
         {
             CaptureListToken();
         }
         else
         {
             // if incorrect syntax, capture what was thrown as a new token.
-            m_parsedResult.AddNewTokenToParsedResult('-');
+            m_parsedResult.AddNewTokenToParsedResult(hyphenOffset, 1);
         }
     }
 }
 
 void ListParser::CaptureListToken()
 {
-    std::ostringstream html;
     m_parsedResult.Translate();
-    std::string htmlString = m_parsedResult.GenerateHtmlString();
-
-    html << "<li>";
-    html << htmlString;
-    html << "</li>";
-
-    std::string html_string = html.str();
-    std::shared_ptr<MarkDownListHtmlGenerator> codeGen =
-        std::make_shared<MarkDownListHtmlGenerator>(html_string);
 
+    const int token = m_generator.AddListItemToken(MarkDownTokenKind::UnorderedListItem, m_parsedResult.GetFirstToken());
     m_parsedResult.Clear();
-    m_parsedResult.AppendToTokens(codeGen);
+    m_parsedResult.AppendToTokens(token);
 }
 
 // ordered list marker has form of ^\d+\.\s* or [\r,\n]\d+\.\s*, and this method checks the syntax
-void OrderedListParser::Match(std::stringstream &stream)
+void OrderedListParser::Match(MarkDownCursor& cursor)
 {
-    // used to capture digit char
-    std::string number_string = "";
-    if (isdigit(stream.peek()))
+    if (isdigit(cursor.Peek()))
     {
+        // the digits are captured as the start of the list
+        const size_t numberOffset = cursor.GetPosition();
         do
         {
-            number_string += (char)stream.get();
-        } while (isdigit(stream.peek()));
+            cursor.Get();
+        } while (isdigit(cursor.Peek()));
+        const size_t numberLength = cursor.GetPosition() - numberOffset;
 
-        if (IsDot(stream.peek()))
+        if (IsDot(cursor.Peek()))
         {
             // ordered list syntax check complete
-            stream.get();
-            if (CompleteListParsing(stream))
+            cursor.Get();
+            if (CompleteListParsing(cursor))
             {
-                CaptureOrderedListToken(number_string);
+                CaptureOrderedListToken(numberOffset, numberLength);
             }
             else
             {
-                number_string += '.';
-                m_parsedResult.AddNewTokenToParsedResult(number_string);
+                m_parsedResult.AddNewTokenToParsedResult(numberOffset, numberLength + 1);
             }
         }
         else
         {
             // if incorrect syntax, capture as a new token.
-            m_parsedResult.AddNewTokenToParsedResult(number_string);
+            m_parsedResult.AddNewTokenToParsedResult(numberOffset, numberLength);
         }
-
     }
 }
 
-void OrderedListParser::CaptureOrderedListToken(std::string &number_string)
+void OrderedListParser::CaptureOrderedListToken(size_t numberOffset, size_t numberLength)
 {
-    std::ostringstream html;
     m_parsedResult.Translate();
-    std::string htmlString = m_parsedResult.GenerateHtmlString();
-
-    html << "<li>";
-    html << htmlString;
-    html << "</li>";
 
-    std::string html_string = html.str();
-    std::shared_ptr<MarkDownOrderedListHtmlGenerator> codeGen =
-        std::make_shared<MarkDownOrderedListHtmlGenerator>(html_string, number_string);
+    const int token = m_generator.AddListItemToken(MarkDownTokenKind::OrderedListItem, m_parsedResult.GetFirstToken());
+    MarkDownToken& listItem = m_generator.GetToken(token);
+    listItem.numberOffset = static_cast<unsigned int>(numberOffset);
+    listItem.numberLength = static_cast<unsigned int>(numberLength);
 
     m_parsedResult.Clear();
-    m_parsedResult.AppendToTokens(codeGen);
+    m_parsedResult.AppendToTokens(token);
 }
@@ -1,142 +1,211 @@
 #pragma once
+
+#include "pch.h"
 #include "MarkDownHtmlGenerator.h"
-#include <iomanip>
-#include "BaseCardElement.h"
 #include "MarkDownParsedResult.h"
+#include <cstdio>
 
 AdaptiveSharedNamespaceStart
-    class MarkDownBlockParser
+// Reads markdown a char at a time, as an input stream would: Peek and Get return EOF at the end
+// and set the end flag, which Unget clears, and reading on once the end is reached or an Unget
+// fails keeps returning EOF
+class MarkDownCursor
+{
+public:
+    MarkDownCursor(const char* markdown, size_t length) :
+        m_markdown(markdown), m_length(length), m_position(0), m_isAtEnd(false), m_hasFailed(false) {}
+
+    int Peek()
     {
-        public:
-        MarkDownBlockParser(){};
-        // Matches each MarkDown's Syntax Form
-        // For each match, stream moves to the next char
-        virtual void Match(std::stringstream &) = 0;
-        // Parses Block
-        void ParseBlock(std::stringstream &);
-        // Returns Parse result
-        MarkDownParsedResult &GetParsedResult() { return m_parsedResult; }
-
-        protected:
-        // Holds parsed results
-        MarkDownParsedResult m_parsedResult;
-    };
+        if (m_isAtEnd || m_hasFailed)
+        {
+            m_hasFailed = true;
+            return EOF;
+        }
+        if (m_position == m_length)
+        {
+            m_isAtEnd = true;
+            return EOF;
+        }
+        return static_cast<unsigned char>(m_markdown[m_position]);
+    }
 
-    class EmphasisParser: public MarkDownBlockParser
+    int Get()
     {
-        public:
-        enum EmphasisState
-        {   
-            // Text is being handled
-            Text = 0x0,
-            // Emphasis is being handled
-            Emphasis = 0x1,   
-            // Empahais Parsing is done
-            Captured = 0x2,
-        };
-
-        virtual void Match(std::stringstream &);
-        // Captures remaining charaters in given token
-        // and causes the emphasis parsing to terminate
-        void Flush(int ch, std::string& currentToken);
-        // check if given character is * or _
-        bool IsMarkDownDelimiter(int ch);
-        void CaptureCurrentCollectedStringAsRegularToken(std::string&currentToken); 
-        void CaptureCurrentCollectedStringAsRegularToken();
-        void UpdateCurrentEmphasisRunState(DelimiterType emphasisType);
-        // Check if current delimiter will be considererd as a delimiter run
-        bool IsEmphasisDelimiterRun(DelimiterType emphasisType) { return m_currentDelimiterType == emphasisType; }
-        void ResetCurrentEmphasisState() { m_delimiterCnts = 0; }
-        bool IsRightEmphasisDelimiter(int ch);
-        // Attempt to capture current emphasis as right emphasis
-        bool TryCapturingRightEmphasisToken(int ch, std::string &currentToken);
-        bool IsLeftEmphasisDelimiter(int ch) 
+        const int ch = Peek();
+        if (ch == EOF)
         {
-            return (m_delimiterCnts && 
-                    ch != EOF &&
-                    !isspace(ch) && 
-                    !(m_lookBehind == Alphanumeric && ispunct(ch)) && 
-                    !(m_lookBehind == Alphanumeric && m_currentDelimiterType == Underscore));
-        };
-        // Attempt to capture current emphasis as right emphasis
-        bool TryCapturingLeftEmphasisToken(int ch, std::string &currentToken);
-        void CaptureEmphasisToken(int ch, std::string &currentToken);
-        void UpdateLookBehind(int ch);
-        static DelimiterType GetDelimiterTypeForCharAtCurrentPosition(int ch) { return (ch == '*')? Asterisk : Underscore; };
-
-        typedef EmphasisState (* MatchWithChar)(EmphasisParser&, std::stringstream &, std::string &);
-        // Callback function that handles the Text State
-        static EmphasisState MatchText(EmphasisParser &, std::stringstream &, std::string &);
-        // Callback function that handles the Emphasis State
-        static EmphasisState MatchEmphasis(EmphasisParser &, std::stringstream &, std::string &);
-
-        protected:
-        bool m_checkLookAhead = false;
-        bool m_checkIntraWord = false;
-        int m_lookBehind = Init;
-        int m_delimiterCnts = 0;
-        DelimiterType m_currentDelimiterType = Init;
-        unsigned int m_current_state = 0;
-
-        // vector of callback functions that handles state transistions
-        std::vector<MatchWithChar> m_stateMachine = 
-            {
-                MatchText, 
-                MatchEmphasis,
-            };
-
-        // holds currently collected token
-        std::string m_current_token;
-    };
-
-    class LinkParser : public MarkDownBlockParser
+            m_hasFailed = true;
+            return EOF;
+        }
+        ++m_position;
+        return ch;
+    }
+
+    void Unget()
     {
-        public:
-        void Match(std::stringstream &);
-
-        private:
-        void CaptureLinkToken();
-
-        // Matches Initial sytax of link
-        bool MatchAtLinkInit(std::stringstream &);
-        // Matches LinkText Run sytax of link
-        bool MatchAtLinkTextRun(std::stringstream &);
-        // Matches LinkText End sytax of link
-        bool MatchAtLinkTextEnd(std::stringstream &); 
-        // Matches LinkDestination Start sytax of link
-        bool MatchAtLinkDestinationStart(std::stringstream &); 
-        // Matches LinkDestination Run sytax of link
-        bool MatchAtLinkDestinationRun(std::stringstream &);
-
-        // holds intermidiate result of LinkText
-        MarkDownParsedResult m_linkTextParsedResult;
-    };
-
-    class ListParser : public MarkDownBlockParser
+        m_isAtEnd = false;
+        if (m_hasFailed || m_position == 0)
+        {
+            m_hasFailed = true;
+            return;
+        }
+        --m_position;
+    }
+
+    bool IsAtEnd() const { return m_isAtEnd; }
+
+    // Position of the next char
+    size_t GetPosition() const { return m_position; }
+
+private:
+    const char* m_markdown;
+    size_t m_length;
+    size_t m_position;
+    bool m_isAtEnd;
+    bool m_hasFailed;
+};
+
+class MarkDownBlockParser
+{
+public:
+    explicit MarkDownBlockParser(MarkDownHtmlGenerator& generator) : m_generator(generator), m_parsedResult(generator) {}
+    // Matches each MarkDown's Syntax Form
+    // For each match, cursor moves to the next char
+    virtual void Match(MarkDownCursor&) = 0;
+    // Parses Block
+    void ParseBlock(MarkDownCursor&);
+    // Returns Parse result
+    MarkDownParsedResult& GetParsedResult() { return m_parsedResult; }
+
+protected:
+    MarkDownHtmlGenerator& m_generator;
+    // Holds parsed results
+    MarkDownParsedResult m_parsedResult;
+};
+
+class EmphasisParser : public MarkDownBlockParser
+{
+public:
+    enum EmphasisState
     {
-        public:
-        void Match(std::stringstream &);
-        bool MatchNewListItem(std::stringstream &);
-        bool MatchNewBlock(std::stringstream &);
-        bool MatchNewOrderedListItem(std::stringstream &, std::string &);
-        static bool IsHyphen(int ch) { return ch == '-'; };
-        static bool IsDot(int ch) { return ch == '.'; };
-        static bool IsNewLine(int ch){ return (ch == '\r') || (ch == '\n');};
-
-        protected:
-        void ParseSubBlocks(std::stringstream &);
-        bool CompleteListParsing(std::stringstream &stream);
-
-        private:
-        void CaptureListToken();
+        // Text is being handled
+        Text = 0x0,
+        // Emphasis is being handled
+        Emphasis = 0x1,
+        // Empahais Parsing is done
+        Captured = 0x2,
     };
 
-    class OrderedListParser : public ListParser
+    explicit EmphasisParser(MarkDownHtmlGenerator& generator) : MarkDownBlockParser(generator) {}
+
+    void Match(MarkDownCursor&) override;
+
+private:
+    // Handles the Text State
+    EmphasisState MatchText(MarkDownCursor&);
+    // Handles the Emphasis State
+    EmphasisState MatchEmphasis(MarkDownCursor&);
+    // Captures remaining charaters in current token
+    // and causes the emphasis parsing to terminate
+    void Flush(int ch);
+    // check if given character is * or _
+    bool IsMarkDownDelimiter(int ch) const;
+    void CaptureCurrentCollectedStringAsRegularToken();
+    void UpdateCurrentEmphasisRunState(DelimiterType emphasisType);
+    // Check if current delimiter will be considererd as a delimiter run
+    bool IsEmphasisDelimiterRun(DelimiterType emphasisType) const { return m_currentDelimiterType == emphasisType; }
+    void ResetCurrentEmphasisState() { m_delimiterCnts = 0; }
+    bool IsRightEmphasisDelimiter(int ch) const;
+    bool IsLeftEmphasisDelimiter(int ch) const
     {
-        public:
-        void Match(std::stringstream &);
-
-        private:
-        void CaptureOrderedListToken(std::string&);
-    };
+        return (m_delimiterCnts &&
+            ch != EOF &&
+            !isspace(ch) &&
+            !(m_lookBehind == Alphanumeric && ispunct(ch)) &&
+            !(m_lookBehind == Alphanumeric && m_currentDelimiterType == Underscore));
+    }
+    // Attempt to capture current emphasis as right emphasis
+    bool TryCapturingRightEmphasisToken(int ch);
+    // Attempt to capture current emphasis as left emphasis
+    bool TryCapturingLeftEmphasisToken(int ch);
+    void CaptureEmphasisToken(int ch);
+    void UpdateLookBehind(int ch);
+    static DelimiterType GetDelimiterTypeForCharAtCurrentPosition(int ch) { return (ch == '*') ? Asterisk : Underscore; }
+
+    // Adds the char just read to the current token
+    void AppendToCurrentToken(const MarkDownCursor& cursor, int ch);
+    bool IsCurrentTokenEmpty() const { return m_tokenLength == 0 && !m_isTokenEof; }
+    void ClearCurrentToken();
+
+    bool m_checkLookAhead = false;
+    bool m_checkIntraWord = false;
+    int m_lookBehind = Init;
+    int m_delimiterCnts = 0;
+    DelimiterType m_currentDelimiterType = Init;
+    EmphasisState m_current_state = Text;
+
+    // currently collected token: chars of the markdown, or EOF if it was read past the end
+    size_t m_tokenOffset = 0;
+    size_t m_tokenLength = 0;
+    bool m_isTokenEof = false;
+};
+
+class LinkParser : public MarkDownBlockParser
+{
+public:
+    explicit LinkParser(MarkDownHtmlGenerator& generator) : MarkDownBlockParser(generator), m_linkTextParsedResult(generator) {}
+
+    void Match(MarkDownCursor&) override;
+
+private:
+    void CaptureLinkToken();
+
+    // Matches Initial sytax of link
+    bool MatchAtLinkInit(MarkDownCursor&);
+    // Matches LinkText Run sytax of link
+    bool MatchAtLinkTextRun(MarkDownCursor&);
+    // Matches LinkText End sytax of link
+    bool MatchAtLinkTextEnd(MarkDownCursor&);
+    // Matches LinkDestination Start sytax of link
+    bool MatchAtLinkDestinationStart(MarkDownCursor&);
+    // Matches LinkDestination Run sytax of link
+    bool MatchAtLinkDestinationRun(MarkDownCursor&);
+
+    // holds intermidiate result of LinkText
+    MarkDownParsedResult m_linkTextParsedResult;
+};
+
+class ListParser : public MarkDownBlockParser
+{
+public:
+    explicit ListParser(MarkDownHtmlGenerator& generator) : MarkDownBlockParser(generator) {}
+
+    void Match(MarkDownCursor&) override;
+    bool MatchNewListItem(MarkDownCursor&);
+    bool MatchNewBlock(MarkDownCursor&);
+    // Matches digits, and returns true if they are followed by a dot
+    bool MatchNewOrderedListItem(MarkDownCursor&);
+    static bool IsHyphen(int ch) { return ch == '-'; }
+    static bool IsDot(int ch) { return ch == '.'; }
+    static bool IsNewLine(int ch) { return (ch == '\r') || (ch == '\n'); }
+
+protected:
+    void ParseSubBlocks(MarkDownCursor&);
+    bool CompleteListParsing(MarkDownCursor&);
+
+private:
+    void CaptureListToken();
+};
+
+class OrderedListParser : public ListParser
+{
+public:
+    explicit OrderedListParser(MarkDownHtmlGenerator& generator) : ListParser(generator) {}
+
+    void Match(MarkDownCursor&) override;
+
+private:
+    void CaptureOrderedListToken(size_t numberOffset, size_t numberLength);
+};
 AdaptiveSharedNamespaceEnd
@@ -1,209 +1,506 @@
 #include "pch.h"
 #include "MarkDownHtmlGenerator.h"
+#include <limits>
 
 using namespace AdaptiveSharedNamespace;
 
-std::string MarkDownStringHtmlGenerator::GenerateHtmlString()
+namespace
 {
-    if (m_isHead)
+    void AppendTag(MarkDownTag tag, std::string& html)
     {
-        m_token = "<p>" + m_token;
+        switch (tag)
+        {
+        case MarkDownTag::OpenItalic:
+            html += "<em>";
+            break;
+        case MarkDownTag::OpenBold:
+            html += "<strong>";
+            break;
+        case MarkDownTag::CloseItalic:
+            html += "</em>";
+            break;
+        case MarkDownTag::CloseBold:
+            html += "</strong>";
+            break;
+        }
     }
 
-    if (m_isTail)
+    // text is escaped html; its only entities are the ones of the escaped markdown
+    void AppendUnescapedText(const char* text, size_t length, std::string& result)
     {
-        return m_token + "</p>";
+        static const struct
+        {
+            const char* entity;
+            size_t length;
+            char ch;
+        } entities[] = { { "&lt;", 4, '<' }, { "&gt;", 4, '>' }, { "&quot;", 6, '"' }, { "&amp;", 5, '&' } };
+
+        size_t start = 0;
+        for (size_t i = 0; i < length; ++i)
+        {
+            if (text[i] != '&')
+            {
+                continue;
+            }
+
+            for (const auto& entity : entities)
+            {
+                if (length - i >= entity.length && std::equal(entity.entity, entity.entity + entity.length, text + i))
+                {
+                    result.append(text + start, i - start);
+                    result += entity.ch;
+                    i += entity.length - 1;
+                    start = i + 1;
+                    break;
+                }
+            }
+        }
+        result.append(text + start, length - start);
     }
+}
+
+MarkDownBlockType MarkDownToken::GetBlockType() const
+{
+    switch (kind)
+    {
+    case MarkDownTokenKind::UnorderedListItem:
+        return MarkDownBlockType::UnorderedList;
+    case MarkDownTokenKind::OrderedListItem:
+        return MarkDownBlockType::OrderedList;
+    default:
+        return MarkDownBlockType::ContainerBlock;
+    }
+}
+
+bool MarkDownToken::IsLeftEmphasis() const
+{
+    return kind == MarkDownTokenKind::LeftEmphasis || (kind == MarkDownTokenKind::LeftAndRightEmphasis && isLeftDirection);
+}
+
+bool MarkDownToken::IsRightEmphasis() const
+{
+    return kind == MarkDownTokenKind::RightEmphasis || (kind == MarkDownTokenKind::LeftAndRightEmphasis && !isLeftDirection);
+}
+
+MarkDownHtmlGenerator::MarkDownHtmlGenerator(const char* markdown, size_t length) :
+    m_markdown(markdown)
+{
+    m_tokens.reserve(length / 4 + 4);
+}
+
+int MarkDownHtmlGenerator::AddToken(MarkDownTokenKind kind, size_t offset, size_t length)
+{
+    MarkDownToken token = {};
+    token.kind = kind;
+    token.delimiterType = Init;
+    token.textOffset = static_cast<unsigned int>(offset);
+    token.textLength = static_cast<unsigned int>(length);
+    token.previous = token.next = token.nextEmphasis = -1;
+    token.firstTag = token.lastTag = -1;
+    token.firstChild = token.firstDestination = -1;
+    m_tokens.push_back(token);
+    return static_cast<int>(m_tokens.size() - 1);
+}
+
+int MarkDownHtmlGenerator::AddEmphasisToken(MarkDownTokenKind kind, size_t offset, size_t length, int numberOfDelimiters, DelimiterType type)
+{
+    const int index = AddToken(kind, offset, length);
+    MarkDownToken& token = m_tokens[index];
+    token.delimiterType = type;
+    token.numberOfUnusedDelimiters = numberOfDelimiters;
+    return index;
+}
+
+int MarkDownHtmlGenerator::AddLinkToken(int firstChild, int firstDestination)
+{
+    const int index = AddToken(MarkDownTokenKind::Link, 0, 0);
+    m_tokens[index].firstChild = firstChild;
+    m_tokens[index].firstDestination = firstDestination;
+    return index;
+}
 
-    return m_token;
+int MarkDownHtmlGenerator::AddListItemToken(MarkDownTokenKind kind, int firstChild)
+{
+    const int index = AddToken(kind, 0, 0);
+    m_tokens[index].firstChild = firstChild;
+    return index;
+}
+
+int MarkDownHtmlGenerator::AddCharToken(char ch)
+{
+    const int index = AddToken(MarkDownTokenKind::Text, m_capturedText.size(), 1);
+    m_tokens[index].isTextCaptured = true;
+    m_capturedText += ch;
+    return index;
 }
 
-//     left and right emphasis tokens are match if
-//     1. they are same types
-//     2. neither of the emphasis tokens are both left and right emphasis tokens, and 
-//        if either or both of them are, then their sum is not multiple of 3 
-bool MarkDownEmphasisHtmlGenerator::IsMatch(std::shared_ptr<MarkDownEmphasisHtmlGenerator> &emphasisToken)
+bool MarkDownHtmlGenerator::IsMatch(int leftToken, int rightToken) const
 {
-    if (this->type == emphasisToken->type)
+    const MarkDownToken& left = m_tokens[leftToken];
+    const MarkDownToken& right = m_tokens[rightToken];
+    if (left.delimiterType == right.delimiterType)
     {
-        // rule #9 & #10, sum of delimiter count can't be multiple of 3 
-        return !((this->IsLeftAndRightEmphasis() || emphasisToken->IsLeftAndRightEmphasis()) &&
-            (((this->m_numberOfUnusedDelimiters + emphasisToken->m_numberOfUnusedDelimiters) % 3) == 0));
+        // rule #9 & #10, sum of delimiter count can't be multiple of 3
+        return !((left.IsLeftAndRightEmphasis() || right.IsLeftAndRightEmphasis()) &&
+            (((left.numberOfUnusedDelimiters + right.numberOfUnusedDelimiters) % 3) == 0));
     }
     return false;
 }
 
-bool MarkDownEmphasisHtmlGenerator::IsSameType(std::shared_ptr<MarkDownEmphasisHtmlGenerator> &token)
+bool MarkDownHtmlGenerator::IsSameType(int leftToken, int rightToken) const
 {
-    return this->type == token->type;
+    return m_tokens[leftToken].delimiterType == m_tokens[rightToken].delimiterType;
 }
 
-// adjust number of emphasis counts after maching is done
-int MarkDownEmphasisHtmlGenerator::AdjustEmphasisCounts(int leftOver, std::shared_ptr<MarkDownEmphasisHtmlGenerator> rightToken)
+void MarkDownHtmlGenerator::GenerateTags(int leftToken, int rightToken)
 {
+    MarkDownToken& left = m_tokens[leftToken];
+    MarkDownToken& right = m_tokens[rightToken];
+
+    // adjust number of emphasis counts after maching is done
     int delimiterCount = 0;
+    const int leftOver = left.numberOfUnusedDelimiters - right.numberOfUnusedDelimiters;
     if (leftOver >= 0)
     {
-        delimiterCount = this->m_numberOfUnusedDelimiters - leftOver;
-        this->m_numberOfUnusedDelimiters = leftOver;
-        rightToken->m_numberOfUnusedDelimiters = 0;
+        delimiterCount = left.numberOfUnusedDelimiters - leftOver;
+        left.numberOfUnusedDelimiters = leftOver;
+        right.numberOfUnusedDelimiters = 0;
     }
     else
     {
-        delimiterCount = this->m_numberOfUnusedDelimiters;
-        rightToken->m_numberOfUnusedDelimiters = leftOver * (-1);
-        this->m_numberOfUnusedDelimiters = 0;
+        delimiterCount = left.numberOfUnusedDelimiters;
+        right.numberOfUnusedDelimiters = -leftOver;
+        left.numberOfUnusedDelimiters = 0;
     }
-    return delimiterCount;
-}
-
-// generate bold and emphasis html tags
-void MarkDownEmphasisHtmlGenerator::GenerateTags(std::shared_ptr<MarkDownEmphasisHtmlGenerator> &token)
-{
-    int delimiterCount = 0, leftOver = 0;
-    leftOver = this->m_numberOfUnusedDelimiters - token->m_numberOfUnusedDelimiters;
-    delimiterCount = this->AdjustEmphasisCounts(leftOver, token);
 
     // emphasis found
     if (delimiterCount % 2)
     {
-        this->PushItalicTag();
-        token->PushItalicTag();
+        PushItalicTag(leftToken);
+        PushItalicTag(rightToken);
     }
 
     // strong emphasis found
     for (int i = 0; i < delimiterCount / 2; i++)
     {
-        this->PushBoldTag();
-        token->PushBoldTag();
+        PushBoldTag(leftToken);
+        PushBoldTag(rightToken);
     }
 }
 
-void MarkDownEmphasisHtmlGenerator::PushItalicTag()
+void MarkDownHtmlGenerator::PushItalicTag(int token)
 {
-    m_tags.push_back("<em>");
+    PushTag(token, m_tokens[token].IsLeftEmphasis() ? MarkDownTag::OpenItalic : MarkDownTag::CloseItalic);
 }
 
-void MarkDownEmphasisHtmlGenerator::PushBoldTag()
+void MarkDownHtmlGenerator::PushBoldTag(int token)
 {
-    m_tags.push_back("<strong>");
+    PushTag(token, m_tokens[token].IsLeftEmphasis() ? MarkDownTag::OpenBold : MarkDownTag::CloseBold);
 }
 
-std::string MarkDownLeftEmphasisHtmlGenerator::GenerateHtmlString()
+void MarkDownHtmlGenerator::PushTag(int token, MarkDownTag tag)
 {
-    if (m_numberOfUnusedDelimiters)
+    MarkDownToken& emphasis = m_tokens[token];
+    const int index = static_cast<int>(m_tags.size());
+    m_tags.push_back({ tag, -1 });
+
+    if (emphasis.firstTag < 0)
     {
-        unsigned long startIdx = static_cast<unsigned long>(m_token.size()) - m_numberOfUnusedDelimiters;
-        html << m_token.substr(startIdx, std::string::npos);
+        emphasis.firstTag = emphasis.lastTag = index;
     }
-
-    // append tags; since left delims, append it in the reverse order
-    for (auto itr = m_tags.rbegin(); itr != m_tags.rend(); itr++)
+    else if (emphasis.kind == MarkDownTokenKind::LeftEmphasis)
     {
-        html << *itr;
+        // opening tags of left delims are generated in the reverse order
+        m_tags[index].next = emphasis.firstTag;
+        emphasis.firstTag = index;
     }
-
-    if (m_isHead)
+    else
     {
-        return "<p>" + html.str();
+        m_tags[emphasis.lastTag].next = index;
+        emphasis.lastTag = index;
     }
+}
 
-    if (m_isTail)
+void MarkDownHtmlGenerator::GenerateHtmlString(int index, std::string& html) const
+{
+    const MarkDownToken& token = m_tokens[index];
+    switch (token.kind)
     {
-        return html.str() + "</p>";
+    case MarkDownTokenKind::LeftEmphasis:
+    case MarkDownTokenKind::RightEmphasis:
+    case MarkDownTokenKind::LeftAndRightEmphasis:
+    {
+        // an emphasis at the head of a block isn't closed by it, even if it is also the tail
+        if (token.isHead)
+        {
+            html += "<p>";
+        }
+
+        // unused delims are generated as text, before the tags of left delims and after the
+        // tags of right ones
+        const size_t unusedOffset = token.textOffset + token.textLength - token.numberOfUnusedDelimiters;
+        if (token.kind == MarkDownTokenKind::LeftEmphasis)
+        {
+            AppendText(token, unusedOffset, token.numberOfUnusedDelimiters, html);
+            AppendTags(token, html);
+        }
+        else
+        {
+            AppendTags(token, html);
+            AppendText(token, unusedOffset, token.numberOfUnusedDelimiters, html);
+        }
+
+        if (token.isTail && !token.isHead)
+        {
+            html += "</p>";
+        }
+        break;
+    }
+    case MarkDownTokenKind::Link:
+        if (token.isHead)
+        {
+            html += "<p>";
+        }
+        html += "<a href=\"";
+        GenerateChildrenHtmlString(token.firstDestination, html);
+        html += "\">";
+        GenerateChildrenHtmlString(token.firstChild, html);
+        html += "</a>";
+        if (token.isTail)
+        {
+            html += "</p>";
+        }
+        break;
+    case MarkDownTokenKind::UnorderedListItem:
+        if (token.isHead)
+        {
+            html += "<ul>";
+        }
+        html += "<li>";
+        GenerateChildrenHtmlString(token.firstChild, html);
+        html += "</li>";
+        if (token.isTail)
+        {
+            html += "</ul>";
+        }
+        break;
+    case MarkDownTokenKind::OrderedListItem:
+        if (token.isHead)
+        {
+            html += "<ol start=\"";
+            html.append(m_markdown + token.numberOffset, token.numberLength);
+            html += "\">";
+        }
+        html += "<li>";
+        GenerateChildrenHtmlString(token.firstChild, html);
+        html += "</li>";
+        if (token.isTail)
+        {
+            html += "</ol>";
+        }
+        break;
+    default:
+        if (token.isHead)
+        {
+            html += "<p>";
+        }
+        AppendText(token, token.textOffset, token.textLength, html);
+        if (token.isTail)
+        {
+            html += "</p>";
+        }
+        break;
     }
-
-    return html.str();
 }
 
-void MarkDownRightEmphasisHtmlGenerator::PushItalicTag()
+void MarkDownHtmlGenerator::GenerateChildrenHtmlString(int firstToken, std::string& html) const
 {
-    m_tags.push_back("</em>");
+    for (int token = firstToken; token >= 0; token = m_tokens[token].next)
+    {
+        GenerateHtmlString(token, html);
+    }
 }
 
-void MarkDownRightEmphasisHtmlGenerator::PushBoldTag()
+void MarkDownHtmlGenerator::AppendText(const MarkDownToken& token, size_t offset, size_t length, std::string& html) const
 {
-    m_tags.push_back("</strong>");
+    html.append((token.isTextCaptured ? m_capturedText.data() : m_markdown) + offset, length);
 }
 
-std::string MarkDownRightEmphasisHtmlGenerator::GenerateHtmlString()
+void MarkDownHtmlGenerator::AppendTags(const MarkDownToken& token, std::string& html) const
 {
-    // append tags; 
-    for (auto itr = m_tags.begin(); itr != m_tags.end(); itr++)
-    {
-        html << *itr;
-    }
-
-    // if there are unused emphasis, append them 
-    if (m_numberOfUnusedDelimiters)
+    for (int tag = token.firstTag; tag >= 0; tag = m_tags[tag].next)
     {
-        unsigned long startIdx = static_cast<unsigned long>(m_token.size()) - m_numberOfUnusedDelimiters;
-        html << m_token.substr(startIdx, std::string::npos);
+        AppendTag(m_tags[tag].tag, html);
     }
+}
 
-    if (m_isHead)
-    {
-        return "<p>" + html.str();
-    }
+// Generates the blocks of runs that the html of the tokens describes: a paragraph or list item is
+// a block, and the text within it a run, formatted by the tags and link it is in
+void MarkDownHtmlGenerator::GenerateBlocks(int firstToken, std::vector<MarkDownBlock>& blocks) const
+{
+    RunFormat format = { 0, 0, nullptr, -1, 0 };
+    bool isInParagraph = false;
+    unsigned int listNumber = 0;
 
-    if (m_isTail)
+    for (int index = firstToken; index >= 0; index = m_tokens[index].next)
     {
-        return html.str() + "</p>";
+        const MarkDownToken& token = m_tokens[index];
+        const MarkDownBlockType type = token.GetBlockType();
+        if (type == MarkDownBlockType::ContainerBlock)
+        {
+            if (token.isHead || !isInParagraph)
+            {
+                blocks.push_back({ MarkDownBlockType::ContainerBlock, 0, {} });
+            }
+            GenerateRuns(token, format, blocks.back());
+            isInParagraph = !token.isTail;
+        }
+        else
+        {
+            // like <ol start="">, the items of an ordered list are numbered from the first one
+            listNumber = token.isHead ? GetListNumber(token) : listNumber + 1;
+            blocks.push_back({ type, (type == MarkDownBlockType::OrderedList) ? listNumber : 0, {} });
+            GenerateRuns(token.firstChild, format, blocks.back());
+            isInParagraph = false;
+        }
     }
-
-    return html.str();
 }
 
-void MarkDownLeftAndRightEmphasisHtmlGenerator::PushItalicTag()
+void MarkDownHtmlGenerator::GenerateRuns(int firstToken, RunFormat& format, MarkDownBlock& block) const
 {
-    if (m_directionType == Left)
-    {
-        m_tags.push_back("<em>");
-    }
-    else
+    for (int token = firstToken; token >= 0; token = m_tokens[token].next)
     {
-        m_tags.push_back("</em>");
+        GenerateRuns(m_tokens[token], format, block);
     }
 }
 
-void MarkDownLeftAndRightEmphasisHtmlGenerator::PushBoldTag()
+void MarkDownHtmlGenerator::GenerateRuns(const MarkDownToken& token, RunFormat& format, MarkDownBlock& block) const
 {
-    if (m_directionType == Left)
+    switch (token.kind)
     {
-        m_tags.push_back("<strong>");
+    case MarkDownTokenKind::LeftEmphasis:
+    case MarkDownTokenKind::RightEmphasis:
+    case MarkDownTokenKind::LeftAndRightEmphasis:
+    {
+        const size_t unusedOffset = token.textOffset + token.textLength - token.numberOfUnusedDelimiters;
+        if (token.kind == MarkDownTokenKind::LeftEmphasis)
+        {
+            AppendRunText(token, unusedOffset, token.numberOfUnusedDelimiters, format, block);
+            AppendRunTags(token, format);
+        }
+        else
+        {
+            AppendRunTags(token, format);
+            AppendRunText(token, unusedOffset, token.numberOfUnusedDelimiters, format, block);
+        }
+        break;
     }
-    else
+    case MarkDownTokenKind::Link:
     {
-        m_tags.push_back("</strong>");
+        std::string linkTarget;
+        AppendPlainText(token.firstDestination, linkTarget);
+
+        const std::string* outerLinkTarget = format.linkTarget;
+        const int outerLinkIndex = format.linkIndex;
+        format.linkTarget = &linkTarget;
+        format.linkIndex = format.linkCount++;
+        GenerateRuns(token.firstChild, format, block);
+        format.linkTarget = outerLinkTarget;
+        format.linkIndex = outerLinkIndex;
+        break;
+    }
+    case MarkDownTokenKind::UnorderedListItem:
+    case MarkDownTokenKind::OrderedListItem:
+        // a list nested in a block is part of its text
+        GenerateRuns(token.firstChild, format, block);
+        break;
+    default:
+        AppendRunText(token, token.textOffset, token.textLength, format, block);
+        break;
     }
 }
 
-std::string MarkDownListHtmlGenerator::GenerateHtmlString()
+void MarkDownHtmlGenerator::AppendRunText(const MarkDownToken& token, size_t offset, size_t length, const RunFormat& format, MarkDownBlock& block) const
 {
-    if (m_isHead)
+    if (length == 0)
     {
-        m_token = "<ul>" + m_token;
+        return;
     }
 
-    if (m_isTail)
+    const bool isBold = format.boldCount > 0;
+    const bool isItalic = format.italicCount > 0;
+    static const std::string noLinkTarget;
+    const std::string& linkTarget = format.linkTarget ? *format.linkTarget : noLinkTarget;
+    if (block.runs.empty() ||
+        block.runs.back().isBold != isBold ||
+        block.runs.back().isItalic != isItalic ||
+        block.runs.back().linkIndex != format.linkIndex)
     {
-        return m_token + "</ul>";
+        block.runs.push_back({ std::string(), isBold, isItalic, linkTarget, format.linkIndex });
     }
 
-    return m_token;
+    AppendUnescapedText((token.isTextCaptured ? m_capturedText.data() : m_markdown) + offset, length, block.runs.back().text);
 }
 
-std::string MarkDownOrderedListHtmlGenerator::GenerateHtmlString()
+void MarkDownHtmlGenerator::AppendRunTags(const MarkDownToken& token, RunFormat& format) const
 {
-    if (m_isHead)
+    for (int tag = token.firstTag; tag >= 0; tag = m_tags[tag].next)
     {
-        m_token = "<ol start=\"" + m_numberString + "\">" + m_token;
+        switch (m_tags[tag].tag)
+        {
+        case MarkDownTag::OpenItalic:
+            ++format.italicCount;
+            break;
+        case MarkDownTag::OpenBold:
+            ++format.boldCount;
+            break;
+        case MarkDownTag::CloseItalic:
+            --format.italicCount;
+            break;
+        case MarkDownTag::CloseBold:
+            --format.boldCount;
+            break;
+        }
     }
+}
 
-    if (m_isTail)
+// Appends the text of the tokens without any formatting, as of a link destination
+void MarkDownHtmlGenerator::AppendPlainText(int firstToken, std::string& text) const
+{
+    for (int index = firstToken; index >= 0; index = m_tokens[index].next)
     {
-        return m_token + "</ol>";
+        const MarkDownToken& token = m_tokens[index];
+        switch (token.kind)
+        {
+        case MarkDownTokenKind::LeftEmphasis:
+        case MarkDownTokenKind::RightEmphasis:
+        case MarkDownTokenKind::LeftAndRightEmphasis:
+            AppendUnescapedText(m_markdown + token.textOffset + token.textLength - token.numberOfUnusedDelimiters,
+                token.numberOfUnusedDelimiters, text);
+            break;
+        case MarkDownTokenKind::Link:
+        case MarkDownTokenKind::UnorderedListItem:
+        case MarkDownTokenKind::OrderedListItem:
+            AppendPlainText(token.firstChild, text);
+            break;
+        default:
+            AppendUnescapedText((token.isTextCaptured ? m_capturedText.data() : m_markdown) + token.textOffset, token.textLength, text);
+            break;
+        }
     }
+}
 
-    return m_token;
+unsigned int MarkDownHtmlGenerator::GetListNumber(const MarkDownToken& token) const
+{
+    unsigned int number = 0;
+    for (unsigned int i = 0; i < token.numberLength; ++i)
+    {
+        const unsigned int digit = static_cast<unsigned int>(m_markdown[token.numberOffset + i] - '0');
+        if (number > (std::numeric_limits<unsigned int>::max() - digit) / 10)
+        {
+            return std::numeric_limits<unsigned int>::max();
+        }
+        number = number * 10 + digit;
+    }
+    return number;
 }
@@ -1,9 +1,6 @@
 #pragma once
-#include <string>
-#include <iomanip>
-#include <vector>
-#include <list>
-#include "BaseCardElement.h"
+
+#include "pch.h"
 
 AdaptiveSharedNamespaceStart
 
@@ -18,181 +15,190 @@ enum DelimiterType
     Asterisk,
 };
 
-// this class knows how to generate html string of their types 
-// - MarkDownStringHtmlGenerator 
+// What a token knows about generating its html
+// - Text
 //   it is the most basic form,
-//   it simply retains and return text as string
-// - MarkDownEmphasisHtmlGenerator 
-//   it knows how to handle bold and italic html
-//   tags and apply those to its text when asked to generate html string
-// - MarkDownListHtmlGenerator
-//   it functions simmilary as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-//   MarkDownBlockType, this is used in generating html block tags
-//   list uses block tag of <ul> all others use <p>
-class MarkDownHtmlGenerator
+//   it simply retains and returns its text
+// - NewLine
+//   it contains a new line char
+// - LeftEmphasis, RightEmphasis
+//   they know how to generate opening and closing bold and italic html tags
+// - LeftAndRightEmphasis
+//   it can have both directions, and its final direction is determined at the later stage
+// - Link
+//   it holds the tokens of its text and of its destination
+// - UnorderedListItem, OrderedListItem
+//   they hold the tokens of their content, and their block types are used in generating html
+//   block tags; lists use <ul> and <ol>, all others use <p>
+enum class MarkDownTokenKind : unsigned char
 {
-    public:
-        enum MarkDownBlockType
-        {
-            ContainerBlock,
-            UnorderedList,
-            OrderedList
-        };
-
-        MarkDownHtmlGenerator() : m_token(""){};
-        MarkDownHtmlGenerator(std::string &token) : m_token(token){};
-        void MakeItHead() { m_isHead = true; }
-        void MakeItTail() { m_isTail = true; }
-        virtual bool IsNewLine() { return false; }
-        virtual std::string GenerateHtmlString() = 0;
-        virtual MarkDownBlockType GetBlockType() const { return ContainerBlock; }; 
-    protected:
-        std::string m_token;
-        std::ostringstream html;
-        bool m_isHead = false;
-        bool m_isTail = false;
-};
-
-// - MarkDownStringHtmlGenerator 
-//   it is the most basic form,
-//   it simply retains and return text as string
-class MarkDownStringHtmlGenerator : public MarkDownHtmlGenerator
-{ 
-    public:
-        MarkDownStringHtmlGenerator(std::string &token) : MarkDownHtmlGenerator(token){};
-        std::string GenerateHtmlString();
+    Text,
+    NewLine,
+    LeftEmphasis,
+    RightEmphasis,
+    LeftAndRightEmphasis,
+    Link,
+    UnorderedListItem,
+    OrderedListItem,
 };
 
-// - MarkDownNewLineHtmlGenerator 
-//   it contains new line chars
-class MarkDownNewLineHtmlGenerator : public MarkDownStringHtmlGenerator 
-{ 
-    public:
-        MarkDownNewLineHtmlGenerator(std::string &token) : MarkDownStringHtmlGenerator(token){};
-        bool IsNewLine() { return true; }
-};
-
-// - MarkDownEmphasisHtmlGenerator 
-//   it knows how to handle bold and italic html
-//   tags and apply those to its text when asked to generate html string
-class MarkDownEmphasisHtmlGenerator : public MarkDownHtmlGenerator
+enum class MarkDownBlockType : unsigned char
 {
-    public:
-        MarkDownEmphasisHtmlGenerator(std::string &token, 
-                int sizeOfEmphasisDelimiterRun,
-                DelimiterType type
-                ) : MarkDownHtmlGenerator(token), 
-        m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun), type(type){};
-
-        MarkDownEmphasisHtmlGenerator(std::string &token, 
-                int sizeOfEmphasisDelimiterRun,
-                DelimiterType type,
-                std::vector<std::string> &tags
-                ) : MarkDownHtmlGenerator(token), 
-        m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun), type(type), m_tags(tags){};
-
-        virtual bool IsRightEmphasis() const { return false; }
-        virtual bool IsLeftEmphasis() const  { return false; }
-        virtual bool IsLeftAndRightEmphasis() const { return false; }
-        virtual void PushItalicTag(); 
-        virtual void PushBoldTag(); 
-
-        bool IsMatch(std::shared_ptr<MarkDownEmphasisHtmlGenerator> &token);
-        bool IsSameType(std::shared_ptr<MarkDownEmphasisHtmlGenerator> &token);
-        bool IsDone() const { return m_numberOfUnusedDelimiters == 0; }
-        int GetNumberOfUnusedDelimiters() const { return m_numberOfUnusedDelimiters; };
-        void GenerateTags(std::shared_ptr<MarkDownEmphasisHtmlGenerator> &token);
-        void ReverseDirectionType() { m_directionType = !m_directionType; };
-    protected:
-        enum 
-        {
-            Left = 0,
-            Right = 1,
-        };
-
-        int AdjustEmphasisCounts(int leftOver, std::shared_ptr<MarkDownEmphasisHtmlGenerator> rightToken);
-        int m_numberOfUnusedDelimiters;
-        int m_directionType = Right;
-        DelimiterType type;
-        std::vector<std::string> m_tags;
-
+    ContainerBlock,
+    UnorderedList,
+    OrderedList,
 };
 
-// - MarkDownLeftEmphasisHtmlGenerator 
-//   it knows how to generates opening italic and bold html tags
-class MarkDownLeftEmphasisHtmlGenerator : public MarkDownEmphasisHtmlGenerator 
+// A run of text that has the same formatting throughout
+struct MarkDownRun
 {
-    public:
-        MarkDownLeftEmphasisHtmlGenerator (std::string &token, 
-                int sizeOfEmphasisDelimiterRun,
-                DelimiterType type) : MarkDownEmphasisHtmlGenerator(token, 
-                    sizeOfEmphasisDelimiterRun, type){};
-        
-        MarkDownLeftEmphasisHtmlGenerator(std::string &token, 
-                int sizeOfEmphasisDelimiterRun,
-                DelimiterType type, std::vector<std::string> &tags) : MarkDownEmphasisHtmlGenerator(token, 
-                    sizeOfEmphasisDelimiterRun, type, tags){};
-
-        bool IsLeftEmphasis() const  { return true; }
-        std::string GenerateHtmlString();
+    std::string text;
+    bool isBold;
+    bool isItalic;
+    // Destination of the link the run is in, empty if it is not in one
+    std::string linkTarget;
+    // Index of the link the run is in among the links of the text, in order, or -1 if it is not in
+    // one. The runs of a link share it, so adjacent links to the same destination stay apart.
+    int linkIndex;
 };
 
-// - MarkDownRightEmphasisHtmlGenerator 
-//   it knows how to generates closing italic and bold html tags
-class MarkDownRightEmphasisHtmlGenerator : public MarkDownEmphasisHtmlGenerator 
+// A paragraph (ContainerBlock) or a list item, as the runs of its text. Blocks nested in a
+// list item or link are flattened into its runs.
+struct MarkDownBlock
 {
-    public:
-        MarkDownRightEmphasisHtmlGenerator(std::string &token, 
-                int sizeOfEmphasisDelimiterRun,
-                DelimiterType type) : MarkDownEmphasisHtmlGenerator(token, 
-                    sizeOfEmphasisDelimiterRun, type){};
-
-        void GenerateTags(std::shared_ptr<MarkDownEmphasisHtmlGenerator> &token);
-        bool IsRightEmphasis() const { return true; }
-        std::string GenerateHtmlString();
-        void PushItalicTag(); 
-        void PushBoldTag(); 
+    MarkDownBlockType type;
+    // The number of an OrderedList item
+    unsigned int listNumber;
+    std::vector<MarkDownRun> runs;
 };
 
-// - MarkDownLeftAndRightEmphasisHtmlGenerator 
-//   it can have both directions, and its final direction is determined at the later stage
-class MarkDownLeftAndRightEmphasisHtmlGenerator : public MarkDownRightEmphasisHtmlGenerator 
+enum class MarkDownTag : unsigned char
 {
-    public:
-        MarkDownLeftAndRightEmphasisHtmlGenerator(std::string &token, 
-                int sizeOfEmphasisDelimiterRun,
-                DelimiterType type) : MarkDownRightEmphasisHtmlGenerator(token, 
-                    sizeOfEmphasisDelimiterRun, type) {};
-        bool IsRightEmphasis() const { return m_directionType == Right; }
-        bool IsLeftEmphasis() const  { return m_directionType == Left; }
-        bool IsLeftAndRightEmphasis() const { return true; };
-        void PushItalicTag(); 
-        void PushBoldTag(); 
+    OpenItalic,
+    OpenBold,
+    CloseItalic,
+    CloseBold,
 };
 
-// - MarkDownListHtmlGenerator
-//   it functions simmilary as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-//   UnorderedList type, this is used in generating html block tags <ul>
-class MarkDownListHtmlGenerator : public MarkDownStringHtmlGenerator 
+// A token of parsed markdown. Tokens are linked into the lists of the MarkDownParsedResult that
+// holds them by index rather than owned by it, so moving tokens from one result to another never
+// copies them.
+struct MarkDownToken
 {
-    public:
-        MarkDownListHtmlGenerator(std::string &token) : MarkDownStringHtmlGenerator(token) {};
-        std::string GenerateHtmlString();
-        MarkDownBlockType GetBlockType() const { return UnorderedList; }; 
+    MarkDownTokenKind kind;
+    bool isHead;
+    bool isTail;
+
+    // The text is held by the generator rather than in the markdown
+    bool isTextCaptured;
+
+    // Of emphasis tokens: the delimiter of the run, and the direction it is taken in so far, which
+    // only LeftAndRightEmphasis tokens change
+    DelimiterType delimiterType;
+    bool isLeftDirection;
+    int numberOfUnusedDelimiters;
+
+    unsigned int textOffset;
+    unsigned int textLength;
+
+    // The start of an OrderedListItem
+    unsigned int numberOffset;
+    unsigned int numberLength;
+
+    // The first of the tokens a Link or list item holds: the content of a list item or the text
+    // of a link, and the destination of a link
+    int firstChild;
+    int firstDestination;
+
+    // Neighbours in the token list, and the next emphasis in the emphasis look up table
+    int previous;
+    int next;
+    int nextEmphasis;
+
+    // The html tags the emphasis has been matched with, in the order they are generated
+    int firstTag;
+    int lastTag;
+
+    MarkDownBlockType GetBlockType() const;
+    bool IsLeftEmphasis() const;
+    bool IsRightEmphasis() const;
+    bool IsLeftAndRightEmphasis() const { return kind == MarkDownTokenKind::LeftAndRightEmphasis; }
+    bool IsDone() const { return numberOfUnusedDelimiters == 0; }
+    void ReverseDirectionType() { isLeftDirection = !isLeftDirection; }
 };
 
-// - MarkDownUnorderedListHtmlGenerator
-//   it functions simmilary as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-//   OrderedList type, this is used in generating html block tags <ol>
-class MarkDownOrderedListHtmlGenerator : public MarkDownStringHtmlGenerator 
+// Holds the tokens of one markdown string and generates their html, or the blocks of runs that
+// the html describes. Tokens refer to the markdown for their text, so the markdown must outlive
+// the generator.
+class MarkDownHtmlGenerator
 {
-    public:
-        MarkDownOrderedListHtmlGenerator(std::string &token, std::string &number_string) : 
-            MarkDownStringHtmlGenerator(token), m_numberString(number_string) {};
-        std::string GenerateHtmlString();
-        MarkDownBlockType GetBlockType() const { return OrderedList; }; 
-    private:
-        std::string m_numberString;
+public:
+    MarkDownHtmlGenerator(const char* markdown, size_t length);
+    MarkDownHtmlGenerator(const MarkDownHtmlGenerator&) = delete;
+    MarkDownHtmlGenerator& operator=(const MarkDownHtmlGenerator&) = delete;
+
+    MarkDownToken& GetToken(int token) { return m_tokens[token]; }
+    const MarkDownToken& GetToken(int token) const { return m_tokens[token]; }
+
+    // Adds a token for length chars of the markdown from offset
+    int AddToken(MarkDownTokenKind kind, size_t offset, size_t length);
+    int AddEmphasisToken(MarkDownTokenKind kind, size_t offset, size_t length, int numberOfDelimiters, DelimiterType type);
+
+    // Adds a token holding the list of tokens starting at firstChild, as a link also the list
+    // starting at firstDestination
+    int AddLinkToken(int firstChild, int firstDestination);
+    int AddListItemToken(MarkDownTokenKind kind, int firstChild);
+
+    // Adds a token holding ch, for chars the markdown doesn't have
+    int AddCharToken(char ch);
+
+    // left and right emphasis tokens are match if
+    // 1. they are same types
+    // 2. neither of the emphasis tokens are both left and right emphasis tokens, and
+    //    if either or both of them are, then their sum is not multiple of 3
+    bool IsMatch(int leftToken, int rightToken) const;
+    bool IsSameType(int leftToken, int rightToken) const;
+
+    // generate bold and emphasis html tags for the delimiters left and right have in common
+    void GenerateTags(int leftToken, int rightToken);
+
+    void GenerateHtmlString(int token, std::string& html) const;
+    // Adds the runs of the list of tokens starting at firstToken to blocks
+    void GenerateBlocks(int firstToken, std::vector<MarkDownBlock>& blocks) const;
+
+private:
+    struct Tag
+    {
+        MarkDownTag tag;
+        int next;
+    };
+
+    void PushItalicTag(int token);
+    void PushBoldTag(int token);
+    void PushTag(int token, MarkDownTag tag);
+    struct RunFormat
+    {
+        int boldCount;
+        int italicCount;
+        const std::string* linkTarget;
+        int linkIndex;
+        int linkCount;
+    };
+
+    void GenerateChildrenHtmlString(int firstToken, std::string& html) const;
+    void AppendText(const MarkDownToken& token, size_t offset, size_t length, std::string& html) const;
+    void AppendTags(const MarkDownToken& token, std::string& html) const;
+    void GenerateRuns(int firstToken, RunFormat& format, MarkDownBlock& block) const;
+    void GenerateRuns(const MarkDownToken& token, RunFormat& format, MarkDownBlock& block) const;
+    void AppendRunText(const MarkDownToken& token, size_t offset, size_t length, const RunFormat& format, MarkDownBlock& block) const;
+    void AppendRunTags(const MarkDownToken& token, RunFormat& format) const;
+    void AppendPlainText(int firstToken, std::string& text) const;
+    unsigned int GetListNumber(const MarkDownToken& token) const;
+
+    const char* m_markdown;
+    std::vector<MarkDownToken> m_tokens;
+    std::vector<Tag> m_tags;
+    std::string m_capturedText;
 };
 
 AdaptiveSharedNamespaceEnd
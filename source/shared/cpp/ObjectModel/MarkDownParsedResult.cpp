@@ -3,6 +3,15 @@
 
 using namespace AdaptiveSharedNamespace;
 
+MarkDownParsedResult::MarkDownParsedResult(MarkDownHtmlGenerator& generator) :
+    m_generator(generator),
+    m_firstToken(-1),
+    m_lastToken(-1),
+    m_firstEmphasis(-1),
+    m_lastEmphasis(-1)
+{
+}
+
 void MarkDownParsedResult::Translate()
 {
     MatchLeftAndRightEmphasises();
@@ -11,240 +20,279 @@ void MarkDownParsedResult::Translate()
 // appends html block tags at head and tail of the list
 void MarkDownParsedResult::AddBlockTags()
 {
+    if (m_firstToken < 0)
+    {
+        return;
+    }
+
     // Parsing is done, let code gen token know who is the head of the list
-    m_codeGenTokens.front()->MakeItHead();
+    m_generator.GetToken(m_firstToken).isHead = true;
 
     // Parsing is done, let code gen token know who is the tail of the list
-    m_codeGenTokens.back()->MakeItTail();
+    m_generator.GetToken(m_lastToken).isTail = true;
 }
 
-void MarkDownParsedResult::MarkTags(const std::shared_ptr<MarkDownHtmlGenerator> &x)
-{ 
-    if (m_codeGenTokens.back()->GetBlockType() != x->GetBlockType())
+void MarkDownParsedResult::MarkTags(int token)
+{
+    if (m_generator.GetToken(m_lastToken).GetBlockType() != m_generator.GetToken(token).GetBlockType())
     {
-        if (m_codeGenTokens.back()->IsNewLine())
+        if (m_generator.GetToken(m_lastToken).kind == MarkDownTokenKind::NewLine)
         {
-            m_codeGenTokens.pop_back();
+            PopBack();
         }
 
-        if (!m_codeGenTokens.empty())
+        if (m_lastToken >= 0)
         {
-            m_codeGenTokens.back()->MakeItTail();
+            m_generator.GetToken(m_lastToken).isTail = true;
         }
-        x->MakeItHead();
+        m_generator.GetToken(token).isHead = true;
     }
 }
+
 // append caller's parsed result to callee's parsed result
-void MarkDownParsedResult::AppendParseResult(MarkDownParsedResult &x)
+void MarkDownParsedResult::AppendParseResult(MarkDownParsedResult& x)
 {
-    if (!m_codeGenTokens.empty() && !x.m_codeGenTokens.empty())
+    if (x.m_firstToken >= 0)
     {
-        // check if two different block types, then add closing tag followed by the opening tag of new type
-        MarkTags(x.m_codeGenTokens.front());
+        if (m_firstToken >= 0)
+        {
+            // check if two different block types, then add closing tag followed by the opening tag of new type
+            MarkTags(x.m_firstToken);
+        }
+
+        if (m_lastToken >= 0)
+        {
+            m_generator.GetToken(m_lastToken).next = x.m_firstToken;
+            m_generator.GetToken(x.m_firstToken).previous = m_lastToken;
+        }
+        else
+        {
+            m_firstToken = x.m_firstToken;
+        }
+        m_lastToken = x.m_lastToken;
+    }
+
+    if (x.m_firstEmphasis >= 0)
+    {
+        if (m_lastEmphasis >= 0)
+        {
+            m_generator.GetToken(m_lastEmphasis).nextEmphasis = x.m_firstEmphasis;
+        }
+        else
+        {
+            m_firstEmphasis = x.m_firstEmphasis;
+        }
+        m_lastEmphasis = x.m_lastEmphasis;
     }
-    m_codeGenTokens.splice(m_codeGenTokens.end(), x.m_codeGenTokens);
-    m_emphasisLookUpTable.splice(m_emphasisLookUpTable.end(), x.m_emphasisLookUpTable);
+
+    x.Clear();
 }
 
-// append MarkDownHtmlGenerator object to callee's prased result
-void MarkDownParsedResult::AppendToTokens(const std::shared_ptr<MarkDownHtmlGenerator> &x) 
+// append token to callee's parsed result
+void MarkDownParsedResult::AppendToTokens(int token)
 {
-    if (!m_codeGenTokens.empty()) 
+    if (m_lastToken >= 0)
     {
         // check if two different block types, then add closing tag followed by the opening tag of new type
-        MarkTags(x);
+        MarkTags(token);
+    }
+
+    if (m_lastToken >= 0)
+    {
+        m_generator.GetToken(m_lastToken).next = token;
+        m_generator.GetToken(token).previous = m_lastToken;
     }
-    m_codeGenTokens.push_back(x);
+    else
+    {
+        m_firstToken = token;
+    }
+    m_lastToken = token;
 }
 
-void MarkDownParsedResult::AppendToLookUpTable(const std::shared_ptr<MarkDownEmphasisHtmlGenerator> &x) 
+void MarkDownParsedResult::AppendToLookUpTable(int token)
 {
-    m_emphasisLookUpTable.push_back(x);
+    if (m_lastEmphasis >= 0)
+    {
+        m_generator.GetToken(m_lastEmphasis).nextEmphasis = token;
+    }
+    else
+    {
+        m_firstEmphasis = token;
+    }
+    m_lastEmphasis = token;
 }
 
 void MarkDownParsedResult::PopFront()
-{ 
-    m_codeGenTokens.pop_front();
+{
+    m_firstToken = m_generator.GetToken(m_firstToken).next;
+    if (m_firstToken >= 0)
+    {
+        m_generator.GetToken(m_firstToken).previous = -1;
+    }
+    else
+    {
+        m_lastToken = -1;
+    }
 }
 
 void MarkDownParsedResult::PopBack()
 {
-    m_codeGenTokens.pop_back();
+    m_lastToken = m_generator.GetToken(m_lastToken).previous;
+    if (m_lastToken >= 0)
+    {
+        m_generator.GetToken(m_lastToken).next = -1;
+    }
+    else
+    {
+        m_firstToken = -1;
+    }
 }
 
 void MarkDownParsedResult::Clear()
 {
-    m_codeGenTokens.clear();
-    m_emphasisLookUpTable.clear();
+    m_firstToken = m_lastToken = -1;
+    m_firstEmphasis = m_lastEmphasis = -1;
 }
 
-// create and add new MarkDownStringHtmlGenerator object that has string of ch
-void MarkDownParsedResult::AddNewTokenToParsedResult(char ch)
+// create and add new text token for length chars of the markdown from offset
+void MarkDownParsedResult::AddNewTokenToParsedResult(size_t offset, size_t length)
 {
-    std::string string_token = std::string(1, ch);
-    std::shared_ptr<MarkDownStringHtmlGenerator> htmlToken =
-        std::make_shared<MarkDownStringHtmlGenerator>(string_token);
-    AppendToTokens(htmlToken);
+    AppendToTokens(m_generator.AddToken(MarkDownTokenKind::Text, offset, length));
 }
 
-// create and add new MarkDownStringHtmlGenerator object that has string word
-void MarkDownParsedResult::AddNewTokenToParsedResult(std::string &word)
+// create and add new new line token for the char of the markdown at offset
+void MarkDownParsedResult::AddNewLineTokenToParsedResult(size_t offset)
 {
-    std::shared_ptr<MarkDownStringHtmlGenerator> htmlToken =
-        std::make_shared<MarkDownStringHtmlGenerator>(word);
-    AppendToTokens(htmlToken);
+    AppendToTokens(m_generator.AddToken(MarkDownTokenKind::NewLine, offset, 1));
 }
 
-// create and add new MarkDownSpaceHtmlGenerator object that has string of ch
-void MarkDownParsedResult::AddNewLineTokenToParsedResult(char ch)
+void MarkDownParsedResult::GenerateHtmlString(std::string& html) const
 {
-    std::string string_token = std::string(1, ch);
-    std::shared_ptr<MarkDownHtmlGenerator> htmlToken =
-        std::make_shared<MarkDownNewLineHtmlGenerator>(string_token);
-    AppendToTokens(htmlToken);
-}
-
-std::string MarkDownParsedResult::GenerateHtmlString() 
-{ 
-    // process tags 
-    std::ostringstream html; 
-
-    for (auto itr = m_codeGenTokens.begin(); itr != m_codeGenTokens.end(); itr++) 
-    { 
-        html << (*itr)->GenerateHtmlString();
+    for (int token = m_firstToken; token >= 0; token = m_generator.GetToken(token).next)
+    {
+        m_generator.GenerateHtmlString(token, html);
     }
+}
 
-    return html.str();
+void MarkDownParsedResult::GenerateBlocks(std::vector<MarkDownBlock>& blocks) const
+{
+    m_generator.GenerateBlocks(m_firstToken, blocks);
 }
 
 // Following the rules speicified in CommonMark (http://spec.commonmark.org/0.27/)
 // It generally supports more stricker version of the rules
 // push left delims to stack, until matching right delim is found,
 // update emphasis counts and type to build string after search is complete
-
-// detects valid emphasis delimiters, when valid delimiters are found, they are added into
-// a new space. each new delimiters that are part of the run is appended, in that way,
-// it builds tokens of vectors
-// each time emphasis tokens are found, they are also added into a lookup table.
-// the look up table stores index of the corresponding token in the token vectors, and
-// emphasis count and its types that are used in html generation 
-// add comments -> what it does: generating  n supported features + 1 tokens --> capture them in token class
+// As in the "process emphasis" procedure of CommonMark, the depth of the stack below which a search
+// found no match is kept for each kind of right delim, so that the stack is not searched again
+// below it, and matching takes time linear in the number of delims
 void MarkDownParsedResult::MatchLeftAndRightEmphasises()
 {
-    std::vector<std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>>::iterator> leftEmphasisToExplore;
-    auto currentEmphasis = m_emphasisLookUpTable.begin();
+    std::vector<int> leftEmphasisToExplore;
 
-    while (!(currentEmphasis == m_emphasisLookUpTable.end()))
+    // Whether a left delim matches a right delim depends on the right delim only through its type,
+    // whether it is both left and right, and its number of unused delims modulo 3 (rule #9 & #10).
+    // Left delims below the bottom of a kind of right delim are known not to match it; they do not
+    // change while they are below the top of the stack, as a match pops every left delim above it.
+    size_t openersBottom[2][2][3] = {};
+    int currentEmphasis = m_firstEmphasis;
+
+    while (currentEmphasis >= 0)
     {
+        MarkDownToken& current = m_generator.GetToken(currentEmphasis);
+
         // keep exploring left until right token is found
-        if ((*currentEmphasis)->IsLeftEmphasis() || 
-            ((*currentEmphasis)->IsLeftAndRightEmphasis() && leftEmphasisToExplore.empty()))
+        if (current.IsLeftEmphasis() ||
+            (current.IsLeftAndRightEmphasis() && leftEmphasisToExplore.empty()))
         {
-            if ((*currentEmphasis)->IsLeftAndRightEmphasis() && (*currentEmphasis)->IsRightEmphasis())
+            if (current.IsLeftAndRightEmphasis() && current.IsRightEmphasis())
             {
                 // Reverse Direction Type; right empahsis to left emphasis
-                (*currentEmphasis)->ReverseDirectionType();
+                current.ReverseDirectionType();
             }
 
             leftEmphasisToExplore.push_back(currentEmphasis);
-            ++currentEmphasis;
+            currentEmphasis = current.nextEmphasis;
         }
         else if (!leftEmphasisToExplore.empty())
         {
-            auto currentLeftEmphasis = leftEmphasisToExplore.back();
             // because of rule #9 & #10 and multiple of 3 rule, left delim can jump ahead of right delim,
             // so need to check this condition.
 
-            // check if matches are found
-            //     mataches are found with left and right emphasis tokens if
+            // matches are found with left and right emphasis tokens if
             //     1. they are same types
-            //     2. neigher of the emphasis tokens are both left and right emphasis tokens, and 
-            //        if either or both of them are, then their sum is not multipe of 3 
-            //        
-            //     if matches are not found
-            //     1. search left emphasis tokens first for match because of rule 14 matches on the left side is preferred 
-            //        if match is found set left emphasis as the new left emphasis token and proceed to token processing
-            //        any non-matching left emphasis will be poped, in this way it always move forward
-            //        if still no match is found, 
-            //     2. search right
-            //        if the right emphasis can be left empahs search matching right emphasis tokens using the right emphasis
-            //        as left emphasis
-            //        else
-            //        use current left emphasis to search, and pop current right emphasis
-            if (!(*currentLeftEmphasis)->IsMatch(*currentEmphasis))
+            //     2. neigher of the emphasis tokens are both left and right emphasis tokens, and
+            //        if either or both of them are, then their sum is not multipe of 3
+            // because of rule 14 matches on the left side is preferred, so the left emphasis tokens
+            // are searched from the top of the stack, down to the bottom for this kind of right emphasis
+            size_t& bottom = openersBottom[current.delimiterType == Asterisk][current.IsLeftAndRightEmphasis()]
+                                          [current.numberOfUnusedDelimiters % 3];
+            size_t matchingLeft = leftEmphasisToExplore.size();
+            for (size_t i = leftEmphasisToExplore.size(); i > bottom; --i)
             {
-                std::vector<std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>>::iterator> store;
-                bool isFound = false;
-                // search first if matching left emphasis can be found with the right delim
-                // if match found, set the new left emphasis token as current token, and
-                // process tokens and as of the result, any left emphasis tokens that were searched and not matching 
-                // will be no longer considerred in tag processing
-                // pop until matching delim is found
-                while (!leftEmphasisToExplore.empty() && !isFound)
+                if (m_generator.IsMatch(leftEmphasisToExplore[i - 1], currentEmphasis))
                 {
-                    auto leftToken = leftEmphasisToExplore.back();
-                    if ((*leftToken)->IsMatch(*currentEmphasis))
-                    {
-                        currentLeftEmphasis = leftToken;
-                        isFound = true;
-                    }
-                    else
-                    {
-                        leftEmphasisToExplore.pop_back();
-                        store.push_back(leftToken);
-                    }
+                    matchingLeft = i - 1;
+                    break;
                 }
+            }
+
+            // if no match is found and the right emphasis is both left and right, and of the same type
+            // as the top left emphasis, use it as left emphasis and start searching from there.
+            // any other right emphasis is passed over
+            if (matchingLeft == leftEmphasisToExplore.size())
+            {
+                bottom = leftEmphasisToExplore.size();
 
-                // if no match found from the left and the right emphasis is both left and right, 
-                // and the sum of their emphasises counts is divisible by 3,
-                // use current right emphasis as 
-                // left emphasis, make the right emphasis, as current left
-                // emphasis and start searching from there.
-                // during the search if no match found, 
-                // this emphasis tokens will be dropped
-                if (!isFound)
+                if (m_generator.IsSameType(leftEmphasisToExplore.back(), currentEmphasis) &&
+                    current.IsLeftAndRightEmphasis())
                 {
-                    // restore state
-                    while (!isFound && !store.empty())
-                    {
-                        leftEmphasisToExplore.push_back(store.back());
-                        store.pop_back();
-                    }
+                    //right emphasis becomes left emphasis
+                    current.ReverseDirectionType();
+                }
+                else
+                {
+                    // move to next token for right delim tokens
+                    currentEmphasis = current.nextEmphasis;
+                }
+                continue;
+            }
 
-                    // check for the reason why we had to backtrack
-                    if ((*leftEmphasisToExplore.back())->IsSameType(*currentEmphasis))
-                    {
-                        //right emphasis becomes left emphasis
-                        /// create new left empahsis html generator from right
-                        (*currentEmphasis)->ReverseDirectionType();
-                    }
-                    else
+            // any left emphasis tokens above the match will be no longer considerred in tag processing
+            leftEmphasisToExplore.resize(matchingLeft + 1);
+            const int currentLeftEmphasis = leftEmphasisToExplore.back();
+
+            // check which one has leftover delims
+            m_generator.GenerateTags(currentLeftEmphasis, currentEmphasis);
+
+            // the matched left emphasis has fewer unused delims now, and may be popped, so no search
+            // may skip it
+            for (auto& typeBottoms : openersBottom)
+            {
+                for (auto& kindBottoms : typeBottoms)
+                {
+                    for (auto& countBottom : kindBottoms)
                     {
-                        // move to next token for right delim tokens
-                        currentEmphasis++;
+                        countBottom = std::min(countBottom, matchingLeft);
                     }
-                    // no maching found begin from the start
-                    continue;
                 }
             }
-            // check which one has leftover delims
-            (*currentLeftEmphasis)->GenerateTags(*currentEmphasis);
 
             // all right delims used, move to next
-            if ((*currentEmphasis)->IsDone())
+            if (m_generator.GetToken(currentEmphasis).IsDone())
             {
-                currentEmphasis++;
+                currentEmphasis = m_generator.GetToken(currentEmphasis).nextEmphasis;
             }
 
             // all left or right delims used, pop
-            if ((*currentLeftEmphasis)->IsDone())
-            { 
+            if (m_generator.GetToken(currentLeftEmphasis).IsDone())
+            {
                 leftEmphasisToExplore.pop_back();
             }
         }
         else
-        { 
-            currentEmphasis++;
+        {
+            currentEmphasis = current.nextEmphasis;
         }
     }
 }
@@ -1,42 +1,50 @@
 #pragma once
 
-#include "BaseCardElement.h"
+#include "pch.h"
 #include "MarkDownHtmlGenerator.h"
-#include <list>
 
 AdaptiveSharedNamespaceStart
-    // Holds Parsing Result of MarkDown String
-    class MarkDownParsedResult
-    {
-        public:
-        // Translate Intermediate Parsing Result to a form that can be
-        // written to html string
-        void Translate();
-        void AddBlockTags();
-        // Write to html string
-        std::string GenerateHtmlString(); 
-        // Append contents of the given parsing result object
-        void AppendParseResult(MarkDownParsedResult &);
-        // Append html code gen object to parse result
-        void AppendToTokens(const std::shared_ptr<MarkDownHtmlGenerator> &); 
-        // Append emphasis html code gen object to parse result
-        void AppendToLookUpTable(const std::shared_ptr<MarkDownEmphasisHtmlGenerator> &); 
-        // Take a char and convert it html code gen and append it to the result
-        // It is used to store MarkDown keywords such as '[', ']', '(', ')'
-        void AddNewTokenToParsedResult(char ch);
-        // Take string and convert it html code gen and append it to the result
-        void AddNewTokenToParsedResult(std::string &word);
-        // Take a new line char and convert it html code gen and append it to the result
-        // It is used to store MarkDown keywords such as '\r', '\n'
-        void AddNewLineTokenToParsedResult(char ch);
-        void PopFront();
-        void PopBack();
-        void Clear();
-        private:
-        void MarkTags(const std::shared_ptr<MarkDownHtmlGenerator> &);
-        std::list<std::shared_ptr<MarkDownHtmlGenerator>> m_codeGenTokens;
-        std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>> m_emphasisLookUpTable;
-        // take m_emphasisLookUpTable and matches left and right emphasises
-        void MatchLeftAndRightEmphasises();
-    };
+// Holds Parsing Result of MarkDown String: a list of tokens, and a look up table of the emphasis
+// tokens among them, both linked through the tokens of the generator
+class MarkDownParsedResult
+{
+public:
+    explicit MarkDownParsedResult(MarkDownHtmlGenerator& generator);
+
+    // Translate Intermediate Parsing Result to a form that can be
+    // written to html string
+    void Translate();
+    void AddBlockTags();
+    // Write to html string
+    void GenerateHtmlString(std::string& html) const;
+    // Write the blocks of runs the html string describes
+    void GenerateBlocks(std::vector<MarkDownBlock>& blocks) const;
+    // Append contents of the given parsing result object
+    void AppendParseResult(MarkDownParsedResult&);
+    // Append token to parse result
+    void AppendToTokens(int token);
+    // Append emphasis token to parse result
+    void AppendToLookUpTable(int token);
+    // Take chars of the markdown and convert them to a token, and append it to the result
+    // It is used to store MarkDown keywords such as '[', ']', '(', ')'
+    void AddNewTokenToParsedResult(size_t offset, size_t length);
+    // Take a new line char of the markdown and convert it to a token, and append it to the result
+    // It is used to store MarkDown keywords such as '\r', '\n'
+    void AddNewLineTokenToParsedResult(size_t offset);
+    void PopFront();
+    void PopBack();
+    void Clear();
+    int GetFirstToken() const { return m_firstToken; }
+
+private:
+    void MarkTags(int token);
+    // take the look up table and matches left and right emphasises
+    void MatchLeftAndRightEmphasises();
+
+    MarkDownHtmlGenerator& m_generator;
+    int m_firstToken;
+    int m_lastToken;
+    int m_firstEmphasis;
+    int m_lastEmphasis;
+};
 AdaptiveSharedNamespaceEnd
@@ -17,56 +17,86 @@ std::string MarkDownParser::TransformToHtml()
     {
         return "<p></p>";
     }
-    // begin parsing html blocks
-    ParseBlock();
-
-    // process further what is parsed before outputting 
-    // html string
-    m_parsedResult.Translate();
 
-    //add block tags such as <p> <ul>
-    m_parsedResult.AddBlockTags();
+    std::string html;
+    const TextScanResult scan = TextScanner::Scan(m_text);
+    if (!scan.HasMarkDown())
+    {
+        // text without markdown is a paragraph of the escaped text
+        html.reserve(scan.escapedLength + 7);
+        html += "<p>";
+        TextScanner::AppendEscapedText(m_text, html);
+        html += "</p>";
+        return html;
+    }
 
-    return m_parsedResult.GenerateHtmlString();
+    Parse(scan, [&scan, &html](const MarkDownParsedResult& parsedResult)
+    {
+        html.reserve(scan.escapedLength + 16);
+        parsedResult.GenerateHtmlString(html);
+    });
+    return html;
 }
 
-// MarkDown is consisted of Blocks, this methods parses blocks
-void MarkDownParser::ParseBlock()
+// transforms string to blocks of runs
+std::vector<MarkDownBlock> MarkDownParser::TransformToBlocks()
 {
-    std::stringstream stream(EscapeText());
-    EmphasisParser parser;
-    while (!stream.eof())
+    std::vector<MarkDownBlock> blocks;
+    if (m_text.empty())
+    {
+        return blocks;
+    }
+
+    const TextScanResult scan = TextScanner::Scan(m_text);
+    if (!scan.HasMarkDown())
     {
-        parser.ParseBlock(stream);
+        blocks.push_back({ MarkDownBlockType::ContainerBlock, 0, { { m_text, false, false, std::string(), -1 } } });
+        return blocks;
     }
-    m_parsedResult.AppendParseResult(parser.GetParsedResult());
+
+    Parse(scan, [&blocks](const MarkDownParsedResult& parsedResult)
+    {
+        parsedResult.GenerateBlocks(blocks);
+    });
+    return blocks;
 }
 
-std::string MarkDownParser::EscapeText()
+void MarkDownParser::Parse(const TextScanResult& scan, const std::function<void(const MarkDownParsedResult&)>& generate) const
 {
     std::string escaped;
+    const std::string& text = EscapeText(scan, escaped);
 
-    for (std::string::size_type i = 0; i < m_text.length(); i++)
+    // tokens refer to the text rather than copying it, and are generated in a single pass
+    MarkDownHtmlGenerator generator(text.data(), text.size());
+    MarkDownCursor cursor(text.data(), text.size());
+
+    // begin parsing html blocks
+    EmphasisParser parser(generator);
+    while (!cursor.IsAtEnd())
+    {
+        parser.ParseBlock(cursor);
+    }
+    MarkDownParsedResult& parsedResult = parser.GetParsedResult();
+
+    // process further what is parsed before outputting
+    // html string
+    parsedResult.Translate();
+
+    //add block tags such as <p> <ul>
+    parsedResult.AddBlockTags();
+
+    generate(parsedResult);
+}
+
+const std::string& MarkDownParser::EscapeText(const TextScanResult& scan, std::string& escaped) const
+{
+    // most text has nothing to escape
+    if (scan.escapedLength == m_text.length())
     {
-        switch (m_text[i])
-        {
-        case '<':
-            escaped += "&lt;";
-            break;
-        case '>':
-            escaped += "&gt;";
-            break;
-        case '"':
-            escaped += "&quot;";
-            break;
-        case '&':
-            escaped += "&amp;";
-            break;
-        default:
-            escaped += m_text[i];
-            break;
-        }
+        return m_text;
     }
 
+    escaped.reserve(scan.escapedLength);
+    TextScanner::AppendEscapedText(m_text, escaped);
     return escaped;
 }
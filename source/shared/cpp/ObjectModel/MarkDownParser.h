@@ -8,6 +8,7 @@
 #include "MarkDownParsedResult.h"
 #include "MarkDownBlockParser.h"
 #include "MarkDownHtmlGenerator.h"
+#include "TextScanner.h"
 
 AdaptiveSharedNamespaceStart
 class MarkDownParser
@@ -16,11 +17,14 @@ public:
     MarkDownParser(const std::string &txt); 
 
     std::string TransformToHtml();
+    // Returns the paragraphs and list items the html describes, without generating the html
+    std::vector<MarkDownBlock> TransformToBlocks();
 
 private:
-    void ParseBlock();
-    std::string EscapeText();
+    // Parses the text, and hands the parse result to generate
+    void Parse(const TextScanResult& scan, const std::function<void(const MarkDownParsedResult&)>& generate) const;
+    // Returns the text to parse: m_text itself, or its escaped copy in escaped
+    const std::string& EscapeText(const TextScanResult& scan, std::string& escaped) const;
     std::string m_text;
-    MarkDownParsedResult m_parsedResult;
 };
 AdaptiveSharedNamespaceEnd
@@ -9,7 +9,6 @@ NumberInput::NumberInput() :
     m_min(std::numeric_limits<int>::min()),
     m_max(std::numeric_limits<int>::max())
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value NumberInput::SerializeToJsonValue()
@@ -24,6 +23,23 @@ Json::Value NumberInput::SerializeToJsonValue()
     return root;
 }
 
+void NumberInput::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(NumberInput)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseInputElement::SerializeProperties(writer);
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::Max, GetMax());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Min, GetMin());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Placeholder, GetPlaceholder());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Value, GetValue());
+    writer.EndObject();
+}
+
 std::string NumberInput::GetPlaceholder() const
 {
     return m_placeholder;
@@ -89,10 +105,13 @@ std::shared_ptr<BaseCardElement> NumberInputParser::DeserializeFromString(
     return NumberInputParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void NumberInput::PopulateKnownPropertiesSet() 
+const KnownPropertySet& NumberInput::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min));
+    static const KnownPropertySet knownProperties(BaseInputElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Placeholder,
+        AdaptiveCardSchemaKey::Value,
+        AdaptiveCardSchemaKey::Max,
+        AdaptiveCardSchemaKey::Min
+    });
+    return knownProperties;
 }
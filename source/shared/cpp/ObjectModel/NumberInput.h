@@ -12,6 +12,7 @@ public:
     NumberInput();
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     std::string GetPlaceholder() const;
     void SetPlaceholder(const std::string value);
@@ -25,9 +26,10 @@ public:
     int GetMin() const;
     void SetMin(const int value);
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     std::string m_placeholder;
     int m_value;
     int m_max;
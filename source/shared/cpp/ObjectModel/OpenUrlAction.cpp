@@ -6,7 +6,6 @@ using namespace AdaptiveSharedNamespace;
 
 OpenUrlAction::OpenUrlAction() : BaseActionElement(ActionType::OpenUrl)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value OpenUrlAction::SerializeToJsonValue()
@@ -18,6 +17,20 @@ Json::Value OpenUrlAction::SerializeToJsonValue()
     return root;
 }
 
+void OpenUrlAction::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(OpenUrlAction)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseActionElement::SerializeProperties(writer);
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::Url, GetUrl());
+    writer.EndObject();
+}
+
 std::string OpenUrlAction::GetUrl() const
 {
     return m_url;
@@ -48,7 +61,10 @@ std::shared_ptr<BaseActionElement> OpenUrlActionParser::DeserializeFromString(
     return OpenUrlActionParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void OpenUrlAction::PopulateKnownPropertiesSet() 
+const KnownPropertySet& OpenUrlAction::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url));
+    static const KnownPropertySet knownProperties(BaseActionElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Url
+    });
+    return knownProperties;
 }
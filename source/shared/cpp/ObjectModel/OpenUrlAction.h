@@ -12,13 +12,15 @@ public:
     OpenUrlAction();
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     std::string GetUrl() const;
     void SetUrl(const std::string value);
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     std::string m_url;
 };
 
@@ -0,0 +1,193 @@
+#include "pch.h"
+#include "ParseCache.h"
+#include "SharedAdaptiveCard.h"
+#include <cstring>
+
+using namespace AdaptiveSharedNamespace;
+
+ParseCache::ParseCache(size_t capacityInBytes) :
+    m_capacityInBytes(capacityInBytes),
+    m_sizeInBytes(0),
+    m_hitCount(0),
+    m_missCount(0),
+    m_evictionCount(0)
+{
+}
+
+std::shared_ptr<ParseResult> ParseCache::DeserializeFromString(
+    const std::string& jsonString,
+    double rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration)
+{
+    if (elementParserRegistration == nullptr)
+    {
+        elementParserRegistration = ElementParserRegistration::GetDefault();
+    }
+    if (actionParserRegistration == nullptr)
+    {
+        actionParserRegistration = ActionParserRegistration::GetDefault();
+    }
+
+    const Key key = {
+        Hash(jsonString.data(), jsonString.size()),
+        rendererVersion,
+        elementParserRegistration.get(),
+        actionParserRegistration.get(),
+        elementParserRegistration->GetGeneration(),
+        actionParserRegistration->GetGeneration() };
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_index.find(key);
+        // The payload is compared as well so that a hash collision cannot return another card
+        if (found != m_index.end() && found->second->jsonString == jsonString)
+        {
+            m_entries.splice(m_entries.begin(), m_entries, found->second);
+            ++m_hitCount;
+            return found->second->parseResult;
+        }
+    }
+
+    ++m_missCount;
+
+    // Parse without holding the lock so that misses on different payloads do not wait on each other
+    auto parseResult = AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, elementParserRegistration, actionParserRegistration);
+
+    // The size of the object model is not tracked, so an entry is charged for its payload twice:
+    // once for the stored copy and once as an estimate of the parsed result
+    const size_t sizeInBytes = sizeof(Entry) + 2 * jsonString.size();
+    if (sizeInBytes > m_capacityInBytes)
+    {
+        return parseResult;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_index.find(key);
+    if (found != m_index.end())
+    {
+        // Another thread cached this key meanwhile, or the key collides with a different payload;
+        // either way the newest result replaces it
+        m_sizeInBytes -= found->second->sizeInBytes;
+        m_entries.erase(found->second);
+        m_index.erase(found);
+    }
+
+    m_entries.push_front({ key, jsonString, sizeInBytes, parseResult, elementParserRegistration, actionParserRegistration });
+    m_index[key] = m_entries.begin();
+    m_sizeInBytes += sizeInBytes;
+    EvictToCapacity();
+
+    return parseResult;
+}
+
+void ParseCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index.clear();
+    m_entries.clear();
+    m_sizeInBytes = 0;
+}
+
+size_t ParseCache::GetCapacityInBytes() const
+{
+    return m_capacityInBytes;
+}
+
+size_t ParseCache::GetSizeInBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sizeInBytes;
+}
+
+size_t ParseCache::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+unsigned long long ParseCache::GetHitCount() const
+{
+    return m_hitCount;
+}
+
+unsigned long long ParseCache::GetMissCount() const
+{
+    return m_missCount;
+}
+
+unsigned long long ParseCache::GetEvictionCount() const
+{
+    return m_evictionCount;
+}
+
+unsigned long long ParseCache::Hash(const char* data, size_t length)
+{
+    const unsigned long long m = 0xc6a4a7935bd1e995ULL;
+    const int r = 47;
+    unsigned long long h = 0x8445d61a4e774912ULL ^ (length * m);
+
+    const char* end = data + (length & ~static_cast<size_t>(7));
+    for (; data != end; data += 8)
+    {
+        unsigned long long k;
+        memcpy(&k, data, sizeof(k));
+
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+
+        h ^= k;
+        h *= m;
+    }
+
+    const unsigned char* tail = reinterpret_cast<const unsigned char*>(data);
+    // the last 1 to 7 bytes, the last of them highest, as the switch of MurmurHash64A takes them
+    const size_t tailLength = length & 7;
+    if (tailLength != 0)
+    {
+        for (size_t i = tailLength; i > 0; --i)
+        {
+            h ^= static_cast<unsigned long long>(tail[i - 1]) << (8 * (i - 1));
+        }
+        h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
+
+void ParseCache::EvictToCapacity()
+{
+    while (m_sizeInBytes > m_capacityInBytes && !m_entries.empty())
+    {
+        const Entry& leastRecentlyUsed = m_entries.back();
+        m_sizeInBytes -= leastRecentlyUsed.sizeInBytes;
+        m_index.erase(leastRecentlyUsed.key);
+        m_entries.pop_back();
+        ++m_evictionCount;
+    }
+}
+
+bool ParseCache::Key::operator==(const Key& other) const
+{
+    return payloadHash == other.payloadHash &&
+        rendererVersion == other.rendererVersion &&
+        elementParserRegistration == other.elementParserRegistration &&
+        actionParserRegistration == other.actionParserRegistration &&
+        elementParserGeneration == other.elementParserGeneration &&
+        actionParserGeneration == other.actionParserGeneration;
+}
+
+size_t ParseCache::KeyHash::operator()(const Key& key) const
+{
+    size_t hash = static_cast<size_t>(key.payloadHash);
+    hash ^= std::hash<double>()(key.rendererVersion) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<const void*>()(key.elementParserRegistration) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<const void*>()(key.actionParserRegistration) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= static_cast<size_t>(key.elementParserGeneration) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= static_cast<size_t>(key.actionParserGeneration) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "pch.h"
+#include "ParseResult.h"
+#include "ElementParserRegistration.h"
+#include "ActionParserRegistration.h"
+#include <atomic>
+#include <list>
+#include <mutex>
+
+AdaptiveSharedNamespaceStart
+
+// Cache of parse results keyed by the content of the card JSON. Identical payloads parsed for the
+// same renderer version with the same parser registrations share one ParseResult, which callers
+// must treat as read-only. A registration is keyed by its identity and its generation, so adding or
+// removing a parser or changing a setting on it makes the results cached for it stale; they are
+// never returned again and age out of the cache. Parsers themselves must not change how they parse
+// once registered. The cache keeps the most recently used results within a byte budget and may be
+// used from several threads at once, though not while its registrations are being changed.
+class ParseCache
+{
+public:
+    explicit ParseCache(size_t capacityInBytes);
+    ParseCache(const ParseCache&) = delete;
+    ParseCache& operator=(const ParseCache&) = delete;
+
+    // Returns the cached result for the payload, or deserializes and caches it. Payloads that fail
+    // to parse are not cached; the exception is passed on to the caller.
+    std::shared_ptr<ParseResult> DeserializeFromString(
+        const std::string& jsonString,
+        double rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr);
+
+    void Clear();
+
+    size_t GetCapacityInBytes() const;
+    size_t GetSizeInBytes() const;
+    size_t GetEntryCount() const;
+
+    unsigned long long GetHitCount() const;
+    unsigned long long GetMissCount() const;
+    unsigned long long GetEvictionCount() const;
+
+    // 64-bit non-cryptographic hash of the payload (MurmurHash64A)
+    static unsigned long long Hash(const char* data, size_t length);
+
+private:
+    struct Key
+    {
+        unsigned long long payloadHash;
+        double rendererVersion;
+        const ElementParserRegistration* elementParserRegistration;
+        const ActionParserRegistration* actionParserRegistration;
+        unsigned long long elementParserGeneration;
+        unsigned long long actionParserGeneration;
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry
+    {
+        Key key;
+        std::string jsonString;
+        size_t sizeInBytes;
+        std::shared_ptr<ParseResult> parseResult;
+
+        // Held so that a registration's address cannot be reused by another one while cached
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration;
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration;
+    };
+
+    void EvictToCapacity();
+
+    const size_t m_capacityInBytes;
+    size_t m_sizeInBytes;
+
+    // Most recently used entry first
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_index;
+    mutable std::mutex m_mutex;
+
+    std::atomic<unsigned long long> m_hitCount;
+    std::atomic<unsigned long long> m_missCount;
+    std::atomic<unsigned long long> m_evictionCount;
+};
+
+AdaptiveSharedNamespaceEnd
@@ -0,0 +1,21 @@
+#include "pch.h"
+#include "ParseLimits.h"
+
+using namespace AdaptiveSharedNamespace;
+
+ParseLimits::ParseLimits() :
+    maxPayloadLength(std::numeric_limits<size_t>::max()),
+    maxDepth(std::numeric_limits<unsigned int>::max()),
+    maxElementCount(std::numeric_limits<unsigned int>::max()),
+    maxStringLength(std::numeric_limits<size_t>::max()),
+    maxChoiceCount(std::numeric_limits<unsigned int>::max()),
+    maxShowCardDepth(std::numeric_limits<unsigned int>::max())
+{
+}
+
+ParseStatistics::ParseStatistics() :
+    elementCount(0),
+    maxDepth(0),
+    maxShowCardDepth(0)
+{
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "pch.h"
+
+AdaptiveSharedNamespaceStart
+
+// Bounds on the work a single non-throwing deserialization may do, for hosts that parse cards
+// from untrusted sources. Limits are checked as parsing proceeds, so a payload that exceeds one
+// stops there with ErrorStatusCode::ParseLimitExceeded instead of being parsed in full. The
+// defaults impose no limits.
+struct ParseLimits
+{
+    ParseLimits();
+
+    // Length of the JSON text in bytes, checked before it is parsed
+    size_t maxPayloadLength;
+
+    // Nesting of elements, actions and their sub-objects such as columns, facts and choices
+    unsigned int maxDepth;
+
+    // Elements, actions and sub-objects in the whole card, counting those of nested cards
+    unsigned int maxElementCount;
+
+    // Length of any single string property in bytes
+    size_t maxStringLength;
+
+    // Choices of a single Input.ChoiceSet
+    unsigned int maxChoiceCount;
+
+    // Action.ShowCard cards nested within each other
+    unsigned int maxShowCardDepth;
+};
+
+// How much of a card a deserialization went through. For a card stopped by a ParseLimits limit,
+// this shows how far it got.
+struct ParseStatistics
+{
+    ParseStatistics();
+
+    unsigned int elementCount;
+    unsigned int maxDepth;
+    unsigned int maxShowCardDepth;
+};
+
+AdaptiveSharedNamespaceEnd
@@ -13,6 +13,16 @@ ParseResult::ParseResult(
 {
 }
 
+ParseResult::ParseResult(
+    std::shared_ptr<AdaptiveCard> adaptiveCard,
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings,
+    std::shared_ptr<AdaptiveCardParseError> error) :
+    m_adaptiveCard(adaptiveCard),
+    m_warnings(warnings),
+    m_error(error)
+{
+}
+
 std::shared_ptr<AdaptiveCard> ParseResult::GetAdaptiveCard()
 {
     return m_adaptiveCard;
@@ -22,3 +32,23 @@ std::vector<std::shared_ptr<AdaptiveCardParseWarning>> ParseResult::GetWarnings(
 {
     return m_warnings;
 }
+
+void ParseResult::AddWarning(std::shared_ptr<AdaptiveCardParseWarning> warning)
+{
+    m_warnings.push_back(warning);
+}
+
+std::shared_ptr<AdaptiveCardParseError> ParseResult::GetError()
+{
+    return m_error;
+}
+
+const ParseStatistics& ParseResult::GetStatistics() const
+{
+    return m_statistics;
+}
+
+void ParseResult::SetStatistics(const ParseStatistics& value)
+{
+    m_statistics = value;
+}
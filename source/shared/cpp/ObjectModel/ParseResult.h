@@ -2,6 +2,8 @@
 
 #include "pch.h"
 #include "AdaptiveCardParseWarning.h"
+#include "AdaptiveCardParseError.h"
+#include "ParseLimits.h"
 
 AdaptiveSharedNamespaceStart
     class AdaptiveCard;
@@ -12,12 +14,26 @@ AdaptiveSharedNamespaceStart
         ParseResult(
             std::shared_ptr<AdaptiveCard> adaptiveCard,
             std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings);
+        ParseResult(
+            std::shared_ptr<AdaptiveCard> adaptiveCard,
+            std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings,
+            std::shared_ptr<AdaptiveCardParseError> error);
 
         std::shared_ptr<AdaptiveCard> GetAdaptiveCard();
         std::vector<std::shared_ptr<AdaptiveCardParseWarning>> GetWarnings();
+        void AddWarning(std::shared_ptr<AdaptiveCardParseWarning> warning);
+
+        // Set, and the card null, when a non-throwing deserialization failed
+        std::shared_ptr<AdaptiveCardParseError> GetError();
+
+        // Filled in by the non-throwing deserialization
+        const ParseStatistics& GetStatistics() const;
+        void SetStatistics(const ParseStatistics& value);
 
     private:
         std::shared_ptr<AdaptiveCard> m_adaptiveCard;
         std::vector<std::shared_ptr<AdaptiveCardParseWarning>> m_warnings;
+        std::shared_ptr<AdaptiveCardParseError> m_error;
+        ParseStatistics m_statistics;
     };
 AdaptiveSharedNamespaceEnd
\ No newline at end of file
@@ -6,13 +6,27 @@
 #include "TextBlock.h"
 #include "Container.h"
 #include "ShowCardAction.h"
+#include <cstring>
 
 AdaptiveSharedNamespaceStart
 
+namespace
+{
+    thread_local ParseUtil::ErrorScope* s_currentErrorScope = nullptr;
+
+    const size_t NoPathNode = static_cast<size_t>(-1);
+
+    const ParseLimits& NoParseLimits()
+    {
+        static const ParseLimits noLimits;
+        return noLimits;
+    }
+}
+
 void ParseUtil::ThrowIfNotJsonObject(const Json::Value& json)
 {
     if (!json.isObject()) {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Expected JSON Object\n");
+        RaiseError(ErrorStatusCode::InvalidJson, "Expected JSON Object\n");
     }
 }
 
@@ -20,177 +34,197 @@ void ParseUtil::ExpectString(const Json::Value& json)
 {
     if (!json.isString())
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "The JSON element did not have the expected type 'string'");
+        RaiseError(ErrorStatusCode::InvalidPropertyValue, "The JSON element did not have the expected type 'string'");
     }
 }
 
 // TODO: Remove? This code path might not be desirable going forward depending on how we decide to support forward compat. Task 10893205
 std::string ParseUtil::GetTypeAsString(const Json::Value& json)
 {
-    std::string typeKey = "type";
-    if (!json.isMember(typeKey))
+    const char* typeKey = "type";
+    const Json::Value* typeValue = FindValue(json, typeKey);
+    if (typeValue == nullptr)
+    {
+        RaiseError(ErrorStatusCode::RequiredPropertyMissing, "The JSON element is missing the following value: " + std::string(typeKey));
+        return "";
+    }
+
+    if (typeValue->isArray() || typeValue->isObject())
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "The JSON element is missing the following value: " + typeKey);
+        RaiseError(ErrorStatusCode::InvalidPropertyValue, "The JSON element did not have the expected type 'string' for the following value: " + std::string(typeKey));
+        return "";
     }
 
-    return json.get(typeKey, Json::Value()).asString();
+    return typeValue->asString();
 }
 
 std::string ParseUtil::TryGetTypeAsString(const Json::Value& json)
 {
-    try
-    {
-        return GetTypeAsString(json);
-    }
-    catch (const AdaptiveCardParseException&)
+    const Json::Value* typeValue = FindValue(json, "type");
+    if (typeValue == nullptr || typeValue->isArray() || typeValue->isObject())
     {
         return "";
     }
 
+    return typeValue->asString();
 }
 
 std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
+    const Json::Value* propertyValue = FindValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         if (isRequired)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName);
-        }
-        else
-        {
-            return "";
+            RaiseError(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName, key);
         }
+        return "";
     }
 
-    if (!propertyValue.isString())
+    if (!propertyValue->isString())
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Value for property " + propertyName + " was invalid. Expected type string.");
+        RaiseError(ErrorStatusCode::InvalidPropertyValue, "Value for property " + propertyName + " was invalid. Expected type string.", key);
+        return "";
+    }
+
+    if (!IsWithinStringLimit(*propertyValue, key))
+    {
+        return "";
     }
 
-    return propertyValue.asString();
+    return propertyValue->asString();
 }
 
 std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
+    const Json::Value* propertyValue = FindValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         if (isRequired)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName);
-        }
-        else
-        {
-            return "";
+            RaiseError(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName, key);
         }
+        return "";
     }
 
-    return propertyValue.toStyledString();
+    std::string jsonString = propertyValue->toStyledString();
+    if (jsonString.size() > GetLimits().maxStringLength)
+    {
+        RaiseError(ErrorStatusCode::ParseLimitExceeded, "Value for property " + propertyName + " exceeds the maximum string length", key);
+        return "";
+    }
+
+    return jsonString;
 }
 
 std::string ParseUtil::GetValueAsString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
+    const Json::Value* propertyValue = FindValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         if (isRequired)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName);
-        }
-        else
-        {
-            return "";
+            RaiseError(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName, key);
         }
+        return "";
     }
 
-    return propertyValue.asString();
+    if (propertyValue->isArray() || propertyValue->isObject())
+    {
+        RaiseError(ErrorStatusCode::InvalidPropertyValue, "Value for property " + propertyName + " was invalid. Expected a value convertible to string.", key);
+        return "";
+    }
+
+    if (!IsWithinStringLimit(*propertyValue, key))
+    {
+        return "";
+    }
+
+    return propertyValue->asString();
 }
 
 bool ParseUtil::GetBool(const Json::Value& json, AdaptiveCardSchemaKey key, bool defaultValue, bool isRequired)
 {
-    std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
+    const Json::Value* propertyValue = FindValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         if (isRequired)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName);
-        }
-        else
-        {
-            return defaultValue;
+            RaiseError(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName, key);
         }
+        return defaultValue;
     }
 
-    if (!propertyValue.isBool())
+    if (!propertyValue->isBool())
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Value for property " + propertyName + " was invalid. Expected type bool.");
+        RaiseError(ErrorStatusCode::InvalidPropertyValue, "Value for property " + propertyName + " was invalid. Expected type bool.", key);
+        return defaultValue;
     }
 
-    return propertyValue.asBool();
+    return propertyValue->asBool();
 }
 
 unsigned int ParseUtil::GetUInt(const Json::Value & json, AdaptiveCardSchemaKey key, unsigned int defaultValue, bool isRequired)
 {
-    std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
+    const Json::Value* propertyValue = FindValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         if (isRequired)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName);
-        }
-        else
-        {
-            return defaultValue;
+            RaiseError(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName, key);
         }
+        return defaultValue;
     }
 
-    if (!propertyValue.isUInt())
+    if (!propertyValue->isUInt())
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Value for property " + propertyName + " was invalid. Expected type uInt.");
+        RaiseError(ErrorStatusCode::InvalidPropertyValue, "Value for property " + propertyName + " was invalid. Expected type uInt.", key);
+        return defaultValue;
     }
 
-    return propertyValue.asUInt();
+    return propertyValue->asUInt();
 }
 
 int ParseUtil::GetInt(const Json::Value & json, AdaptiveCardSchemaKey key, int defaultValue, bool isRequired)
 {
-    std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
+    const Json::Value* propertyValue = FindValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         if (isRequired)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName);
-        }
-        else
-        {
-            return defaultValue;
+            RaiseError(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName, key);
         }
+        return defaultValue;
     }
 
-    if (!propertyValue.isInt())
+    if (!propertyValue->isInt())
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Value for property " + propertyName + " was invalid. Expected type int.");
+        RaiseError(ErrorStatusCode::InvalidPropertyValue, "Value for property " + propertyName + " was invalid. Expected type int.", key);
+        return defaultValue;
     }
 
-    return propertyValue.asInt();
+    return propertyValue->asInt();
 }
 
 void ParseUtil::ExpectTypeString(const Json::Value& json, CardElementType bodyType)
 {
     std::string actualType = GetTypeAsString(json);
+    if (HasError())
+    {
+        return;
+    }
+
     std::string expectedTypeStr = CardElementTypeToString(bodyType);
     bool isTypeCorrect = expectedTypeStr.compare(actualType) == 0;
     if (!isTypeCorrect)
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "The JSON element did not have the correct type. Expected: " + expectedTypeStr + ", Actual: " + actualType);
+        RaiseError(ErrorStatusCode::InvalidPropertyValue, "The JSON element did not have the correct type. Expected: " + expectedTypeStr + ", Actual: " + actualType);
     }
 }
 
@@ -199,83 +233,58 @@ void ParseUtil::ExpectKeyAndValueType(const Json::Value& json, const char* expec
 {
     if (expectedKey == nullptr)
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "null expectedKey");
+        RaiseError(ErrorStatusCode::InvalidPropertyValue, "null expectedKey");
+        return;
     }
 
-    if (!json.isMember(expectedKey))
+    const Json::Value* value = FindValue(json, expectedKey);
+    if (value == nullptr)
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "The JSON element is missing the following key: " + std::string(expectedKey));
+        RaiseError(ErrorStatusCode::RequiredPropertyMissing, "The JSON element is missing the following key: " + std::string(expectedKey));
+        return;
     }
 
-    auto value = json.get(expectedKey, Json::Value());
-    throwIfWrongType(value);
+    throwIfWrongType(*value);
 }
 
 CardElementType ParseUtil::GetCardElementType(const Json::Value& json)
 {
-    std::string actualType = GetTypeAsString(json);
-    try
-    {
-        return CardElementTypeFromString(actualType);
-    }
-    catch (const std::out_of_range&)
-    {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Invalid CardElementType");
-    }
+    // Unrecognised names map to CardElementType::Unsupported
+    return CardElementTypeFromString(GetTypeAsString(json));
 }
 
 CardElementType ParseUtil::TryGetCardElementType(const Json::Value& json)
 {
-    try
-    {
-        return GetCardElementType(json);
-    }
-    catch (const AdaptiveCardParseException&)
-    {
-        return CardElementType::Unsupported;
-    }
+    return CardElementTypeFromString(TryGetTypeAsString(json));
 }
 
 ActionType ParseUtil::GetActionType(const Json::Value& json)
 {
-    std::string actualType = GetTypeAsString(json);
-    try
-    {
-        return ActionTypeFromString(actualType);
-    }
-    catch (const std::out_of_range&)
-    {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Invalid ActionType");
-    }
+    // Unrecognised names map to ActionType::Unsupported
+    return ActionTypeFromString(GetTypeAsString(json));
 }
 
 ActionType ParseUtil::TryGetActionType(const Json::Value& json)
 {
-    try
-    {
-        return GetActionType(json);
-    }
-    catch (const AdaptiveCardParseException&)
-    {
-        return ActionType::Unsupported;
-    }
+    return ActionTypeFromString(TryGetTypeAsString(json));
 }
 
-Json::Value ParseUtil::GetArray(
+const Json::Value& ParseUtil::GetArray(
     const Json::Value& json,
     AdaptiveCardSchemaKey key,
     bool isRequired)
 {
-    std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto elementArray = json.get(propertyName, Json::Value());
+    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
+    const Json::Value& elementArray = ExtractJsonValue(json, key);
     if (isRequired && elementArray.empty())
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "Could not parse required key: " + propertyName + ". It was not found");
+        RaiseError(ErrorStatusCode::RequiredPropertyMissing, "Could not parse required key: " + propertyName + ". It was not found", key);
     }
 
     if (!elementArray.empty() && !elementArray.isArray())
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Could not parse specified key: " + propertyName + ". It was not an array");
+        RaiseError(ErrorStatusCode::InvalidPropertyValue, "Could not parse specified key: " + propertyName + ". It was not an array", key);
+        return Json::Value::nullSingleton();
     }
     return elementArray;
 }
@@ -286,20 +295,46 @@ Json::Value ParseUtil::GetJsonValueFromString(const std::string jsonString)
     Json::Value jsonValue;
     if (!reader.parse(jsonString.c_str(), jsonValue))
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Expected JSON Object\n");
+        RaiseError(ErrorStatusCode::InvalidJson, "Expected JSON Object\n");
+        return Json::Value();
     }
     return jsonValue;
 }
 
-Json::Value ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+const Json::Value& ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+{
+    const Json::Value* propertyValue = FindValue(json, key);
+    if (propertyValue == nullptr)
+    {
+        propertyValue = &Json::Value::nullSingleton();
+    }
+
+    if (isRequired && propertyValue->empty())
+    {
+        RaiseError(ErrorStatusCode::RequiredPropertyMissing, "Could not extract required key: " + AdaptiveCardSchemaKeyToString(key) + ".", key);
+    }
+    return *propertyValue;
+}
+
+const Json::Value* ParseUtil::FindValue(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
-    std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (isRequired && propertyValue.empty())
+    if (!json.isObject())
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "Could not extract required key: " + propertyName + ".");
+        return nullptr;
     }
-    return propertyValue;
+
+    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
+    return json.find(propertyName.data(), propertyName.data() + propertyName.size());
+}
+
+const Json::Value* ParseUtil::FindValue(const Json::Value& json, const char* key)
+{
+    if (!json.isObject())
+    {
+        return nullptr;
+    }
+
+    return json.find(key, key + std::strlen(key));
 }
 
 std::string ParseUtil::ToLowercase(std::string value)
@@ -315,7 +350,7 @@ std::vector<std::shared_ptr<BaseCardElement>> ParseUtil::GetElementCollection(
     AdaptiveCardSchemaKey key,
     bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const Json::Value& elementArray = GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<BaseCardElement>> elements;
     if (elementArray.empty())
@@ -325,29 +360,86 @@ std::vector<std::shared_ptr<BaseCardElement>> ParseUtil::GetElementCollection(
 
     elements.reserve(elementArray.size());
 
-    for (const auto& curJsonValue : elementArray)
+    JsonPathSegment arraySegment(key);
+    for (Json::ArrayIndex i = 0; i < elementArray.size(); ++i)
     {
-        // Get the element's type
-        std::string typeString = GetTypeAsString(curJsonValue);
-
-        std::shared_ptr<BaseCardElementParser> parser = elementParserRegistration->GetParser(typeString);
-
-        //Parse it if it's allowed by the current parsers
-        if (parser != nullptr)
+        JsonPathSegment indexSegment(i);
+        auto element = GetElementFromJsonValue(elementParserRegistration, actionParserRegistration, elementArray[i]);
+        if (HasError())
         {
-            // Use the parser that maps to the type
-            elements.push_back(parser->Deserialize(elementParserRegistration, actionParserRegistration, curJsonValue));
-        }
-        else
-        {
-            parser = elementParserRegistration->GetParser("Unknown");
-            elements.push_back(parser->Deserialize(elementParserRegistration, actionParserRegistration, curJsonValue));
+            break;
         }
+        elements.push_back(element);
     }
 
     return elements;
 }
 
+void ParseUtil::GetElementCollection(
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration,
+    const Json::Value& json,
+    AdaptiveCardSchemaKey key,
+    bool isRequired,
+    std::shared_ptr<std::vector<std::shared_ptr<BaseCardElement>>> elements)
+{
+    const Json::Value& elementArray = GetArray(json, key, isRequired);
+    if (elementArray.empty())
+    {
+        return;
+    }
+
+    elements->reserve(elementArray.size());
+
+    JsonPathSegment arraySegment(key);
+    for (Json::ArrayIndex i = 0; i < elementArray.size(); ++i)
+    {
+        JsonPathSegment indexSegment(i);
+        const Json::Value& elementJson = elementArray[i];
+        Defer([=, &elementJson]()
+        {
+            auto element = GetElementFromJsonValue(elementParserRegistration, actionParserRegistration, elementJson);
+            if (!HasError())
+            {
+                elements->push_back(element);
+            }
+        });
+    }
+}
+
+std::shared_ptr<BaseCardElement> ParseUtil::GetElementFromJsonValue(
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration,
+    const Json::Value& json)
+{
+    NestingScope nestingScope;
+    if (HasError())
+    {
+        return nullptr;
+    }
+
+    // Get the element's type
+    std::string typeString = GetTypeAsString(json);
+    if (HasError())
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<BaseCardElementParser> parser = elementParserRegistration->GetParser(typeString);
+
+    //Parse it if it's allowed by the current parsers
+    if (parser == nullptr)
+    {
+        parser = elementParserRegistration->GetParser("Unknown");
+    }
+
+    // Custom parsers get back complete elements from whatever they parse themselves
+    CardTraversal::Isolation isolation(!ElementParserRegistration::IsKnownType(typeString));
+
+    // Use the parser that maps to the type
+    return parser->Deserialize(elementParserRegistration, actionParserRegistration, json);
+}
+
 std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(
     std::shared_ptr<ElementParserRegistration> elementParserRegistration,
     std::shared_ptr<ActionParserRegistration> actionParserRegistration,
@@ -355,17 +447,31 @@ std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(
 {
     if (json.empty() || !json.isObject())
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Expected a Json object to extract Action element");
+        RaiseError(ErrorStatusCode::InvalidPropertyValue, "Expected a Json object to extract Action element");
+        return nullptr;
+    }
+
+    NestingScope nestingScope;
+    if (HasError())
+    {
+        return nullptr;
     }
 
     // Get the element's type
     std::string typeString = GetTypeAsString(json);
+    if (HasError())
+    {
+        return nullptr;
+    }
 
     auto parser = actionParserRegistration->GetParser(typeString);
 
     //Parse it if it's allowed by the current parsers
     if (parser != nullptr)
     {
+        // Custom parsers get back complete elements from whatever they parse themselves
+        CardTraversal::Isolation isolation(!ActionParserRegistration::IsKnownType(typeString));
+
         // Use the parser that maps to the type
         return parser->Deserialize(elementParserRegistration, actionParserRegistration, json);
     }
@@ -380,7 +486,7 @@ std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
     AdaptiveCardSchemaKey key,
     bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const Json::Value& elementArray = GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<BaseActionElement>> elements;
 
@@ -391,9 +497,11 @@ std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
 
     elements.reserve(elementArray.size());
 
-    for (const auto& curJsonValue : elementArray)
+    JsonPathSegment arraySegment(key);
+    for (Json::ArrayIndex i = 0; i < elementArray.size() && !HasError(); ++i)
     {
-        auto action = ParseUtil::GetActionFromJsonValue(elementParserRegistration, actionParserRegistration, curJsonValue);
+        JsonPathSegment indexSegment(i);
+        auto action = ParseUtil::GetActionFromJsonValue(elementParserRegistration, actionParserRegistration, elementArray[i]);
         if (action != nullptr)
         {
             elements.push_back(action);
@@ -403,6 +511,38 @@ std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
     return elements;
 }
 
+void ParseUtil::GetActionCollection(
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration,
+    const Json::Value& json,
+    AdaptiveCardSchemaKey key,
+    bool isRequired,
+    std::shared_ptr<std::vector<std::shared_ptr<BaseActionElement>>> actions)
+{
+    const Json::Value& actionArray = GetArray(json, key, isRequired);
+    if (actionArray.empty())
+    {
+        return;
+    }
+
+    actions->reserve(actionArray.size());
+
+    JsonPathSegment arraySegment(key);
+    for (Json::ArrayIndex i = 0; i < actionArray.size(); ++i)
+    {
+        JsonPathSegment indexSegment(i);
+        const Json::Value& actionJson = actionArray[i];
+        Defer([=, &actionJson]()
+        {
+            auto action = GetActionFromJsonValue(elementParserRegistration, actionParserRegistration, actionJson);
+            if (action != nullptr)
+            {
+                actions->push_back(action);
+            }
+        });
+    }
+}
+
 std::shared_ptr<BaseActionElement> ParseUtil::GetSelectAction(
     std::shared_ptr<ElementParserRegistration> elementParserRegistration,
     std::shared_ptr<ActionParserRegistration> actionParserRegistration,
@@ -410,16 +550,275 @@ std::shared_ptr<BaseActionElement> ParseUtil::GetSelectAction(
     AdaptiveCardSchemaKey key,
     bool isRequired)
 {
-    auto selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
+    const Json::Value& selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
 
     if (!selectAction.empty())
     {
+        JsonPathSegment selectActionSegment(key);
         return ParseUtil::GetActionFromJsonValue(elementParserRegistration, actionParserRegistration, selectAction);
     }
 
     return nullptr;
 }
 
+ParseUtil::DeferredContext::DeferredContext() :
+    m_scope(s_currentErrorScope),
+    m_context(m_scope != nullptr ? m_scope->SaveContext() : ErrorScope::Context())
+{
+}
+
+ParseUtil::DeferredContext::Resumption::Resumption(const DeferredContext& context) :
+    m_outerScope(s_currentErrorScope),
+    m_scope(context.m_scope),
+    m_outerContext()
+{
+    s_currentErrorScope = m_scope;
+    if (m_scope != nullptr)
+    {
+        m_outerContext = m_scope->Resume(context.m_context);
+    }
+}
+
+ParseUtil::DeferredContext::Resumption::~Resumption()
+{
+    if (m_scope != nullptr)
+    {
+        m_scope->Restore(m_outerContext);
+    }
+    s_currentErrorScope = m_outerScope;
+}
+
+void ParseUtil::RaiseError(ErrorStatusCode statusCode, const std::string& message)
+{
+    if (s_currentErrorScope == nullptr)
+    {
+        throw AdaptiveCardParseException(statusCode, message);
+    }
+
+    if (s_currentErrorScope->m_error == nullptr)
+    {
+        s_currentErrorScope->m_error = std::make_shared<AdaptiveCardParseError>(statusCode, message, s_currentErrorScope->FormatPath(nullptr));
+    }
+}
+
+void ParseUtil::RaiseError(ErrorStatusCode statusCode, const std::string& message, AdaptiveCardSchemaKey key)
+{
+    if (s_currentErrorScope == nullptr)
+    {
+        throw AdaptiveCardParseException(statusCode, message);
+    }
+
+    if (s_currentErrorScope->m_error == nullptr)
+    {
+        s_currentErrorScope->m_error = std::make_shared<AdaptiveCardParseError>(statusCode, message, s_currentErrorScope->FormatPath(&AdaptiveCardSchemaKeyToString(key)));
+    }
+}
+
+bool ParseUtil::HasError()
+{
+    return s_currentErrorScope != nullptr && s_currentErrorScope->m_error != nullptr;
+}
+
+const ParseLimits& ParseUtil::GetLimits()
+{
+    return s_currentErrorScope != nullptr ? s_currentErrorScope->m_limits : NoParseLimits();
+}
+
+bool ParseUtil::IsWithinStringLimit(const Json::Value& value, AdaptiveCardSchemaKey key)
+{
+    const char* begin;
+    const char* end;
+    if (value.isString() && value.getString(&begin, &end) && static_cast<size_t>(end - begin) > GetLimits().maxStringLength)
+    {
+        RaiseError(ErrorStatusCode::ParseLimitExceeded, "Value for property " + AdaptiveCardSchemaKeyToString(key) + " exceeds the maximum string length", key);
+        return false;
+    }
+    return true;
+}
+
+ParseUtil::ErrorScope::ErrorScope() :
+    ErrorScope(NoParseLimits())
+{
+}
+
+// A scope joining an active one is held to that scope's limits
+ParseUtil::ErrorScope::ErrorScope(const ParseLimits& limits) :
+    m_state(s_currentErrorScope != nullptr ? s_currentErrorScope : this),
+    m_pathBase(NoPathNode),
+    m_pathBegin(0),
+    m_limits(limits),
+    m_depth(0),
+    m_showCardDepth(0)
+{
+    s_currentErrorScope = m_state;
+}
+
+ParseUtil::ErrorScope::~ErrorScope()
+{
+    if (m_state == this)
+    {
+        s_currentErrorScope = nullptr;
+    }
+}
+
+std::shared_ptr<AdaptiveCardParseError> ParseUtil::ErrorScope::GetError() const
+{
+    return m_state->m_error;
+}
+
+const ParseStatistics& ParseUtil::ErrorScope::GetStatistics() const
+{
+    return m_state->m_statistics;
+}
+
+bool ParseUtil::ErrorScope::IsNested() const
+{
+    return m_state != this;
+}
+
+ParseUtil::ErrorScope::Context ParseUtil::ErrorScope::SaveContext()
+{
+    // Segments get their node the first time a task is deferred under them, so siblings share it
+    size_t node = m_pathBase;
+    for (size_t i = m_pathBegin; i < m_path.size(); ++i)
+    {
+        PathSegment& segment = m_path[i];
+        if (segment.node == NoPathNode)
+        {
+            segment.node = m_pathNodes.size();
+            m_pathNodes.push_back({ node, segment.name, segment.index });
+        }
+        node = segment.node;
+    }
+    return { node, 0, m_depth, m_showCardDepth };
+}
+
+ParseUtil::ErrorScope::Context ParseUtil::ErrorScope::Resume(const Context& context)
+{
+    const Context outerContext = { m_pathBase, m_pathBegin, m_depth, m_showCardDepth };
+    m_pathBase = context.pathBase;
+    m_pathBegin = m_path.size();
+    m_depth = context.depth;
+    m_showCardDepth = context.showCardDepth;
+    return outerContext;
+}
+
+void ParseUtil::ErrorScope::Restore(const Context& context)
+{
+    m_pathBase = context.pathBase;
+    m_pathBegin = context.pathBegin;
+    m_depth = context.depth;
+    m_showCardDepth = context.showCardDepth;
+}
+
+std::string ParseUtil::ErrorScope::FormatPath(const std::string* propertyName) const
+{
+    std::string path = "$";
+    auto appendSegment = [&path](const std::string* name, size_t index)
+    {
+        if (name != nullptr)
+        {
+            path.push_back('.');
+            path.append(*name);
+        }
+        else
+        {
+            path.push_back('[');
+            path.append(std::to_string(index));
+            path.push_back(']');
+        }
+    };
+
+    // The deferred part of the path is linked from the leaf up
+    std::vector<const PathNode*> nodes;
+    for (size_t node = m_pathBase; node != NoPathNode; node = m_pathNodes[node].parent)
+    {
+        nodes.push_back(&m_pathNodes[node]);
+    }
+    for (auto node = nodes.rbegin(); node != nodes.rend(); ++node)
+    {
+        appendSegment((*node)->name, (*node)->index);
+    }
+    for (size_t i = m_pathBegin; i < m_path.size(); ++i)
+    {
+        appendSegment(m_path[i].name, m_path[i].index);
+    }
+
+    if (propertyName != nullptr)
+    {
+        path.push_back('.');
+        path.append(*propertyName);
+    }
+    return path;
+}
+
+ParseUtil::JsonPathSegment::JsonPathSegment(AdaptiveCardSchemaKey key) :
+    m_scope(s_currentErrorScope)
+{
+    if (m_scope != nullptr)
+    {
+        m_scope->m_path.push_back({ &AdaptiveCardSchemaKeyToString(key), 0, NoPathNode });
+    }
+}
+
+ParseUtil::JsonPathSegment::JsonPathSegment(size_t index) :
+    m_scope(s_currentErrorScope)
+{
+    if (m_scope != nullptr)
+    {
+        m_scope->m_path.push_back({ nullptr, index, NoPathNode });
+    }
+}
+
+ParseUtil::JsonPathSegment::~JsonPathSegment()
+{
+    if (m_scope != nullptr)
+    {
+        m_scope->m_path.pop_back();
+    }
+}
+
+ParseUtil::NestingScope::NestingScope(bool isShowCard) :
+    m_scope(s_currentErrorScope),
+    m_isShowCard(isShowCard)
+{
+    if (m_scope == nullptr)
+    {
+        return;
+    }
+
+    ParseStatistics& statistics = m_scope->m_statistics;
+    const ParseLimits& limits = m_scope->m_limits;
+    if (m_isShowCard)
+    {
+        statistics.maxShowCardDepth = std::max(statistics.maxShowCardDepth, ++m_scope->m_showCardDepth);
+        if (m_scope->m_showCardDepth > limits.maxShowCardDepth)
+        {
+            RaiseError(ErrorStatusCode::ParseLimitExceeded, "Maximum Action.ShowCard nesting of " + std::to_string(limits.maxShowCardDepth) + " exceeded");
+        }
+        return;
+    }
+
+    statistics.maxDepth = std::max(statistics.maxDepth, ++m_scope->m_depth);
+    ++statistics.elementCount;
+    if (m_scope->m_depth > limits.maxDepth)
+    {
+        RaiseError(ErrorStatusCode::ParseLimitExceeded, "Maximum nesting depth of " + std::to_string(limits.maxDepth) + " exceeded");
+    }
+    else if (statistics.elementCount > limits.maxElementCount)
+    {
+        RaiseError(ErrorStatusCode::ParseLimitExceeded, "Maximum element count of " + std::to_string(limits.maxElementCount) + " exceeded");
+    }
+}
+
+ParseUtil::NestingScope::~NestingScope()
+{
+    if (m_scope != nullptr)
+    {
+        --(m_isShowCard ? m_scope->m_showCardDepth : m_scope->m_depth);
+    }
+}
+
 ParseUtil::ParseUtil()
 {
 }
@@ -2,10 +2,13 @@
 
 #include "pch.h"
 #include "AdaptiveCardParseException.h"
+#include "AdaptiveCardParseError.h"
 #include "Enums.h"
 #include "json/json.h"
 #include "ElementParserRegistration.h"
 #include "ActionParserRegistration.h"
+#include "ParseLimits.h"
+#include "CardTraversal.h"
 
 AdaptiveSharedNamespaceStart
 class BaseCardElement;
@@ -45,11 +48,17 @@ public:
 
     static ActionType TryGetActionType(const Json::Value& json);
 
-    static Json::Value GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+    // Returns a reference into json, or to a null value if the key is missing, so that nested
+    // subtrees are never copied on the way down
+    static const Json::Value& GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
     static Json::Value GetJsonValueFromString(const std::string jsonString);
 
-    static Json::Value ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
+    static const Json::Value& ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
+
+    // Returns the value of the property, or nullptr if json does not have it
+    static const Json::Value* FindValue(const Json::Value& json, AdaptiveCardSchemaKey key);
+    static const Json::Value* FindValue(const Json::Value& json, const char* key);
 
     template <typename T>
     static T GetEnumValue(
@@ -66,6 +75,16 @@ public:
         AdaptiveCardSchemaKey key,
         bool isRequired = false);
 
+    // Parses the collection into elements. While a card is being parsed the elements are parsed
+    // as deferred tasks (see Defer), so json and elements must stay alive until the parse ends.
+    static void GetElementCollection(
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration,
+        const Json::Value& json,
+        AdaptiveCardSchemaKey key,
+        bool isRequired,
+        std::shared_ptr<std::vector<std::shared_ptr<BaseCardElement>>> elements);
+
     template <typename T>
     static std::vector<std::shared_ptr<T>> GetElementCollectionOfSingleType(
         std::shared_ptr<ElementParserRegistration> elementParserRegistration,
@@ -75,6 +94,16 @@ public:
         const std::function<std::shared_ptr<T>(std::shared_ptr<ElementParserRegistration>, std::shared_ptr<ActionParserRegistration>, const Json::Value&)>& deserializer,
         bool isRequired = false);
 
+    template <typename T>
+    static void GetElementCollectionOfSingleType(
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration,
+        const Json::Value& json,
+        AdaptiveCardSchemaKey key,
+        const std::function<std::shared_ptr<T>(std::shared_ptr<ElementParserRegistration>, std::shared_ptr<ActionParserRegistration>, const Json::Value&)>& deserializer,
+        bool isRequired,
+        std::shared_ptr<std::vector<std::shared_ptr<T>>> elements);
+
     static std::vector<std::shared_ptr<BaseActionElement>> GetActionCollection(
         std::shared_ptr<ElementParserRegistration> elementParserRegistration,
         std::shared_ptr<ActionParserRegistration> actionParserRegistration,
@@ -82,6 +111,14 @@ public:
         AdaptiveCardSchemaKey key,
         bool isRequired = false);
 
+    static void GetActionCollection(
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration,
+        const Json::Value& json,
+        AdaptiveCardSchemaKey key,
+        bool isRequired,
+        std::shared_ptr<std::vector<std::shared_ptr<BaseActionElement>>> actions);
+
     static std::shared_ptr<BaseActionElement> GetSelectAction(
         std::shared_ptr<ElementParserRegistration> elementParserRegistration,
         std::shared_ptr<ActionParserRegistration> actionParserRegistration,
@@ -101,6 +138,11 @@ public:
         std::shared_ptr<ActionParserRegistration> actionParserRegistration,
         const Json::Value& json);
 
+    static std::shared_ptr<BaseCardElement> GetElementFromJsonValue(
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration,
+        const Json::Value& json);
+
     static void ExpectTypeString(const Json::Value& json, CardElementType bodyType);
 
     // throws if the key is missing or the value mapped to the key is the wrong type
@@ -108,38 +150,199 @@ public:
 
     static std::string ToLowercase(const std::string value);
 
+    // Reports a parse error. Outside an ErrorScope this throws AdaptiveCardParseException. Inside
+    // one, the first error is recorded along with the JSON path being parsed, and the caller
+    // carries on with a default value so that parsing unwinds normally; the card is discarded.
+    static void RaiseError(ErrorStatusCode statusCode, const std::string& message);
+    static void RaiseError(ErrorStatusCode statusCode, const std::string& message, AdaptiveCardSchemaKey key);
+
+    // True once an error has been recorded in the active ErrorScope. Parsers check this to stop
+    // descending into the rest of a card that has already failed.
+    static bool HasError();
+
+    // Limits of the active ErrorScope. Without a scope nothing is limited.
+    static const ParseLimits& GetLimits();
+
+    // Raises ParseLimitExceeded if a string value is longer than the active limits allow
+    static bool IsWithinStringLimit(const Json::Value& value, AdaptiveCardSchemaKey key);
+
+    // Runs task as a CardTraversal task: after the element being parsed, with the JSON path,
+    // nesting and error scope it would see now. Parsers defer the parsing of children this way, so
+    // that the depth of a card does not add to the depth of the call stack. Once the card has
+    // failed, remaining tasks are skipped.
+    template <typename TTask>
+    static void Defer(TTask task);
+
+    // While a scope is active on a thread, RaiseError records instead of throwing. A scope opened
+    // while another is active shares its state, so a nested card (such as Action.ShowCard's)
+    // reports into the outer card with its full path.
+    class ErrorScope
+    {
+    public:
+        ErrorScope();
+        explicit ErrorScope(const ParseLimits& limits);
+        ~ErrorScope();
+        ErrorScope(const ErrorScope&) = delete;
+        ErrorScope& operator=(const ErrorScope&) = delete;
+
+        std::shared_ptr<AdaptiveCardParseError> GetError() const;
+        const ParseStatistics& GetStatistics() const;
+
+        // True if this scope joined one that was already active
+        bool IsNested() const;
+
+    private:
+        friend class ParseUtil;
+
+        // One step of the JSON path: a member name, or an array index when name is null. node is
+        // the step's entry in m_pathNodes once a deferred task has needed it.
+        struct PathSegment
+        {
+            const std::string* name;
+            size_t index;
+            size_t node;
+        };
+
+        struct PathNode
+        {
+            size_t parent;
+            const std::string* name;
+            size_t index;
+        };
+
+        // Where in the card a deferred task runs
+        struct Context
+        {
+            size_t pathBase;
+            size_t pathBegin;
+            unsigned int depth;
+            unsigned int showCardDepth;
+        };
+
+        Context SaveContext();
+        Context Resume(const Context& context);
+        void Restore(const Context& context);
+
+        std::string FormatPath(const std::string* propertyName) const;
+
+        ErrorScope* m_state;
+        std::shared_ptr<AdaptiveCardParseError> m_error;
+
+        // The JSON path is m_pathNodes from m_pathBase up, which deferred tasks share as a tree,
+        // followed by the segments m_path holds from m_pathBegin on for the running task
+        std::vector<PathSegment> m_path;
+        std::vector<PathNode> m_pathNodes;
+        size_t m_pathBase;
+        size_t m_pathBegin;
+        ParseLimits m_limits;
+        ParseStatistics m_statistics;
+        unsigned int m_depth;
+        unsigned int m_showCardDepth;
+    };
+
+    // Counts an element, action or sub-object (column, fact, choice...) towards the active
+    // ErrorScope's depth and element limits for the lifetime of the object, or an Action.ShowCard
+    // card towards its card nesting limit. Callers check HasError() once it is constructed.
+    class NestingScope
+    {
+    public:
+        explicit NestingScope(bool isShowCard = false);
+        ~NestingScope();
+        NestingScope(const NestingScope&) = delete;
+        NestingScope& operator=(const NestingScope&) = delete;
+
+    private:
+        ErrorScope* m_scope;
+        bool m_isShowCard;
+    };
+
+    // Extends the JSON path of the active ErrorScope, if any, for the lifetime of the object
+    class JsonPathSegment
+    {
+    public:
+        explicit JsonPathSegment(AdaptiveCardSchemaKey key);
+        explicit JsonPathSegment(size_t index);
+        ~JsonPathSegment();
+        JsonPathSegment(const JsonPathSegment&) = delete;
+        JsonPathSegment& operator=(const JsonPathSegment&) = delete;
+
+    private:
+        ErrorScope* m_scope;
+    };
+
 private:
     ParseUtil();
     ~ParseUtil();
 
+    // The error scope and context a deferred task was scheduled from, made current while it runs
+    class DeferredContext
+    {
+    public:
+        DeferredContext();
+
+        class Resumption
+        {
+        public:
+            explicit Resumption(const DeferredContext& context);
+            ~Resumption();
+            Resumption(const Resumption&) = delete;
+            Resumption& operator=(const Resumption&) = delete;
+
+        private:
+            ErrorScope* m_outerScope;
+            ErrorScope* m_scope;
+            ErrorScope::Context m_outerContext;
+        };
+
+    private:
+        ErrorScope* m_scope;
+        ErrorScope::Context m_context;
+    };
 };
 
+template <typename TTask>
+void ParseUtil::Defer(TTask task)
+{
+    if (HasError())
+    {
+        return;
+    }
+
+    const DeferredContext context;
+    CardTraversal::Schedule([context, task]()
+    {
+        const DeferredContext::Resumption resumption(context);
+        if (!HasError())
+        {
+            task();
+        }
+    });
+}
+
 template <typename T>
 T ParseUtil::GetEnumValue(const Json::Value& json, AdaptiveCardSchemaKey key, T defaultEnumValue, std::function<T(const std::string& name)> enumConverter, bool isRequired)
 {
     std::string propertyValueStr = "";
     try
     {
-        const std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
+        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
+        const Json::Value* propertyValue = FindValue(json, key);
+        if (propertyValue == nullptr || propertyValue->empty())
         {
             if (isRequired)
             {
-                throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName);
-            }
-            else
-            {
-                return defaultEnumValue;
+                RaiseError(ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName, key);
             }
+            return defaultEnumValue;
         }
 
-        if (!propertyValue.isString())
+        if (!propertyValue->isString())
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Enum type was invalid. Expected type string.");
+            RaiseError(ErrorStatusCode::InvalidPropertyValue, "Enum type was invalid. Expected type string.", key);
+            return defaultEnumValue;
         }
 
-        propertyValueStr = propertyValue.asString();
+        propertyValueStr = propertyValue->asString();
         return enumConverter(propertyValueStr);
     }
     catch (const std::out_of_range&)
@@ -159,7 +362,7 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollectionOfSingleType(
     const std::function<std::shared_ptr<T>(std::shared_ptr<ElementParserRegistration>, std::shared_ptr<ActionParserRegistration>, const Json::Value&)>& deserializer,
     bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const Json::Value& elementArray = GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<T>> elements;
     if (elementArray.empty())
@@ -169,11 +372,20 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollectionOfSingleType(
 
     elements.reserve(elementArray.size());
 
+    JsonPathSegment arraySegment(key);
+
     // Deserialize every element in the array
-    for (const Json::Value& curJsonValue : elementArray)
+    for (Json::ArrayIndex i = 0; i < elementArray.size() && !HasError(); ++i)
     {
+        JsonPathSegment indexSegment(i);
+        NestingScope nestingScope;
+        if (HasError())
+        {
+            break;
+        }
+
         // Parse the element
-        auto el = deserializer(elementParserRegistration, actionParserRegistration, curJsonValue);
+        auto el = deserializer(elementParserRegistration, actionParserRegistration, elementArray[i]);
         if (el != nullptr)
         {
             elements.push_back(el);
@@ -183,6 +395,46 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollectionOfSingleType(
     return elements;
 }
 
+template <typename T>
+void ParseUtil::GetElementCollectionOfSingleType(
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration,
+    const Json::Value& json,
+    AdaptiveCardSchemaKey key,
+    const std::function<std::shared_ptr<T>(std::shared_ptr<ElementParserRegistration>, std::shared_ptr<ActionParserRegistration>, const Json::Value&)>& deserializer,
+    bool isRequired,
+    std::shared_ptr<std::vector<std::shared_ptr<T>>> elements)
+{
+    const Json::Value& elementArray = GetArray(json, key, isRequired);
+    if (elementArray.empty())
+    {
+        return;
+    }
+
+    elements->reserve(elementArray.size());
+
+    JsonPathSegment arraySegment(key);
+    for (Json::ArrayIndex i = 0; i < elementArray.size(); ++i)
+    {
+        JsonPathSegment indexSegment(i);
+        const Json::Value& elementJson = elementArray[i];
+        Defer([=, &elementJson]()
+        {
+            NestingScope nestingScope;
+            if (HasError())
+            {
+                return;
+            }
+
+            auto el = deserializer(elementParserRegistration, actionParserRegistration, elementJson);
+            if (el != nullptr)
+            {
+                elements->push_back(el);
+            }
+        });
+    }
+}
+
 template <typename T>
 T ParseUtil::ExtractJsonValueAndMergeWithDefault(
     const Json::Value& rootJson,
@@ -190,7 +442,7 @@ T ParseUtil::ExtractJsonValueAndMergeWithDefault(
     const T& defaultValue,
     const std::function<T(const Json::Value&, const T&)>& deserializer)
 {
-    auto jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
+    const Json::Value& jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
     T result = jsonObject.empty() ? defaultValue : deserializer(jsonObject, defaultValue);
     return result;
 }
@@ -0,0 +1,581 @@
+#include "pch.h"
+#include "ResourceLoader.h"
+#include "ParseCache.h"
+#include "ResourceManifest.h"
+#include "SharedAdaptiveCard.h"
+#include <cstdio>
+#include <iterator>
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    int GetHexValue(char c)
+    {
+        if (c >= '0' && c <= '9')
+        {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f')
+        {
+            return c - 'a' + 10;
+        }
+        if (c >= 'A' && c <= 'F')
+        {
+            return c - 'A' + 10;
+        }
+        return -1;
+    }
+
+    // Sequences that aren't valid escapes are kept as they are
+    std::string PercentDecode(const std::string& text)
+    {
+        std::string decoded;
+        decoded.reserve(text.size());
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            if (text[i] == '%' && i + 2 < text.size() && GetHexValue(text[i + 1]) >= 0 && GetHexValue(text[i + 2]) >= 0)
+            {
+                decoded.push_back(static_cast<char>(GetHexValue(text[i + 1]) * 16 + GetHexValue(text[i + 2])));
+                i += 2;
+            }
+            else
+            {
+                decoded.push_back(text[i]);
+            }
+        }
+        return decoded;
+    }
+
+    bool EqualsIgnoreCase(const std::string& first, const std::string& second)
+    {
+        return first.size() == second.size() && std::equal(first.begin(), first.end(), second.begin(), [](char a, char b)
+        {
+            return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+        });
+    }
+
+    std::shared_ptr<const std::string> ReadFile(std::ifstream& file)
+    {
+        auto content = std::make_shared<std::string>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return file.bad() ? nullptr : content;
+    }
+}
+
+ResourceLoadResult::ResourceLoadResult() :
+    status(ResourceLoadStatus::Failed)
+{
+}
+
+ResourceLoadResult::ResourceLoadResult(const std::string& uri, ResourceLoadStatus status, const std::string& error) :
+    uri(uri),
+    status(status),
+    error(error)
+{
+}
+
+ResourceLoadResult::ResourceLoadResult(const std::string& uri, std::shared_ptr<const std::string> content) :
+    uri(uri),
+    status(ResourceLoadStatus::Loaded),
+    content(content)
+{
+}
+
+ResourceResolver::~ResourceResolver()
+{
+}
+
+void FileResourceResolver::Resolve(const std::string& uri, ResourceLoadCallback callback)
+{
+    const std::string path = GetPath(uri);
+    if (path.empty())
+    {
+        callback(ResourceLoadResult(uri, ResourceLoadStatus::NotFound, "Not a local file URI"));
+        return;
+    }
+
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file)
+    {
+        callback(ResourceLoadResult(uri, ResourceLoadStatus::NotFound, "Could not open " + path));
+        return;
+    }
+
+    auto content = ReadFile(file);
+    if (content == nullptr)
+    {
+        callback(ResourceLoadResult(uri, ResourceLoadStatus::Failed, "Could not read " + path));
+        return;
+    }
+    callback(ResourceLoadResult(uri, content));
+}
+
+std::string FileResourceResolver::GetPath(const std::string& uri)
+{
+    if (ResourceLoader::GetScheme(uri) != "file")
+    {
+        return "";
+    }
+
+    // Either file:/path or file://host/path, where the host may only be empty or localhost
+    std::string path = uri.substr(sizeof("file:") - 1);
+    if (path.compare(0, 2, "//") == 0)
+    {
+        const size_t pathStart = path.find('/', 2);
+        const std::string host = path.substr(2, (pathStart == std::string::npos) ? std::string::npos : pathStart - 2);
+        if (!host.empty() && !EqualsIgnoreCase(host, "localhost"))
+        {
+            return "";
+        }
+        path = (pathStart == std::string::npos) ? "" : path.substr(pathStart);
+    }
+
+    path = PercentDecode(path);
+#ifdef ADAPTIVE_CARDS_WINDOWS
+    // file:///C:/path
+    if (path.size() >= 3 && path[0] == '/' && std::isalpha(static_cast<unsigned char>(path[1])) && path[2] == ':')
+    {
+        path.erase(0, 1);
+    }
+#endif
+    return path;
+}
+
+void MemoryResourceResolver::Resolve(const std::string& uri, ResourceLoadCallback callback)
+{
+    std::shared_ptr<const std::string> content;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_contents.find(uri);
+        if (found != m_contents.end())
+        {
+            content = found->second;
+        }
+    }
+
+    if (content == nullptr)
+    {
+        callback(ResourceLoadResult(uri, ResourceLoadStatus::NotFound));
+        return;
+    }
+    callback(ResourceLoadResult(uri, content));
+}
+
+void MemoryResourceResolver::Add(const std::string& uri, const std::string& content)
+{
+    auto sharedContent = std::make_shared<const std::string>(content);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_contents[uri] = sharedContent;
+}
+
+void MemoryResourceResolver::Remove(const std::string& uri)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_contents.erase(uri);
+}
+
+CallbackResourceResolver::CallbackResourceResolver(ResolveFunction resolve) :
+    m_resolve(resolve)
+{
+}
+
+void CallbackResourceResolver::Resolve(const std::string& uri, ResourceLoadCallback callback)
+{
+    m_resolve(uri, callback);
+}
+
+ResourceLoader::ResourceLoader(size_t memoryCapacityInBytes) :
+    m_memoryCapacityInBytes(memoryCapacityInBytes),
+    m_sizeInBytes(0),
+    m_diskCapacityInBytes(0),
+    m_diskSizeInBytes(0),
+    m_hitCount(0),
+    m_missCount(0),
+    m_coalescedCount(0),
+    m_evictionCount(0)
+{
+    m_resolvers["file"] = std::make_shared<FileResourceResolver>();
+}
+
+void ResourceLoader::SetResolver(const std::string& scheme, std::shared_ptr<ResourceResolver> resolver)
+{
+    std::string lowerScheme = scheme;
+    std::transform(lowerScheme.begin(), lowerScheme.end(), lowerScheme.begin(), [](char c)
+    {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    });
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (resolver == nullptr)
+    {
+        m_resolvers.erase(lowerScheme);
+    }
+    else
+    {
+        m_resolvers[lowerScheme] = resolver;
+    }
+}
+
+void ResourceLoader::SetDiskCache(const std::string& directory, size_t capacityInBytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_diskDirectory = directory;
+    m_diskCapacityInBytes = capacityInBytes;
+    m_diskSizeInBytes = 0;
+    m_diskEntries.clear();
+    m_diskIndex.clear();
+}
+
+void ResourceLoader::Load(const std::string& uri, ResourceLoadCallback callback)
+{
+    std::shared_ptr<const std::string> cachedContent;
+    std::shared_ptr<ResourceResolver> resolver;
+    bool hasDiskCache = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_index.find(uri);
+        if (found != m_index.end())
+        {
+            m_entries.splice(m_entries.begin(), m_entries, found->second);
+            cachedContent = found->second->content;
+        }
+        else
+        {
+            auto pending = m_pending.find(uri);
+            if (pending != m_pending.end())
+            {
+                pending->second.push_back(callback);
+                ++m_coalescedCount;
+                return;
+            }
+            m_pending[uri].push_back(callback);
+
+            auto registered = m_resolvers.find(GetScheme(uri));
+            if (registered != m_resolvers.end())
+            {
+                resolver = registered->second;
+            }
+            hasDiskCache = !m_diskDirectory.empty();
+        }
+    }
+
+    if (cachedContent != nullptr)
+    {
+        ++m_hitCount;
+        callback(ResourceLoadResult(uri, cachedContent));
+        return;
+    }
+
+    if (hasDiskCache)
+    {
+        auto content = ReadFromDisk(uri);
+        if (content != nullptr)
+        {
+            ++m_hitCount;
+            Complete(ResourceLoadResult(uri, content), false);
+            return;
+        }
+    }
+
+    ++m_missCount;
+    if (resolver == nullptr)
+    {
+        Complete(ResourceLoadResult(uri, ResourceLoadStatus::UnsupportedScheme, "No resolver for the scheme of the URI"), false);
+        return;
+    }
+
+    try
+    {
+        resolver->Resolve(uri, [this, uri](const ResourceLoadResult& result)
+        {
+            ResourceLoadResult resolved = result;
+            resolved.uri = uri;
+            Complete(resolved, true);
+        });
+    }
+    catch (const std::exception& e)
+    {
+        // Nothing is waiting any more if the resolver completed before throwing
+        Complete(ResourceLoadResult(uri, ResourceLoadStatus::Failed, e.what()), false);
+    }
+}
+
+void ResourceLoader::Load(AdaptiveCard& card, ResourceLoadCallback callback)
+{
+    std::unordered_set<std::string> loaded;
+    for (const auto& uri : card.GetResourceUris())
+    {
+        if (loaded.insert(uri).second)
+        {
+            Load(uri, callback);
+        }
+    }
+}
+
+void ResourceLoader::Load(const ResourceManifest& manifest, ResourceLoadCallback callback)
+{
+    for (const auto& resource : manifest.GetResourcesByPriority())
+    {
+        Load(resource.uri, callback);
+    }
+}
+
+void ResourceLoader::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index.clear();
+    m_entries.clear();
+    m_sizeInBytes = 0;
+}
+
+size_t ResourceLoader::GetMemoryCapacityInBytes() const
+{
+    return m_memoryCapacityInBytes;
+}
+
+size_t ResourceLoader::GetSizeInBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sizeInBytes;
+}
+
+size_t ResourceLoader::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t ResourceLoader::GetDiskSizeInBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_diskSizeInBytes;
+}
+
+unsigned long long ResourceLoader::GetHitCount() const
+{
+    return m_hitCount;
+}
+
+unsigned long long ResourceLoader::GetMissCount() const
+{
+    return m_missCount;
+}
+
+unsigned long long ResourceLoader::GetCoalescedCount() const
+{
+    return m_coalescedCount;
+}
+
+unsigned long long ResourceLoader::GetEvictionCount() const
+{
+    return m_evictionCount;
+}
+
+std::string ResourceLoader::GetScheme(const std::string& uri)
+{
+    // ALPHA *( ALPHA / DIGIT / "+" / "-" / "." ) ":"
+    std::string scheme;
+    for (char c : uri)
+    {
+        const unsigned char u = static_cast<unsigned char>(c);
+        if (c == ':')
+        {
+            return scheme;
+        }
+        if (!(std::isalpha(u) || (!scheme.empty() && (std::isdigit(u) || c == '+' || c == '-' || c == '.'))))
+        {
+            break;
+        }
+        scheme.push_back(static_cast<char>(std::tolower(u)));
+    }
+    return "";
+}
+
+void ResourceLoader::Complete(ResourceLoadResult result, bool isFromResolver)
+{
+    if (result.status == ResourceLoadStatus::Loaded && result.content == nullptr)
+    {
+        result = ResourceLoadResult(result.uri, ResourceLoadStatus::Failed, "The resolver returned no content");
+    }
+
+    const bool isLoaded = result.status == ResourceLoadStatus::Loaded;
+    if (isLoaded && isFromResolver)
+    {
+        WriteToDisk(result.uri, *result.content);
+    }
+
+    std::vector<ResourceLoadCallback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto pending = m_pending.find(result.uri);
+        if (pending != m_pending.end())
+        {
+            callbacks.swap(pending->second);
+            m_pending.erase(pending);
+        }
+        if (isLoaded)
+        {
+            AddToMemory(result.uri, result.content);
+        }
+    }
+
+    for (const auto& callback : callbacks)
+    {
+        callback(result);
+    }
+}
+
+void ResourceLoader::AddToMemory(const std::string& uri, const std::shared_ptr<const std::string>& content)
+{
+    const size_t sizeInBytes = sizeof(Entry) + uri.size() + content->size();
+    if (sizeInBytes > m_memoryCapacityInBytes)
+    {
+        return;
+    }
+
+    auto found = m_index.find(uri);
+    if (found != m_index.end())
+    {
+        m_sizeInBytes -= found->second->sizeInBytes;
+        m_entries.erase(found->second);
+        m_index.erase(found);
+    }
+
+    m_entries.push_front({ uri, content, sizeInBytes });
+    m_index[uri] = m_entries.begin();
+    m_sizeInBytes += sizeInBytes;
+
+    while (m_sizeInBytes > m_memoryCapacityInBytes)
+    {
+        const Entry& leastRecentlyUsed = m_entries.back();
+        m_sizeInBytes -= leastRecentlyUsed.sizeInBytes;
+        m_index.erase(leastRecentlyUsed.uri);
+        m_entries.pop_back();
+        ++m_evictionCount;
+    }
+}
+
+void ResourceLoader::AddToDisk(const std::string& fileName, size_t sizeInBytes, std::vector<std::string>& evictedFileNames)
+{
+    auto found = m_diskIndex.find(fileName);
+    if (found != m_diskIndex.end())
+    {
+        m_diskSizeInBytes -= found->second->sizeInBytes;
+        m_diskEntries.erase(found->second);
+        m_diskIndex.erase(found);
+    }
+
+    m_diskEntries.push_front({ fileName, sizeInBytes });
+    m_diskIndex[fileName] = m_diskEntries.begin();
+    m_diskSizeInBytes += sizeInBytes;
+
+    while (m_diskSizeInBytes > m_diskCapacityInBytes)
+    {
+        const DiskEntry& leastRecentlyUsed = m_diskEntries.back();
+        m_diskSizeInBytes -= leastRecentlyUsed.sizeInBytes;
+        evictedFileNames.push_back(leastRecentlyUsed.fileName);
+        m_diskIndex.erase(leastRecentlyUsed.fileName);
+        m_diskEntries.pop_back();
+    }
+}
+
+// A cached file holds the URI on its first line, so that URIs whose names collide are told apart,
+// then the content
+std::shared_ptr<const std::string> ResourceLoader::ReadFromDisk(const std::string& uri)
+{
+    const std::string fileName = GetDiskFileName(uri);
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        path = GetDiskPath(fileName);
+    }
+
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    std::string storedUri;
+    if (!file || !std::getline(file, storedUri) || storedUri != uri)
+    {
+        return nullptr;
+    }
+
+    auto content = ReadFile(file);
+    if (content == nullptr)
+    {
+        return nullptr;
+    }
+
+    std::vector<std::string> evictedFileNames;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        AddToDisk(fileName, uri.size() + 1 + content->size(), evictedFileNames);
+        for (auto& evictedFileName : evictedFileNames)
+        {
+            evictedFileName = GetDiskPath(evictedFileName);
+        }
+    }
+
+    for (const auto& evictedPath : evictedFileNames)
+    {
+        std::remove(evictedPath.c_str());
+    }
+    return content;
+}
+
+void ResourceLoader::WriteToDisk(const std::string& uri, const std::string& content)
+{
+    const std::string fileName = GetDiskFileName(uri);
+    const size_t sizeInBytes = uri.size() + 1 + content.size();
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_diskDirectory.empty() || sizeInBytes > m_diskCapacityInBytes)
+        {
+            return;
+        }
+        path = GetDiskPath(fileName);
+    }
+
+    // The URI must fit on the first line
+    if (uri.find('\n') != std::string::npos)
+    {
+        return;
+    }
+
+    std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    file << uri << '\n';
+    file.write(content.data(), content.size());
+    file.close();
+    if (!file)
+    {
+        std::remove(path.c_str());
+        return;
+    }
+
+    std::vector<std::string> evictedFileNames;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        AddToDisk(fileName, sizeInBytes, evictedFileNames);
+        for (auto& evictedFileName : evictedFileNames)
+        {
+            evictedFileName = GetDiskPath(evictedFileName);
+        }
+    }
+
+    for (const auto& evictedPath : evictedFileNames)
+    {
+        std::remove(evictedPath.c_str());
+    }
+}
+
+std::string ResourceLoader::GetDiskPath(const std::string& fileName) const
+{
+    const char last = m_diskDirectory.empty() ? '/' : m_diskDirectory.back();
+    return (last == '/' || last == '\\') ? m_diskDirectory + fileName : m_diskDirectory + '/' + fileName;
+}
+
+std::string ResourceLoader::GetDiskFileName(const std::string& uri)
+{
+    const unsigned long long hash = ParseCache::Hash(uri.data(), uri.size());
+    char fileName[sizeof("0123456789abcdef.resource")];
+    snprintf(fileName, sizeof(fileName), "%016llx.resource", hash);
+    return fileName;
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "pch.h"
+#include <atomic>
+#include <list>
+#include <mutex>
+
+AdaptiveSharedNamespaceStart
+class AdaptiveCard;
+class ResourceManifest;
+
+enum class ResourceLoadStatus
+{
+    Loaded = 0,
+    NotFound,
+    Failed,
+    // No resolver is registered for the scheme of the URI, or it has none
+    UnsupportedScheme,
+};
+
+struct ResourceLoadResult
+{
+    ResourceLoadResult();
+    ResourceLoadResult(const std::string& uri, ResourceLoadStatus status, const std::string& error = "");
+    ResourceLoadResult(const std::string& uri, std::shared_ptr<const std::string> content);
+
+    std::string uri;
+    ResourceLoadStatus status;
+
+    // The bytes of the resource when it loaded, shared with the cache and every other caller
+    std::shared_ptr<const std::string> content;
+
+    // Why the resource didn't load, if the resolver said
+    std::string error;
+};
+
+typedef std::function<void(const ResourceLoadResult& result)> ResourceLoadCallback;
+
+// Fetches the resources of one or more URI schemes. Resolve must call callback exactly once, on
+// any thread, either before it returns or later.
+class ResourceResolver
+{
+public:
+    virtual ~ResourceResolver();
+
+    virtual void Resolve(const std::string& uri, ResourceLoadCallback callback) = 0;
+};
+
+// Reads file:// URIs from the local file system, before Resolve returns
+class FileResourceResolver : public ResourceResolver
+{
+public:
+    void Resolve(const std::string& uri, ResourceLoadCallback callback) override;
+
+    // The path of a file:// URI, percent-decoded, or an empty string if it isn't one or names a
+    // host other than localhost
+    static std::string GetPath(const std::string& uri);
+};
+
+// Serves content the host has added for whole URIs, whatever their scheme, before Resolve returns.
+// May be used from several threads at once.
+class MemoryResourceResolver : public ResourceResolver
+{
+public:
+    void Resolve(const std::string& uri, ResourceLoadCallback callback) override;
+
+    void Add(const std::string& uri, const std::string& content);
+    void Remove(const std::string& uri);
+
+private:
+    std::unordered_map<std::string, std::shared_ptr<const std::string>> m_contents;
+    std::mutex m_mutex;
+};
+
+// Hands URIs to a host function, typically to fetch http and https resources on the network stack
+// of the platform
+class CallbackResourceResolver : public ResourceResolver
+{
+public:
+    typedef std::function<void(const std::string& uri, ResourceLoadCallback callback)> ResolveFunction;
+
+    explicit CallbackResourceResolver(ResolveFunction resolve);
+
+    void Resolve(const std::string& uri, ResourceLoadCallback callback) override;
+
+private:
+    ResolveFunction m_resolve;
+};
+
+// Loads the resources of cards through the resolver registered for the scheme of each URI, and
+// keeps the most recently used within a byte budget in memory, and optionally on disk. Loads of a
+// URI that is already being resolved wait for that one rather than resolving it again. Failures
+// are not cached.
+//
+// Callbacks are called once per load, on the thread that completes it: before Load returns when
+// the resource is cached or its resolver is synchronous, otherwise on the thread of the resolver.
+// The loader may be used from several threads at once and must outlive the loads it starts. A
+// file:// resolver is registered from the start.
+class ResourceLoader
+{
+public:
+    explicit ResourceLoader(size_t memoryCapacityInBytes);
+    ResourceLoader(const ResourceLoader&) = delete;
+    ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+    // The scheme is matched without regard to case, and without the colon. A null resolver
+    // unregisters the scheme.
+    void SetResolver(const std::string& scheme, std::shared_ptr<ResourceResolver> resolver);
+
+    // Also keeps what the resolvers load in files in directory, which must exist, within a byte
+    // budget, and looks there before resolving. Files left by an earlier loader are found by URI
+    // and count against the budget once they are read.
+    void SetDiskCache(const std::string& directory, size_t capacityInBytes);
+
+    void Load(const std::string& uri, ResourceLoadCallback callback);
+
+    // Loads each resource GetResourceUris returns for card once
+    void Load(AdaptiveCard& card, ResourceLoadCallback callback);
+
+    // Loads the resources of a manifest in the order to prefetch them
+    void Load(const ResourceManifest& manifest, ResourceLoadCallback callback);
+
+    // Empties the memory cache; the disk cache is left as it is
+    void Clear();
+
+    size_t GetMemoryCapacityInBytes() const;
+    size_t GetSizeInBytes() const;
+    size_t GetEntryCount() const;
+    size_t GetDiskSizeInBytes() const;
+
+    // Loads served from memory or disk, loads handed to a resolver, loads that waited on another
+    // load of the same URI, and resources evicted from memory
+    unsigned long long GetHitCount() const;
+    unsigned long long GetMissCount() const;
+    unsigned long long GetCoalescedCount() const;
+    unsigned long long GetEvictionCount() const;
+
+    // The scheme of uri in lowercase, or an empty string if it has none
+    static std::string GetScheme(const std::string& uri);
+
+private:
+    struct Entry
+    {
+        std::string uri;
+        std::shared_ptr<const std::string> content;
+        size_t sizeInBytes;
+    };
+
+    struct DiskEntry
+    {
+        std::string fileName;
+        size_t sizeInBytes;
+    };
+
+    void Complete(ResourceLoadResult result, bool isFromResolver);
+    void AddToMemory(const std::string& uri, const std::shared_ptr<const std::string>& content);
+    void AddToDisk(const std::string& fileName, size_t sizeInBytes, std::vector<std::string>& evictedFileNames);
+    std::shared_ptr<const std::string> ReadFromDisk(const std::string& uri);
+    void WriteToDisk(const std::string& uri, const std::string& content);
+    std::string GetDiskPath(const std::string& fileName) const;
+    static std::string GetDiskFileName(const std::string& uri);
+
+    const size_t m_memoryCapacityInBytes;
+    size_t m_sizeInBytes;
+
+    // Most recently used entry first
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+
+    // The callbacks waiting on each URI being resolved
+    std::unordered_map<std::string, std::vector<ResourceLoadCallback>> m_pending;
+
+    std::unordered_map<std::string, std::shared_ptr<ResourceResolver>> m_resolvers;
+
+    std::string m_diskDirectory;
+    size_t m_diskCapacityInBytes;
+    size_t m_diskSizeInBytes;
+    std::list<DiskEntry> m_diskEntries;
+    std::unordered_map<std::string, std::list<DiskEntry>::iterator> m_diskIndex;
+
+    mutable std::mutex m_mutex;
+
+    std::atomic<unsigned long long> m_hitCount;
+    std::atomic<unsigned long long> m_missCount;
+    std::atomic<unsigned long long> m_coalescedCount;
+    std::atomic<unsigned long long> m_evictionCount;
+};
+
+AdaptiveSharedNamespaceEnd
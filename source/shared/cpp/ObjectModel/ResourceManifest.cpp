@@ -0,0 +1,258 @@
+#include "pch.h"
+#include "ResourceManifest.h"
+#include "CardTree.h"
+#include "HostConfig.h"
+#include "ImageSet.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    const unsigned int BackgroundTier = 0;
+    const unsigned int VisibleTier = 1;
+    const unsigned int HiddenTier = 2;
+
+    // Fixed sizes are drawn square; auto and stretch are left to the image and layout
+    void ResolveImageSize(ImageSize size, const ImageSizesConfig& imageSizes, unsigned int& pixelWidth, unsigned int& pixelHeight)
+    {
+        switch (size)
+        {
+        case ImageSize::Small:
+            pixelWidth = pixelHeight = imageSizes.smallSize;
+            break;
+        case ImageSize::Medium:
+            pixelWidth = pixelHeight = imageSizes.mediumSize;
+            break;
+        case ImageSize::Large:
+            pixelWidth = pixelHeight = imageSizes.largeSize;
+            break;
+        default:
+            pixelWidth = pixelHeight = 0;
+            break;
+        }
+    }
+
+    // An explicit width or height wins over the size, which falls back to the host config
+    void ResolveImageSize(const Image& image, const HostConfig& hostConfig, unsigned int& pixelWidth, unsigned int& pixelHeight)
+    {
+        pixelWidth = image.GetWidth();
+        pixelHeight = image.GetHeight();
+        if (pixelWidth == 0 && pixelHeight == 0)
+        {
+            const ImageSize size = image.GetImageSize();
+            ResolveImageSize((size != ImageSize::None) ? size : hostConfig.image.imageSize, hostConfig.imageSizes, pixelWidth, pixelHeight);
+        }
+    }
+
+    // The images of a set are drawn at the size of the set, no taller than maxImageHeight
+    void ResolveImageSetImageSize(const ImageSet& imageSet, const HostConfig& hostConfig, unsigned int& pixelWidth, unsigned int& pixelHeight)
+    {
+        const ImageSize size = imageSet.GetImageSize();
+        ResolveImageSize((size != ImageSize::None) ? size : hostConfig.imageSet.imageSize, hostConfig.imageSizes, pixelWidth, pixelHeight);
+
+        const unsigned int maxImageHeight = hostConfig.imageSet.maxImageHeight;
+        if (pixelHeight == 0 || pixelHeight > maxImageHeight)
+        {
+            pixelWidth = (pixelWidth != 0) ? maxImageHeight : 0;
+            pixelHeight = maxImageHeight;
+        }
+    }
+
+    // A size left to the image or layout stays so whatever other uses are expected at
+    unsigned int MergeDimension(unsigned int first, unsigned int second)
+    {
+        return (first == 0 || second == 0) ? 0 : std::max(first, second);
+    }
+}
+
+ResourceEntry::ResourceEntry() :
+    kind(ResourceKind::Image),
+    pixelWidth(0),
+    pixelHeight(0),
+    useCount(0),
+    isInitiallyVisible(false)
+{
+}
+
+ResourceManifest::ResourceManifest() :
+    m_useCount(0)
+{
+}
+
+ResourceManifest ResourceManifest::Build(AdaptiveCard& card, const HostConfig& hostConfig)
+{
+    ResourceManifest manifest;
+
+    // The nodes from the root to the current one, the actions each card on the way has had so
+    // far, and the depth of the node everything under which is hidden, if any
+    std::vector<CardNode> path;
+    std::vector<unsigned int> actionCounts;
+    const unsigned int notHidden = std::numeric_limits<unsigned int>::max();
+    unsigned int hiddenDepth = notHidden;
+
+    const CardTree tree(card);
+    for (auto node = tree.begin(); node != tree.end(); ++node)
+    {
+        const unsigned int depth = node.GetDepth();
+        path.resize(depth);
+        path.push_back(*node);
+        actionCounts.resize(depth);
+        actionCounts.push_back(0);
+        if (depth <= hiddenDepth)
+        {
+            hiddenDepth = notHidden;
+        }
+
+        const unsigned int tier = (hiddenDepth == notHidden) ? VisibleTier : HiddenTier;
+        std::vector<std::string> otherUris;
+        switch (node->GetType())
+        {
+        case CardNodeType::Card:
+            manifest.AddUse(node->GetCard()->GetBackgroundImage(), ResourceKind::Background, 0, 0, (depth == 0) ? BackgroundTier : tier);
+            break;
+        case CardNodeType::Element:
+        {
+            BaseCardElement* element = node->GetElement();
+            const BaseCardElement* parent = (depth != 0) ? path[depth - 1].GetElement() : nullptr;
+            unsigned int pixelWidth;
+            unsigned int pixelHeight;
+            switch (element->GetElementType())
+            {
+            case CardElementType::Image:
+                if (parent != nullptr && parent->GetElementType() == CardElementType::ImageSet)
+                {
+                    ResolveImageSetImageSize(*static_cast<const ImageSet*>(parent), hostConfig, pixelWidth, pixelHeight);
+                    manifest.AddUse(static_cast<Image*>(element)->GetUrl(), ResourceKind::ImageSetImage, pixelWidth, pixelHeight, tier);
+                }
+                else
+                {
+                    ResolveImageSize(*static_cast<Image*>(element), hostConfig, pixelWidth, pixelHeight);
+                    manifest.AddUse(static_cast<Image*>(element)->GetUrl(), ResourceKind::Image, pixelWidth, pixelHeight, tier);
+                }
+                break;
+            case CardElementType::Container:
+            case CardElementType::Column:
+            case CardElementType::ColumnSet:
+            case CardElementType::ImageSet:
+                // What they hold is walked on its own
+                break;
+            default:
+                element->GetResourceUris(otherUris);
+                break;
+            }
+            break;
+        }
+        case CardNodeType::Action:
+        {
+            BaseActionElement* action = node->GetAction();
+
+            // The buttons of a card are its actions, and not its select action; the host shows no
+            // more than maxActions of them, and none without interactivity
+            const AdaptiveCard* parentCard = (depth != 0) ? path[depth - 1].GetCard() : nullptr;
+            const bool isButton = parentCard != nullptr && parentCard->GetSelectAction().get() != action;
+            if (isButton)
+            {
+                const unsigned int position = actionCounts[depth - 1]++;
+                if (!hostConfig.supportsInteractivity || position >= hostConfig.actions.maxActions)
+                {
+                    hiddenDepth = std::min(hiddenDepth, depth);
+                }
+                manifest.AddUse(action->GetIconUrl(), ResourceKind::Icon, 0, 0, (hiddenDepth == notHidden) ? VisibleTier : HiddenTier);
+            }
+
+            if (action->GetElementType() != ActionType::ShowCard)
+            {
+                action->GetResourceUris(otherUris);
+                break;
+            }
+
+            // The card only shows once the action is taken
+            hiddenDepth = std::min(hiddenDepth, depth);
+            if (static_cast<ShowCardAction*>(action)->IsCardDeferred())
+            {
+                action->GetResourceUris(otherUris);
+                node.SkipChildren();
+            }
+            break;
+        }
+        default:
+            break;
+        }
+
+        for (const auto& uri : otherUris)
+        {
+            manifest.AddUse(uri, ResourceKind::Other, 0, 0, (hiddenDepth == notHidden) ? VisibleTier : HiddenTier);
+        }
+    }
+    return manifest;
+}
+
+const std::vector<ResourceEntry>& ResourceManifest::GetResources() const
+{
+    return m_resources;
+}
+
+std::vector<ResourceEntry> ResourceManifest::GetResourcesByPriority() const
+{
+    std::vector<size_t> order(m_resources.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](size_t first, size_t second)
+    {
+        const Priority& firstPriority = m_priorities[first];
+        const Priority& secondPriority = m_priorities[second];
+        return (firstPriority.tier != secondPriority.tier) ? firstPriority.tier < secondPriority.tier :
+            firstPriority.firstUse < secondPriority.firstUse;
+    });
+
+    std::vector<ResourceEntry> resources;
+    resources.reserve(order.size());
+    for (size_t index : order)
+    {
+        resources.push_back(m_resources[index]);
+    }
+    return resources;
+}
+
+const ResourceEntry* ResourceManifest::Find(const std::string& uri) const
+{
+    auto index = m_indexes.find(uri);
+    return (index != m_indexes.end()) ? &m_resources[index->second] : nullptr;
+}
+
+void ResourceManifest::AddUse(const std::string& uri, ResourceKind kind, unsigned int pixelWidth, unsigned int pixelHeight, unsigned int tier)
+{
+    if (uri.empty())
+    {
+        return;
+    }
+
+    const unsigned int use = m_useCount++;
+    auto index = m_indexes.emplace(uri, m_resources.size());
+    if (index.second)
+    {
+        ResourceEntry resource;
+        resource.uri = uri;
+        resource.kind = kind;
+        resource.pixelWidth = pixelWidth;
+        resource.pixelHeight = pixelHeight;
+        resource.useCount = 1;
+        resource.isInitiallyVisible = (tier != HiddenTier);
+        m_resources.push_back(resource);
+        m_priorities.push_back({ tier, use });
+        return;
+    }
+
+    ResourceEntry& resource = m_resources[index.first->second];
+    resource.pixelWidth = MergeDimension(resource.pixelWidth, pixelWidth);
+    resource.pixelHeight = MergeDimension(resource.pixelHeight, pixelHeight);
+    ++resource.useCount;
+    resource.isInitiallyVisible = resource.isInitiallyVisible || (tier != HiddenTier);
+
+    Priority& priority = m_priorities[index.first->second];
+    if (tier < priority.tier)
+    {
+        priority = { tier, use };
+    }
+}
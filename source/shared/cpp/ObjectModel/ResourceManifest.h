@@ -0,0 +1,79 @@
+#pragma once
+
+#include "pch.h"
+
+AdaptiveSharedNamespaceStart
+class AdaptiveCard;
+struct HostConfig;
+
+enum class ResourceKind
+{
+    Background = 0,
+    Image,
+    ImageSetImage,
+    Icon,
+    // Reported by elements and actions of custom types, or read from the JSON of an
+    // Action.ShowCard card whose parsing was deferred
+    Other,
+};
+
+// A resource of a card, once however many times the card uses it
+struct ResourceEntry
+{
+    ResourceEntry();
+
+    std::string uri;
+
+    // Of the first use of the resource
+    ResourceKind kind;
+
+    // The largest size any use is expected to be drawn at, in pixels, as resolved through the
+    // imageSizes, image and imageSet host config. 0 when it is left to the image or to layout, as
+    // for auto and stretched images, backgrounds and icons, in which case the original is needed.
+    unsigned int pixelWidth;
+    unsigned int pixelHeight;
+
+    unsigned int useCount;
+
+    // True if a use is drawn when the card is first shown, rather than inside the card of an
+    // Action.ShowCard or on an action the host doesn't show
+    bool isInitiallyVisible;
+};
+
+class ResourceManifest
+{
+public:
+    ResourceManifest();
+
+    // Walks card, including the cards of its Action.ShowCard actions. Those whose parsing was
+    // deferred are read from their JSON rather than parsed.
+    static ResourceManifest Build(AdaptiveCard& card, const HostConfig& hostConfig);
+
+    // Each resource once, in the order the card first uses them
+    const std::vector<ResourceEntry>& GetResources() const;
+
+    // The resources in the order to prefetch them: the background of the card, then what is drawn
+    // when the card is first shown, from the top, then everything else in document order
+    std::vector<ResourceEntry> GetResourcesByPriority() const;
+
+    // Null if the card doesn't use uri
+    const ResourceEntry* Find(const std::string& uri) const;
+
+private:
+    // Resources are prefetched by tier, the background of the card first, then visible ones, then
+    // the rest, and within a tier by when the card first uses them at it
+    struct Priority
+    {
+        unsigned int tier;
+        unsigned int firstUse;
+    };
+
+    void AddUse(const std::string& uri, ResourceKind kind, unsigned int pixelWidth, unsigned int pixelHeight, unsigned int tier);
+
+    std::vector<ResourceEntry> m_resources;
+    std::vector<Priority> m_priorities;
+    std::unordered_map<std::string, size_t> m_indexes;
+    unsigned int m_useCount;
+};
+
+AdaptiveSharedNamespaceEnd
@@ -26,8 +26,9 @@ std::shared_ptr<Separator> Separator::DeserializeFromString(const std::string& j
 
 std::string Separator::Serialize()
 {
-    Json::FastWriter writer;
-    return writer.write(SerializeToJsonValue());
+    CardWriter writer;
+    SerializeToWriter(writer);
+    return writer.GetString();
 }
 
 Json::Value Separator::SerializeToJsonValue()
@@ -39,6 +40,14 @@ Json::Value Separator::SerializeToJsonValue()
     return root;
 }
 
+void Separator::SerializeToWriter(CardWriter& writer)
+{
+    writer.BeginObject();
+    writer.WriteProperty(AdaptiveCardSchemaKey::Color, ForegroundColorToString(GetColor()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::Thickness, SeparatorThicknessToString(GetThickness()));
+    writer.EndObject();
+}
+
 ForegroundColor Separator::GetColor() const
 {
     return m_color;
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "Enums.h"
 #include "json/json.h"
+#include "CardWriter.h"
 
 AdaptiveSharedNamespaceStart
 class Separator
@@ -12,6 +13,7 @@ public:
 
     std::string Serialize();
     Json::Value SerializeToJsonValue();
+    void SerializeToWriter(CardWriter& writer);
 
     SeparatorThickness GetThickness() const;
     void SetThickness(SeparatorThickness value);
@@ -5,6 +5,11 @@
 #include "ShowCardAction.h"
 #include "TextBlock.h"
 #include "AdaptiveCardParseWarning.h"
+#include "JsonScanner.h"
+#include "CardTraversal.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "ImageSet.h"
 
 using namespace AdaptiveSharedNamespace;
 
@@ -45,6 +50,12 @@ AdaptiveCard::AdaptiveCard(std::string version,
 {
 }
 
+AdaptiveCard::~AdaptiveCard()
+{
+    CardTraversal::Release(m_body);
+    CardTraversal::Release(m_actions);
+}
+
 #ifdef __ANDROID__
 std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromFile(
     const std::string& jsonFile,
@@ -81,30 +92,168 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(
     std::shared_ptr<ActionParserRegistration> actionParserRegistration)
 #endif // __ANDROID__
 {
+    return ThrowIfError(TryDeserialize(json, rendererVersion, elementParserRegistration, actionParserRegistration));
+}
+
+std::shared_ptr<ParseResult> AdaptiveCard::TryDeserialize(
+    const Json::Value& json,
+    double rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration)
+{
+    return TryDeserialize(json, rendererVersion, ParseLimits(), elementParserRegistration, actionParserRegistration);
+}
+
+std::shared_ptr<ParseResult> AdaptiveCard::TryDeserialize(
+    const Json::Value& json,
+    double rendererVersion,
+    const ParseLimits& limits,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration)
+{
+    ParseUtil::ErrorScope errorScope(limits);
+    std::shared_ptr<ParseResult> result;
+    auto parseCard = [&]()
+    {
+        result = ParseCard(json, rendererVersion, elementParserRegistration, actionParserRegistration,
+            [&json](std::shared_ptr<ElementParserRegistration> elementParsers, std::shared_ptr<ActionParserRegistration> actionParsers,
+                std::shared_ptr<std::vector<std::shared_ptr<BaseCardElement>>> body)
+            {
+                ParseUtil::GetElementCollection(elementParsers, actionParsers, json, AdaptiveCardSchemaKey::Body, false, body);
+            },
+            [&json](std::shared_ptr<ElementParserRegistration> elementParsers, std::shared_ptr<ActionParserRegistration> actionParsers,
+                std::shared_ptr<std::vector<std::shared_ptr<BaseActionElement>>> actions)
+            {
+                ParseUtil::GetActionCollection(elementParsers, actionParsers, json, AdaptiveCardSchemaKey::Actions, false, actions);
+            });
+    };
+
+    try
+    {
+        // A card nested in one being parsed finishes along with it. Otherwise the whole card is
+        // parsed here, while the scope is active.
+        if (errorScope.IsNested())
+        {
+            parseCard();
+        }
+        else
+        {
+            CardTraversal::RunNow(parseCard);
+        }
+    }
+    catch (const AdaptiveCardParseException& e)
+    {
+        // Thrown by a custom parser; the built-in ones report through the error scope
+        ParseUtil::RaiseError(e.GetStatusCode(), e.GetReason());
+    }
+    catch (const Json::Exception& e)
+    {
+        ParseUtil::RaiseError(ErrorStatusCode::InvalidJson, e.what());
+    }
+
+    std::shared_ptr<AdaptiveCardParseError> error = errorScope.GetError();
+    if (error != nullptr)
+    {
+        std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+        if (result != nullptr)
+        {
+            warnings = result->GetWarnings();
+        }
+        result = std::make_shared<ParseResult>(nullptr, warnings, error);
+    }
+    result->SetStatistics(errorScope.GetStatistics());
+    return result;
+}
+
+std::shared_ptr<ParseResult> AdaptiveCard::TryDeserializeFromString(
+    const std::string& jsonString,
+    double rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration)
+{
+    return TryDeserializeFromString(jsonString, rendererVersion, ParseLimits(), elementParserRegistration, actionParserRegistration);
+}
+
+std::shared_ptr<ParseResult> AdaptiveCard::TryDeserializeFromString(
+    const std::string& jsonString,
+    double rendererVersion,
+    const ParseLimits& limits,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration)
+{
+    Json::Value json;
+    {
+        // Closed before the card is parsed, so that TryDeserialize finishes the parse while json is alive
+        ParseUtil::ErrorScope errorScope(limits);
+        if (jsonString.size() > ParseUtil::GetLimits().maxPayloadLength)
+        {
+            ParseUtil::RaiseError(ErrorStatusCode::ParseLimitExceeded,
+                "Payload length of " + std::to_string(jsonString.size()) + " exceeds the maximum of " + std::to_string(ParseUtil::GetLimits().maxPayloadLength));
+        }
+        else
+        {
+            try
+            {
+                json = ParseUtil::GetJsonValueFromString(jsonString);
+            }
+            catch (const Json::Exception& e)
+            {
+                // The reader throws for JSON nested deeper than it supports
+                ParseUtil::RaiseError(ErrorStatusCode::InvalidJson, e.what());
+            }
+        }
+
+        if (ParseUtil::HasError())
+        {
+            return std::make_shared<ParseResult>(nullptr, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>(), errorScope.GetError());
+        }
+    }
+    return TryDeserialize(json, rendererVersion, limits, elementParserRegistration, actionParserRegistration);
+}
+
+std::shared_ptr<ParseResult> AdaptiveCard::ThrowIfError(std::shared_ptr<ParseResult> result)
+{
+    std::shared_ptr<AdaptiveCardParseError> error = result->GetError();
+    if (error != nullptr)
+    {
+        throw AdaptiveCardParseException(error->GetStatusCode(), error->GetReason());
+    }
+    return result;
+}
+
+std::shared_ptr<ParseResult> AdaptiveCard::ParseCard(
+    const Json::Value& json,
+    double rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration,
+    const BodyParser& bodyParser,
+    const ActionsParser& actionsParser)
+{
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+
     ParseUtil::ThrowIfNotJsonObject(json);
+    if (ParseUtil::HasError())
+    {
+        return std::make_shared<ParseResult>(nullptr, warnings);
+    }
 
     // Verify this is an adaptive card
     ParseUtil::ExpectTypeString(json, CardElementType::AdaptiveCard);
 
-    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
-
     std::string version = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Version);
     std::string fallbackText = ParseUtil::GetString(json, AdaptiveCardSchemaKey::FallbackText);
     std::string language = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Language);
 
     if (rendererVersion != std::numeric_limits<double>::max())
     {
-        double versionAsDouble;
-        try
+        CardVersion parsedVersion;
+        if (!CardVersion::TryParse(version, parsedVersion))
         {
-            versionAsDouble = std::stod(version.c_str());
-        }
-        catch (...)
-        {
-            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Card version not valid");
+            ParseUtil::RaiseError(ErrorStatusCode::InvalidPropertyValue, "Card version not valid", AdaptiveCardSchemaKey::Version);
+            return std::make_shared<ParseResult>(nullptr, warnings);
         }
 
-        if (rendererVersion < versionAsDouble)
+        if (parsedVersion.IsNewerThan(rendererVersion))
         {
             if (fallbackText.empty())
             {
@@ -124,25 +273,39 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(
 
     if (elementParserRegistration == nullptr)
     {
-        elementParserRegistration.reset(new ElementParserRegistration());
+        elementParserRegistration = ElementParserRegistration::GetDefault();
     }
     if (actionParserRegistration == nullptr)
     {
-        actionParserRegistration.reset(new ActionParserRegistration());
+        actionParserRegistration = ActionParserRegistration::GetDefault();
     }
 
+    auto result = std::make_shared<AdaptiveCard>(version, fallbackText, backgroundImage, style, speak, language);
+
     // Parse body
-    auto body = ParseUtil::GetElementCollection(elementParserRegistration, actionParserRegistration, json, AdaptiveCardSchemaKey::Body, false);
+    bodyParser(elementParserRegistration, actionParserRegistration,
+        std::shared_ptr<std::vector<std::shared_ptr<BaseCardElement>>>(result, &result->m_body));
     // Parse actions if present
-    auto actions = ParseUtil::GetActionCollection(elementParserRegistration, actionParserRegistration, json, AdaptiveCardSchemaKey::Actions, false);
+    actionsParser(elementParserRegistration, actionParserRegistration,
+        std::shared_ptr<std::vector<std::shared_ptr<BaseActionElement>>>(result, &result->m_actions));
 
-    auto result = std::make_shared<AdaptiveCard>(version, fallbackText, backgroundImage, style, speak, language, body, actions);
-    result->SetLanguage(language);
+    auto parseResult = std::make_shared<ParseResult>(result, warnings);
 
-    // Parse optional selectAction
-    result->SetSelectAction(ParseUtil::GetSelectAction(elementParserRegistration, actionParserRegistration, json, AdaptiveCardSchemaKey::SelectAction, false));
+    // Once both are parsed, propagate the language, parse the optional selectAction and index the body
+    ParseUtil::Defer([=, &json]()
+    {
+        result->SetLanguage(language);
+        result->SetSelectAction(ParseUtil::GetSelectAction(elementParserRegistration, actionParserRegistration, json, AdaptiveCardSchemaKey::SelectAction, false));
+        if (elementParserRegistration->IsIdIndexingEnabled())
+        {
+            for (const auto& warning : result->BuildElementIndex())
+            {
+                parseResult->AddWarning(warning);
+            }
+        }
+    });
 
-    return std::make_shared<ParseResult>(result, warnings);
+    return parseResult;
 }
 
 #ifdef __ANDROID__
@@ -159,7 +322,210 @@ std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(
     std::shared_ptr<ActionParserRegistration> actionParserRegistration)
 #endif // __ANDROID__
 {
-    return AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(jsonString), rendererVersion, elementParserRegistration, actionParserRegistration);
+    return ThrowIfError(TryDeserializeFromString(jsonString, rendererVersion, elementParserRegistration, actionParserRegistration));
+}
+
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringByTopLevelSpans(
+    const std::string& jsonString,
+    double rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration) throw(AdaptiveSharedNamespace::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringByTopLevelSpans(
+    const std::string& jsonString,
+    double rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration)
+#endif // __ANDROID__
+{
+    // Range of a single member ("key": value) or value in jsonString
+    typedef std::pair<const char*, const char*> Span;
+
+    const std::string& bodyPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body);
+    const std::string& actionsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions);
+
+    // Card level properties are reassembled into a small object holding everything except array
+    // valued body and actions, whose items are kept as spans and parsed one at a time later.
+    std::string cardLevelJson = "{";
+    std::vector<Span> bodySpans;
+    std::vector<Span> actionSpans;
+    Span bodyMember;
+    Span actionsMember;
+    bool isBodyArray = false;
+    bool isActionsArray = false;
+
+    JsonScanner scanner(jsonString.data(), jsonString.data() + jsonString.size());
+    if (!scanner.IsAtObject())
+    {
+        // Let the DOM path report non-object roots the same way it always has
+        return Deserialize(ParseUtil::GetJsonValueFromString(jsonString), rendererVersion, elementParserRegistration, actionParserRegistration);
+    }
+
+    scanner.BeginObject();
+    const char* keyBegin;
+    const char* keyEnd;
+    while (scanner.NextMember(keyBegin, keyEnd))
+    {
+        const std::string key = JsonScanner::DecodeKey(keyBegin, keyEnd);
+        const bool isBody = (key == bodyPropertyName);
+        const bool isActions = (key == actionsPropertyName);
+        if ((isBody || isActions) && scanner.IsAtArray())
+        {
+            // As with Json::Reader, a repeated key replaces the earlier value
+            std::vector<Span>& spans = isBody ? bodySpans : actionSpans;
+            spans.clear();
+            scanner.BeginArray();
+            while (scanner.NextElement())
+            {
+                Span span;
+                scanner.SkipValue(span.first, span.second);
+                spans.push_back(span);
+            }
+            (isBody ? isBodyArray : isActionsArray) = true;
+            (isBody ? bodyMember : actionsMember) = Span();
+            continue;
+        }
+
+        const char* valueBegin;
+        const char* valueEnd;
+        scanner.SkipValue(valueBegin, valueEnd);
+        if (isBody || isActions)
+        {
+            // Not an array; keep the last occurrence for the DOM path to validate
+            (isBody ? isBodyArray : isActionsArray) = false;
+            (isBody ? bodyMember : actionsMember) = Span(keyBegin, valueEnd);
+            continue;
+        }
+
+        if (cardLevelJson.size() > 1)
+        {
+            cardLevelJson.push_back(',');
+        }
+        cardLevelJson.append(keyBegin, valueEnd);
+    }
+
+    for (const auto& member : { bodyMember, actionsMember })
+    {
+        if (member.first != nullptr)
+        {
+            if (cardLevelJson.size() > 1)
+            {
+                cardLevelJson.push_back(',');
+            }
+            cardLevelJson.append(member.first, member.second);
+        }
+    }
+    cardLevelJson.push_back('}');
+
+    Json::Value cardLevelValue = JsonScanner::ParseValue(cardLevelJson.data(), cardLevelJson.data() + cardLevelJson.size());
+
+    return ParseCard(cardLevelValue, rendererVersion, elementParserRegistration, actionParserRegistration,
+        [&](std::shared_ptr<ElementParserRegistration> elementParsers, std::shared_ptr<ActionParserRegistration> actionParsers,
+            std::shared_ptr<std::vector<std::shared_ptr<BaseCardElement>>> elements)
+        {
+            if (!isBodyArray)
+            {
+                ParseUtil::GetElementCollection(elementParsers, actionParsers, cardLevelValue, AdaptiveCardSchemaKey::Body, false, elements);
+                return;
+            }
+
+            elements->reserve(bodySpans.size());
+            for (const auto& span : bodySpans)
+            {
+                // Each element is parsed completely while its JSON is alive
+                const Json::Value elementJson = JsonScanner::ParseValue(span.first, span.second);
+                CardTraversal::RunNow([&]()
+                {
+                    elements->push_back(ParseUtil::GetElementFromJsonValue(elementParsers, actionParsers, elementJson));
+                });
+            }
+        },
+        [&](std::shared_ptr<ElementParserRegistration> elementParsers, std::shared_ptr<ActionParserRegistration> actionParsers,
+            std::shared_ptr<std::vector<std::shared_ptr<BaseActionElement>>> actions)
+        {
+            if (!isActionsArray)
+            {
+                ParseUtil::GetActionCollection(elementParsers, actionParsers, cardLevelValue, AdaptiveCardSchemaKey::Actions, false, actions);
+                return;
+            }
+
+            actions->reserve(actionSpans.size());
+            for (const auto& span : actionSpans)
+            {
+                const Json::Value actionJson = JsonScanner::ParseValue(span.first, span.second);
+                CardTraversal::RunNow([&]()
+                {
+                    auto action = ParseUtil::GetActionFromJsonValue(elementParsers, actionParsers, actionJson);
+                    if (action != nullptr)
+                    {
+                        actions->push_back(action);
+                    }
+                });
+            }
+        });
+}
+
+CardProbe AdaptiveCard::Probe(const std::string& jsonString)
+{
+    CardProbe probe;
+    JsonScanner scanner(jsonString.data(), jsonString.data() + jsonString.size());
+    scanner.BeginObject();
+
+    const char* keyBegin;
+    const char* keyEnd;
+    while (scanner.NextMember(keyBegin, keyEnd))
+    {
+        const std::string key = JsonScanner::DecodeKey(keyBegin, keyEnd);
+        std::string* value = nullptr;
+        AdaptiveCardSchemaKey schemaKey;
+        if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version))
+        {
+            value = &probe.version;
+            schemaKey = AdaptiveCardSchemaKey::Version;
+        }
+        else if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText))
+        {
+            value = &probe.fallbackText;
+            schemaKey = AdaptiveCardSchemaKey::FallbackText;
+        }
+        else if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language))
+        {
+            value = &probe.language;
+            schemaKey = AdaptiveCardSchemaKey::Language;
+        }
+        else if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Speak))
+        {
+            value = &probe.speak;
+            schemaKey = AdaptiveCardSchemaKey::Speak;
+        }
+
+        const char* valueBegin;
+        const char* valueEnd;
+        scanner.SkipValue(valueBegin, valueEnd);
+        if (value == nullptr)
+        {
+            continue;
+        }
+
+        // Null counts as absent, as it does for ParseUtil::GetString; a repeated key keeps its last value
+        if (*valueBegin == '"')
+        {
+            *value = JsonScanner::DecodeKey(valueBegin, valueEnd);
+        }
+        else if (std::string(valueBegin, valueEnd) == "null")
+        {
+            value->clear();
+        }
+        else
+        {
+            const std::string& propertyName = AdaptiveCardSchemaKeyToString(schemaKey);
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Value for property " + propertyName + " was invalid. Expected type string.");
+        }
+    }
+
+    probe.hasValidVersion = CardVersion::TryParse(probe.version, probe.parsedVersion);
+    return probe;
 }
 
 Json::Value AdaptiveCard::SerializeToJsonValue()
@@ -216,10 +582,53 @@ std::shared_ptr<AdaptiveCard> AdaptiveCard::MakeFallbackTextCard(
     return fallbackCard;
 }
 
+void AdaptiveCard::SerializeToWriter(CardWriter& writer)
+{
+    writer.BeginObject();
+    writer.WriteProperty(AdaptiveCardSchemaKey::Type, CardElementTypeToString(CardElementType::AdaptiveCard));
+    writer.WriteProperty(AdaptiveCardSchemaKey::Version, GetVersion());
+    writer.WriteProperty(AdaptiveCardSchemaKey::FallbackText, GetFallbackText());
+    writer.WriteProperty(AdaptiveCardSchemaKey::BackgroundImage, GetBackgroundImage());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Speak, GetSpeak());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Language, GetLanguage());
+
+    ContainerStyle style = GetStyle();
+    if (style != ContainerStyle::None)
+    {
+        writer.WriteProperty(AdaptiveCardSchemaKey::Style, ContainerStyleToString(style));
+    }
+
+    writer.WriteKey(AdaptiveCardSchemaKey::Body);
+    writer.BeginArray();
+    for (const auto& cardElement : GetBody())
+    {
+        CardTraversal::Schedule([&writer, cardElement = cardElement.get()]() { cardElement->SerializeToWriter(writer); });
+    }
+
+    CardTraversal::Schedule([&writer, this]()
+    {
+        writer.EndArray();
+
+        writer.WriteKey(AdaptiveCardSchemaKey::Actions);
+        writer.BeginArray();
+        for (const auto& action : GetActions())
+        {
+            CardTraversal::Schedule([&writer, action = action.get()]() { action->SerializeToWriter(writer); });
+        }
+
+        CardTraversal::Schedule([&writer]()
+        {
+            writer.EndArray();
+            writer.EndObject();
+        });
+    });
+}
+
 std::string AdaptiveCard::Serialize()
 {
-    Json::FastWriter writer;
-    return writer.write(SerializeToJsonValue());
+    CardWriter writer;
+    CardTraversal::RunNow([this, &writer]() { SerializeToWriter(writer); });
+    return writer.GetString();
 }
 
 std::string AdaptiveCard::GetVersion() const
@@ -282,18 +691,11 @@ void AdaptiveCard::SetLanguage(const std::string& value)
     m_language = value;
     // Propagate language to ColumnSet, Containers, TextBlocks and showCardActions
     PropagateLanguage(value, m_body);
-
-    for (auto& actionElement : m_actions)
+    for (const auto& action : m_actions)
     {
-        if (actionElement->GetElementType() == ActionType::ShowCard)
-        {
-            auto showCard = std::static_pointer_cast<ShowCardAction>(actionElement);
-            if (showCard != nullptr)
-            {
-                showCard->SetLanguage(value);
-            }
-        }
+        PropagateLanguage(value, action);
     }
+    PropagateLanguage(value, m_selectAction);
 }
 
 const CardElementType AdaptiveCard::GetElementType() const
@@ -324,22 +726,285 @@ void AdaptiveCard::SetSelectAction(const std::shared_ptr<BaseActionElement> acti
 std::vector<std::string> AdaptiveCards::AdaptiveCard::GetResourceUris()
 {
     auto uriVector = std::vector<std::string>();
+    CardTraversal::RunNow([this, &uriVector]() { GetResourceUris(uriVector); });
+    return uriVector;
+}
 
+void AdaptiveCards::AdaptiveCard::GetResourceUris(std::vector<std::string>& resourceUris)
+{
     auto backgroundImage = GetBackgroundImage();
     if (!backgroundImage.empty())
     {
-        uriVector.push_back(backgroundImage);
+        resourceUris.push_back(backgroundImage);
     }
 
-    for (auto item : m_body)
+    for (const auto& item : m_body)
     {
-        item->GetResourceUris(uriVector);
+        CardTraversal::Schedule([&resourceUris, item = item.get()]() { item->GetResourceUris(resourceUris); });
     }
 
-    for (auto item : m_actions)
+    for (const auto& item : m_actions)
     {
-        item->GetResourceUris(uriVector);
+        CardTraversal::Schedule([&resourceUris, item = item.get()]() { item->GetResourceUris(resourceUris); });
     }
 
-    return uriVector;
+    if (m_selectAction != nullptr)
+    {
+        CardTraversal::Schedule([&resourceUris, item = m_selectAction.get()]() { item->GetResourceUris(resourceUris); });
+    }
+}
+
+ResourceManifest AdaptiveCard::GetResourceManifest(const HostConfig& hostConfig)
+{
+    return ResourceManifest::Build(*this, hostConfig);
+}
+
+namespace
+{
+    // Walks the body in document order, for cards without an index, until visit(element, parent)
+    // returns true. The parent is null for elements of the body itself.
+    template <typename Visit>
+    bool VisitBody(const std::vector<std::shared_ptr<BaseCardElement>>& body, Visit visit)
+    {
+        std::vector<std::pair<std::shared_ptr<BaseCardElement>, std::shared_ptr<BaseCardElement>>> pending;
+        for (auto item = body.rbegin(); item != body.rend(); ++item)
+        {
+            pending.emplace_back(*item, nullptr);
+        }
+
+        std::vector<std::shared_ptr<BaseCardElement>> children;
+        while (!pending.empty())
+        {
+            auto current = std::move(pending.back());
+            pending.pop_back();
+            if (visit(current.first, current.second))
+            {
+                return true;
+            }
+
+            children.clear();
+            ElementIdIndex::GetChildren(*current.first, children);
+            for (auto child = children.rbegin(); child != children.rend(); ++child)
+            {
+                pending.emplace_back(std::move(*child), current.first);
+            }
+        }
+        return false;
+    }
+
+    template <typename T>
+    void InsertAt(std::vector<std::shared_ptr<T>>& collection, size_t position, const std::shared_ptr<T>& element)
+    {
+        collection.insert(collection.begin() + std::min(position, collection.size()), element);
+    }
+
+    template <typename T>
+    void EraseFrom(std::vector<std::shared_ptr<T>>& collection, const BaseCardElement* element)
+    {
+        collection.erase(std::find_if(collection.begin(), collection.end(),
+            [element](const std::shared_ptr<T>& item) { return item.get() == element; }));
+    }
+
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> MakeDuplicateIdWarnings(const std::vector<std::string>& duplicateIds)
+    {
+        std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+        for (const auto& id : duplicateIds)
+        {
+            warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::DuplicateId,
+                "Element id \"" + id + "\" is used by more than one element"));
+        }
+        return warnings;
+    }
+
+    void ThrowIfNotA(CardElementType expectedType, const std::shared_ptr<BaseCardElement>& element)
+    {
+        if (element->GetElementType() != expectedType)
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
+                "Expected an element of type " + CardElementTypeToString(expectedType));
+        }
+    }
+}
+
+std::shared_ptr<const ElementIdIndex> AdaptiveCard::GetElementIndex() const
+{
+    return m_elementIndex;
+}
+
+std::vector<std::shared_ptr<AdaptiveCardParseWarning>> AdaptiveCard::BuildElementIndex()
+{
+    std::vector<std::string> duplicateIds;
+    auto index = std::make_shared<ElementIdIndex>();
+    for (const auto& element : m_body)
+    {
+        index->Add(element, nullptr, m_body, duplicateIds);
+    }
+    m_elementIndex = index;
+    return MakeDuplicateIdWarnings(duplicateIds);
+}
+
+std::shared_ptr<BaseCardElement> AdaptiveCard::GetElementById(const std::string& id) const
+{
+    if (m_elementIndex != nullptr)
+    {
+        return m_elementIndex->GetElement(id);
+    }
+
+    std::shared_ptr<BaseCardElement> match;
+    VisitBody(m_body, [&id, &match](const std::shared_ptr<BaseCardElement>& element, const std::shared_ptr<BaseCardElement>&)
+    {
+        if (element->GetId() != id)
+        {
+            return false;
+        }
+        match = element;
+        return true;
+    });
+    return match;
+}
+
+std::vector<std::shared_ptr<AdaptiveCardParseWarning>> AdaptiveCard::InsertElement(
+    const std::shared_ptr<BaseCardElement>& parent, size_t position, const std::shared_ptr<BaseCardElement>& element)
+{
+    // The element and everything under it must be new to the card, and must not contain the parent
+    std::unordered_set<const BaseCardElement*> inserted;
+    std::vector<std::string> insertedIds;
+    VisitBody(std::vector<std::shared_ptr<BaseCardElement>>{ element },
+        [&inserted, &insertedIds](const std::shared_ptr<BaseCardElement>& current, const std::shared_ptr<BaseCardElement>&)
+    {
+        inserted.insert(current.get());
+        insertedIds.push_back(current->GetId());
+        return false;
+    });
+    if (inserted.count(parent.get()) != 0)
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "An element cannot be inserted into itself");
+    }
+
+    // Without an index, the walk that looks for the inserted elements also counts the ids they use
+    std::unordered_map<std::string, size_t> idCounts;
+    for (const auto& id : insertedIds)
+    {
+        if (!id.empty())
+        {
+            idCounts.emplace(id, 0);
+        }
+    }
+    const bool isInCard = (m_elementIndex != nullptr) ?
+        std::any_of(inserted.begin(), inserted.end(), [this](const BaseCardElement* current) { return m_elementIndex->Contains(current); }) :
+        VisitBody(m_body, [&inserted, &idCounts](const std::shared_ptr<BaseCardElement>& current, const std::shared_ptr<BaseCardElement>&)
+        {
+            auto idCount = idCounts.find(current->GetId());
+            if (idCount != idCounts.end())
+            {
+                ++idCount->second;
+            }
+            return inserted.count(current.get()) != 0;
+        });
+    if (isInCard)
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "The element is already in the card");
+    }
+
+    if (parent == nullptr)
+    {
+        InsertAt(m_body, position, element);
+    }
+    else
+    {
+        switch (parent->GetElementType())
+        {
+        case CardElementType::Container:
+            InsertAt(std::static_pointer_cast<Container>(parent)->GetItems(), position, element);
+            break;
+        case CardElementType::Column:
+            InsertAt(std::static_pointer_cast<Column>(parent)->GetItems(), position, element);
+            break;
+        case CardElementType::ColumnSet:
+            ThrowIfNotA(CardElementType::Column, element);
+            InsertAt(std::static_pointer_cast<ColumnSet>(parent)->GetColumns(), position, std::static_pointer_cast<Column>(element));
+            break;
+        case CardElementType::ImageSet:
+            ThrowIfNotA(CardElementType::Image, element);
+            InsertAt(std::static_pointer_cast<ImageSet>(parent)->GetImages(), position, std::static_pointer_cast<Image>(element));
+            break;
+        default:
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
+                "Elements of type " + parent->GetElementTypeString() + " have no children");
+        }
+    }
+
+    std::vector<std::string> duplicateIds;
+    if (m_elementIndex != nullptr)
+    {
+        m_elementIndex->Add(element, parent.get(), m_body, duplicateIds);
+    }
+    else
+    {
+        for (const auto& id : insertedIds)
+        {
+            if (!id.empty() && idCounts[id]++ != 0)
+            {
+                duplicateIds.push_back(id);
+            }
+        }
+    }
+    return MakeDuplicateIdWarnings(duplicateIds);
+}
+
+bool AdaptiveCard::RemoveElement(const std::shared_ptr<BaseCardElement>& element)
+{
+    std::shared_ptr<BaseCardElement> parent;
+    if (m_elementIndex != nullptr)
+    {
+        if (!m_elementIndex->Contains(element.get()))
+        {
+            return false;
+        }
+        parent = m_elementIndex->GetParent(element.get());
+        m_elementIndex->Remove(element.get());
+    }
+    else if (!VisitBody(m_body, [&element, &parent](const std::shared_ptr<BaseCardElement>& current, const std::shared_ptr<BaseCardElement>& currentParent)
+        {
+            parent = currentParent;
+            return current == element;
+        }))
+    {
+        return false;
+    }
+
+    if (parent == nullptr)
+    {
+        EraseFrom(m_body, element.get());
+        return true;
+    }
+
+    switch (parent->GetElementType())
+    {
+    case CardElementType::Container:
+        EraseFrom(std::static_pointer_cast<Container>(parent)->GetItems(), element.get());
+        break;
+    case CardElementType::Column:
+        EraseFrom(std::static_pointer_cast<Column>(parent)->GetItems(), element.get());
+        break;
+    case CardElementType::ColumnSet:
+        EraseFrom(std::static_pointer_cast<ColumnSet>(parent)->GetColumns(), element.get());
+        break;
+    case CardElementType::ImageSet:
+        EraseFrom(std::static_pointer_cast<ImageSet>(parent)->GetImages(), element.get());
+        break;
+    default:
+        break;
+    }
+    return true;
+}
+
+void AdaptiveCard::SetElementId(const std::shared_ptr<BaseCardElement>& element, const std::string& id)
+{
+    const std::string oldId = element->GetId();
+    element->SetId(id);
+    if (m_elementIndex != nullptr && m_elementIndex->Contains(element.get()))
+    {
+        m_elementIndex->UpdateId(element.get(), oldId, m_body);
+    }
 }
@@ -5,6 +5,9 @@
 #include "Enums.h"
 #include "pch.h"
 #include "ParseResult.h"
+#include "CardProbe.h"
+#include "ElementIdIndex.h"
+#include "ResourceManifest.h"
 
 AdaptiveSharedNamespaceStart
 class Container;
@@ -29,6 +32,7 @@ public:
         std::string language,
         std::vector<std::shared_ptr<BaseCardElement>>& body,
         std::vector<std::shared_ptr<BaseActionElement>>& actions);
+    ~AdaptiveCard();
 
     std::string GetVersion() const;
     void SetVersion(const std::string value);
@@ -50,6 +54,35 @@ public:
     std::vector<std::shared_ptr<BaseActionElement>>& GetActions();
 
     std::vector<std::string> GetResourceUris();
+    void GetResourceUris(std::vector<std::string>& resourceUris);
+
+    // The resources of the card once each, with their kind, expected size and prefetch priority.
+    // Unlike GetResourceUris, it includes the icons of actions.
+    ResourceManifest GetResourceManifest(const HostConfig& hostConfig);
+
+    // Index of the elements of the body by id. Built while parsing if the element parser
+    // registration enables it, or by BuildElementIndex, and null otherwise.
+    std::shared_ptr<const ElementIdIndex> GetElementIndex() const;
+
+    // Indexes the body as it is now, returning a WarningStatusCode::DuplicateId warning for each
+    // element whose id is already used by an element before it
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> BuildElementIndex();
+
+    // Looks the element up in the index if there is one, and walks the body otherwise
+    std::shared_ptr<BaseCardElement> GetElementById(const std::string& id) const;
+
+    // Change the body and keep the index, if any, up to date. The parent is null for the body
+    // itself, or a Container, Column, ColumnSet (of Columns) or ImageSet (of Images); anything
+    // else throws. Elements are inserted before position, or at the end if it is past the end.
+    // Inserting an element that is already in the card, or that has one already in the card
+    // under it, throws. The result holds a WarningStatusCode::DuplicateId warning for each of
+    // the inserted elements whose id is already used, as BuildElementIndex does; lookups by that
+    // id still find the first element with it in document order.
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> InsertElement(
+        const std::shared_ptr<BaseCardElement>& parent, size_t position, const std::shared_ptr<BaseCardElement>& element);
+    // Returns false if the element is not in the body
+    bool RemoveElement(const std::shared_ptr<BaseCardElement>& element);
+    void SetElementId(const std::shared_ptr<BaseCardElement>& element, const std::string& id);
 
     const CardElementType GetElementType() const;
 #ifdef __ANDROID__
@@ -65,6 +98,10 @@ public:
         double rendererVersion,
         std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
         std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr) throw(AdaptiveSharedNamespace::AdaptiveCardParseException);
+    static std::shared_ptr<ParseResult> DeserializeFromStringByTopLevelSpans(const std::string& jsonString,
+        double rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr) throw(AdaptiveSharedNamespace::AdaptiveCardParseException);
     static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(
         const std::string& fallbackText,
         const std::string& language) throw(AdaptiveSharedNamespace::AdaptiveCardParseException);
@@ -85,15 +122,80 @@ public:
         std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
         std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr);
 
+    // Produces the same result as DeserializeFromString without building a Json::Value for the
+    // whole payload. This is top-level span splitting, not a streaming parse: the payload is scanned
+    // for the byte range of each item of the card's body and actions, and each item is then parsed
+    // into a Json::Value of its own and handed to the registered parser, one at a time. Peak memory
+    // is bounded by the largest top-level item rather than by the whole card, so use it for large
+    // cards with many top-level items; it does not help cards that nest everything in one container.
+    static std::shared_ptr<ParseResult> DeserializeFromStringByTopLevelSpans(const std::string& jsonString,
+        double rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr);
+
     static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(
         const std::string& fallbackText,
         const std::string& language);
 
 #endif // __ANDROID__
+
+    // Non-throwing counterparts of Deserialize and DeserializeFromString, which are wrappers over
+    // them. A card that fails to parse yields a result with a null card and a GetError() holding
+    // the status code, reason and JSON path of the first problem, along with the warnings raised
+    // before it. The built-in parsers raise no exceptions on this path; exceptions thrown by
+    // custom parsers are caught and reported the same way.
+    static std::shared_ptr<ParseResult> TryDeserialize(const Json::Value& json,
+        double rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr);
+
+    static std::shared_ptr<ParseResult> TryDeserializeFromString(const std::string& jsonString,
+        double rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr);
+
+    // As above, stopping with ErrorStatusCode::ParseLimitExceeded as soon as the card goes past
+    // one of the given limits. The result's GetStatistics() shows how far parsing got.
+    static std::shared_ptr<ParseResult> TryDeserialize(const Json::Value& json,
+        double rendererVersion,
+        const ParseLimits& limits,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr);
+
+    static std::shared_ptr<ParseResult> TryDeserializeFromString(const std::string& jsonString,
+        double rendererVersion,
+        const ParseLimits& limits,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr);
+
+    // Reads only the card level version, fallbackText, lang and speak of a payload, skipping over
+    // everything else without building it, so that hosts can decide how to handle a card before
+    // paying for a full parse. Throws AdaptiveCardParseException if the payload is not a JSON
+    // object or one of these properties is not a string.
+    static CardProbe Probe(const std::string& jsonString);
+
     Json::Value SerializeToJsonValue();
+    void SerializeToWriter(CardWriter& writer);
     std::string Serialize();
 
 private:
+    typedef std::function<void(std::shared_ptr<ElementParserRegistration>, std::shared_ptr<ActionParserRegistration>,
+        std::shared_ptr<std::vector<std::shared_ptr<BaseCardElement>>>)> BodyParser;
+    typedef std::function<void(std::shared_ptr<ElementParserRegistration>, std::shared_ptr<ActionParserRegistration>,
+        std::shared_ptr<std::vector<std::shared_ptr<BaseActionElement>>>)> ActionsParser;
+
+    static std::shared_ptr<ParseResult> ThrowIfError(std::shared_ptr<ParseResult> result);
+
+    // Parses the card level properties from json and delegates body and actions to the given parsers.
+    // Inside a CardTraversal the card is returned before its contents are parsed; see ParseUtil::Defer.
+    static std::shared_ptr<ParseResult> ParseCard(
+        const Json::Value& json,
+        double rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration,
+        const BodyParser& bodyParser,
+        const ActionsParser& actionsParser);
+
     std::string m_version;
     std::string m_fallbackText;
     std::string m_backgroundImage;
@@ -105,5 +207,7 @@ private:
     std::vector<std::shared_ptr<BaseActionElement>> m_actions;
 
     std::shared_ptr<BaseActionElement> m_selectAction;
+
+    std::shared_ptr<ElementIdIndex> m_elementIndex;
 };
 AdaptiveSharedNamespaceEnd
\ No newline at end of file
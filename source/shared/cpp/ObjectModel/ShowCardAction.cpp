@@ -2,35 +2,317 @@
 #include "SharedAdaptiveCard.h"
 #include "ParseUtil.h"
 #include "ShowCardAction.h"
+#include "CardTraversal.h"
 
 using namespace AdaptiveSharedNamespace;
 
+namespace
+{
+    // Reads an optional string property the way ParseUtil::GetString does. Returns false for
+    // values GetString would raise an error for.
+    bool TryGetString(const Json::Value& json, AdaptiveCardSchemaKey key, std::string& value)
+    {
+        value.clear();
+        const Json::Value* propertyValue = ParseUtil::FindValue(json, key);
+        if (propertyValue == nullptr || propertyValue->empty())
+        {
+            return true;
+        }
+
+        if (!propertyValue->isString())
+        {
+            return false;
+        }
+
+        value = propertyValue->asString();
+        return true;
+    }
+
+    // Gathers from the JSON of a card the resource URIs that AdaptiveCard::GetResourceUris would
+    // return once the card is parsed. Gives up, returning false, on anything only the parsed card
+    // can answer for: elements and actions of custom types, and properties that would fail to parse.
+    class ResourceUriGatherer
+    {
+    public:
+        ResourceUriGatherer(
+            std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+            std::shared_ptr<ActionParserRegistration> actionParserRegistration) :
+            m_elementParserRegistration(elementParserRegistration),
+            m_actionParserRegistration(actionParserRegistration),
+            m_isComplete(true)
+        {
+        }
+
+        bool Gather(const Json::Value& cardJson, std::vector<std::string>& resourceUris)
+        {
+            CardTraversal::RunNow([this, &cardJson]() { GatherFromCard(cardJson); });
+            if (m_isComplete)
+            {
+                resourceUris.insert(resourceUris.end(), m_resourceUris.begin(), m_resourceUris.end());
+            }
+            return m_isComplete;
+        }
+
+    private:
+        void GatherFromCard(const Json::Value& json)
+        {
+            std::string backgroundImage;
+            if (!TryGetString(json, AdaptiveCardSchemaKey::BackgroundImageUrl, backgroundImage) ||
+                (backgroundImage.empty() && !TryGetString(json, AdaptiveCardSchemaKey::BackgroundImage, backgroundImage)))
+            {
+                m_isComplete = false;
+                return;
+            }
+
+            if (!backgroundImage.empty())
+            {
+                m_resourceUris.push_back(backgroundImage);
+            }
+
+            ScheduleCollection(json, AdaptiveCardSchemaKey::Body, &ResourceUriGatherer::GatherFromElement);
+            ScheduleCollection(json, AdaptiveCardSchemaKey::Actions, &ResourceUriGatherer::GatherFromAction);
+        }
+
+        void GatherFromElement(const Json::Value& json)
+        {
+            std::string type;
+            if (!TryGetType(json, type))
+            {
+                return;
+            }
+
+            if (!ElementParserRegistration::IsKnownType(type))
+            {
+                // Unknown types parse into UnknownElement, which has no resources
+                m_isComplete = m_isComplete && (m_elementParserRegistration->GetParser(type) == nullptr);
+                return;
+            }
+
+            switch (CardElementTypeFromString(type))
+            {
+            case CardElementType::Image:
+                GatherFromImage(json);
+                break;
+            case CardElementType::ImageSet:
+                ScheduleCollection(json, AdaptiveCardSchemaKey::Images, &ResourceUriGatherer::GatherFromImage);
+                break;
+            case CardElementType::Container:
+                ScheduleCollection(json, AdaptiveCardSchemaKey::Items, &ResourceUriGatherer::GatherFromElement);
+                break;
+            case CardElementType::ColumnSet:
+                ScheduleCollection(json, AdaptiveCardSchemaKey::Columns, &ResourceUriGatherer::GatherFromColumn);
+                break;
+            default:
+                break;
+            }
+        }
+
+        void GatherFromColumn(const Json::Value& json)
+        {
+            if (!json.isObject())
+            {
+                m_isComplete = false;
+                return;
+            }
+
+            ScheduleCollection(json, AdaptiveCardSchemaKey::Items, &ResourceUriGatherer::GatherFromElement);
+        }
+
+        // Image sets hold their elements as images, so anything else is left to the parsed card
+        void GatherFromImage(const Json::Value& json)
+        {
+            std::string type;
+            std::string url;
+            if (!TryGetType(json, type) ||
+                CardElementTypeFromString(type) != CardElementType::Image ||
+                !TryGetString(json, AdaptiveCardSchemaKey::Url, url) ||
+                url.empty())
+            {
+                m_isComplete = false;
+                return;
+            }
+
+            m_resourceUris.push_back(url);
+        }
+
+        void GatherFromAction(const Json::Value& json)
+        {
+            std::string type;
+            if (!TryGetType(json, type))
+            {
+                return;
+            }
+
+            if (!ActionParserRegistration::IsKnownType(type))
+            {
+                // Actions of unknown types are dropped by the parser
+                m_isComplete = m_isComplete && (m_actionParserRegistration->GetParser(type) == nullptr);
+                return;
+            }
+
+            if (ActionTypeFromString(type) == ActionType::ShowCard)
+            {
+                const Json::Value* cardJson = ParseUtil::FindValue(json, AdaptiveCardSchemaKey::Card);
+                if (cardJson == nullptr || !cardJson->isObject())
+                {
+                    m_isComplete = false;
+                    return;
+                }
+
+                GatherFromCard(*cardJson);
+            }
+        }
+
+        bool TryGetType(const Json::Value& json, std::string& type)
+        {
+            const Json::Value* typeValue = ParseUtil::FindValue(json, AdaptiveCardSchemaKey::Type);
+            if (typeValue == nullptr || !typeValue->isString() || typeValue->asString().empty())
+            {
+                m_isComplete = false;
+                return false;
+            }
+
+            type = typeValue->asString();
+            return true;
+        }
+
+        void ScheduleCollection(const Json::Value& json, AdaptiveCardSchemaKey key, void (ResourceUriGatherer::*gather)(const Json::Value&))
+        {
+            const Json::Value* collection = ParseUtil::FindValue(json, key);
+            if (collection == nullptr || collection->isNull())
+            {
+                return;
+            }
+
+            if (!collection->isArray())
+            {
+                m_isComplete = false;
+                return;
+            }
+
+            for (const auto& item : *collection)
+            {
+                CardTraversal::Schedule([this, gather, &item]()
+                {
+                    if (m_isComplete)
+                    {
+                        (this->*gather)(item);
+                    }
+                });
+            }
+        }
+
+        std::shared_ptr<ElementParserRegistration> m_elementParserRegistration;
+        std::shared_ptr<ActionParserRegistration> m_actionParserRegistration;
+        std::vector<std::string> m_resourceUris;
+        bool m_isComplete;
+    };
+}
+
 ShowCardAction::ShowCardAction() : BaseActionElement(ActionType::ShowCard)
 {
-    PopulateKnownPropertiesSet();
+}
+
+ShowCardAction::~ShowCardAction()
+{
+    CardTraversal::Release(std::move(m_card));
 }
 
 Json::Value ShowCardAction::SerializeToJsonValue()
 {
     Json::Value root = BaseActionElement::SerializeToJsonValue();
 
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)] = GetCard()->SerializeToJsonValue();
+    // a card that failed its deferred parse is written back as it was read
+    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)] = (GetCardParseError() != nullptr) ?
+        ParseUtil::GetJsonValueFromString(m_deferredCard->json) :
+        GetCard()->SerializeToJsonValue();
 
     return root;
 }
 
+void ShowCardAction::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(ShowCardAction)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseActionElement::SerializeProperties(writer);
+
+    writer.WriteKey(AdaptiveCardSchemaKey::Card);
+    if (GetCardParseError() != nullptr)
+    {
+        writer.WriteValue(ParseUtil::GetJsonValueFromString(m_deferredCard->json));
+        writer.EndObject();
+        return;
+    }
+
+    GetCard()->SerializeToWriter(writer);
+    CardTraversal::Schedule([&writer]() { writer.EndObject(); });
+}
+
 std::shared_ptr<AdaptiveCard> ShowCardAction::GetCard() const
 {
+    if (m_deferredCard != nullptr)
+    {
+        std::call_once(m_deferredCard->parseFlag, [this]()
+        {
+            DeferredCard& deferredCard = *m_deferredCard;
+            auto parseResult = AdaptiveCard::TryDeserializeFromString(deferredCard.json, std::numeric_limits<double>::max(),
+                deferredCard.limits, deferredCard.elementParserRegistration, deferredCard.actionParserRegistration);
+            std::shared_ptr<AdaptiveCardParseError> error = parseResult->GetError();
+            if (error != nullptr)
+            {
+                deferredCard.error = error;
+                m_card = std::make_shared<AdaptiveCard>();
+                deferredCard.isParsed = true;
+                return;
+            }
+
+            std::shared_ptr<AdaptiveCard> card = parseResult->GetAdaptiveCard();
+            if (!deferredCard.language.empty() && card->GetLanguage().empty())
+            {
+                card->SetLanguage(deferredCard.language);
+            }
+            m_card = card;
+            deferredCard.isParsed = true;
+        });
+    }
     return m_card;
 }
 
+std::shared_ptr<AdaptiveCardParseError> ShowCardAction::GetCardParseError() const
+{
+    if (m_deferredCard == nullptr)
+    {
+        return nullptr;
+    }
+
+    GetCard();
+    return m_deferredCard->error;
+}
+
 void ShowCardAction::SetCard(const std::shared_ptr<AdaptiveCard> card)
 {
     m_card = card;
+    m_deferredCard = nullptr;
+}
+
+bool ShowCardAction::IsCardDeferred() const
+{
+    return m_deferredCard != nullptr && !m_deferredCard->isParsed;
 }
 
 void ShowCardAction::SetLanguage(const std::string& value)
 {
+    // Kept for a deferred card until it is parsed
+    if (IsCardDeferred())
+    {
+        m_deferredCard->language = value;
+        return;
+    }
+
     // If the card inside doesn't specify language, propagate
     if (m_card->GetLanguage().empty())
     {
@@ -45,8 +327,40 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::Deserialize(
 {
     std::shared_ptr<ShowCardAction> showCardAction = BaseActionElement::Deserialize<ShowCardAction>(json);
 
-    std::string propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card);
-    showCardAction->SetCard(AdaptiveCard::Deserialize(json.get(propertyName, Json::Value()), std::numeric_limits<double>::max(), elementParserRegistration, actionParserRegistration)->GetAdaptiveCard());
+    // Shares the error scope of the card being parsed, if any, so failures report their full path.
+    // Outside one, RaiseError throws as the other parsers do.
+    ParseUtil::JsonPathSegment cardSegment(AdaptiveCardSchemaKey::Card);
+    ParseUtil::NestingScope showCardScope(true);
+    if (ParseUtil::HasError())
+    {
+        return nullptr;
+    }
+
+    // The card is parsed after the rest of the action, as the elements of a collection are
+    const Json::Value& cardJson = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Card);
+    if (actionParserRegistration->IsShowCardParsingDeferred() && cardJson.isObject())
+    {
+        // Compact JSON text takes far less memory than either the Json::Value or the parsed card
+        auto deferredCard = std::make_shared<ShowCardAction::DeferredCard>();
+        deferredCard->json = Json::FastWriter().write(cardJson);
+        deferredCard->elementParserRegistration = elementParserRegistration;
+        deferredCard->actionParserRegistration = actionParserRegistration;
+        deferredCard->limits = ParseUtil::GetLimits();
+        deferredCard->isParsed = false;
+        showCardAction->m_deferredCard = deferredCard;
+        return showCardAction;
+    }
+
+    ParseUtil::Defer([=, &cardJson]()
+    {
+        auto parseResult = AdaptiveCard::TryDeserialize(cardJson, std::numeric_limits<double>::max(), elementParserRegistration, actionParserRegistration);
+        std::shared_ptr<AdaptiveCardParseError> error = parseResult->GetError();
+        if (error != nullptr)
+        {
+            ParseUtil::RaiseError(error->GetStatusCode(), error->GetReason());
+        }
+        showCardAction->SetCard(parseResult->GetAdaptiveCard());
+    });
 
     return showCardAction;
 }
@@ -59,15 +373,28 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::DeserializeFromString(
     return ShowCardActionParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void ShowCardAction::PopulateKnownPropertiesSet() 
+const KnownPropertySet& ShowCardAction::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card));
+    static const KnownPropertySet knownProperties(BaseActionElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Card
+    });
+    return knownProperties;
 }
 
 void ShowCardAction::GetResourceUris(std::vector<std::string>& resourceUris)
 {
+    // A deferred card is gathered from its JSON when possible, rather than parsed for it
+    if (IsCardDeferred())
+    {
+        const Json::Value cardJson = ParseUtil::GetJsonValueFromString(m_deferredCard->json);
+        ResourceUriGatherer gatherer(m_deferredCard->elementParserRegistration, m_deferredCard->actionParserRegistration);
+        if (gatherer.Gather(cardJson, resourceUris))
+        {
+            return;
+        }
+    }
+
     auto card = GetCard();
-    auto showCardImages = card->GetResourceUris();
-    resourceUris.insert(resourceUris.end(), showCardImages.begin(), showCardImages.end());
+    card->GetResourceUris(resourceUris);
     return;
 }
\ No newline at end of file
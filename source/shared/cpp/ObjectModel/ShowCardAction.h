@@ -5,26 +5,58 @@
 #include "BaseActionElement.h"
 #include "Enums.h"
 #include "ActionParserRegistration.h"
+#include "ParseLimits.h"
+#include <atomic>
+#include <mutex>
 
 AdaptiveSharedNamespaceStart
 class ShowCardAction : public BaseActionElement
 {
 public:
     ShowCardAction();
+    ~ShowCardAction();
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
+    // With deferred parsing (see ActionParserRegistration::SetShowCardParsingDeferred) the card is
+    // parsed on the first call, which may come from any thread. It does not throw: a card that fails
+    // to parse is returned as an empty card, so renderers show nothing for it, and the failure is
+    // reported by GetCardParseError.
     std::shared_ptr<AdaptiveSharedNamespace::AdaptiveCard> GetCard() const;
+    // The error the deferred parse of the card failed with, parsing it if it has not been yet, or
+    // nullptr if it parsed or was not deferred
+    std::shared_ptr<AdaptiveCardParseError> GetCardParseError() const;
     void SetCard(const std::shared_ptr<AdaptiveSharedNamespace::AdaptiveCard>);
 
     void SetLanguage(const std::string& value);
 
+    // True until the card of a deferred parse has been parsed
+    bool IsCardDeferred() const;
+
     virtual void GetResourceUris(std::vector<std::string>& resourceUris) override;
 
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
+
 private:
-    void PopulateKnownPropertiesSet();
+    friend class ShowCardActionParser;
+
+    // The JSON of a card whose parsing was deferred, with what is needed to parse it later
+    struct DeferredCard
+    {
+        std::string json;
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration;
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration;
+        ParseLimits limits;
+        std::string language;
+        std::once_flag parseFlag;
+        std::atomic<bool> isParsed;
+        std::shared_ptr<AdaptiveCardParseError> error;
+    };
 
-    std::shared_ptr<AdaptiveCard> m_card;
+    mutable std::shared_ptr<AdaptiveCard> m_card;
+    std::shared_ptr<DeferredCard> m_deferredCard;
 };
 
 class ShowCardActionParser : public ActionElementParser
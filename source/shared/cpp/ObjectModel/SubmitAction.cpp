@@ -6,7 +6,6 @@ using namespace AdaptiveSharedNamespace;
 
 SubmitAction::SubmitAction() : BaseActionElement(ActionType::Submit)
 {
-    PopulateKnownPropertiesSet();
 }
 
 std::string SubmitAction::GetDataJson() const
@@ -28,6 +27,20 @@ Json::Value SubmitAction::SerializeToJsonValue()
     return root;
 }
 
+void SubmitAction::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(SubmitAction)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseActionElement::SerializeProperties(writer);
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::Data, GetDataJson());
+    writer.EndObject();
+}
+
 
 std::shared_ptr<BaseActionElement> SubmitActionParser::Deserialize(
     std::shared_ptr<ElementParserRegistration>,
@@ -49,7 +62,10 @@ std::shared_ptr<BaseActionElement> SubmitActionParser::DeserializeFromString(
     return SubmitActionParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void SubmitAction::PopulateKnownPropertiesSet() 
+const KnownPropertySet& SubmitAction::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data));
+    static const KnownPropertySet knownProperties(BaseActionElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Data
+    });
+    return knownProperties;
 }
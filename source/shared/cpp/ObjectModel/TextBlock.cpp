@@ -20,7 +20,6 @@ TextBlock::TextBlock() :
     m_maxLines(0),
     m_language()
 {
-    PopulateKnownPropertiesSet();
 }
 
 TextBlock::TextBlock(
@@ -46,7 +45,6 @@ TextBlock::TextBlock(
     m_hAlignment(hAlignment),
     m_language(language)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value TextBlock::SerializeToJsonValue()
@@ -66,6 +64,27 @@ Json::Value TextBlock::SerializeToJsonValue()
     return root;
 }
 
+void TextBlock::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(TextBlock)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseCardElement::SerializeProperties(writer);
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::Size, TextSizeToString(GetTextSize()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::Color, ForegroundColorToString(GetTextColor()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::Weight, TextWeightToString(GetTextWeight()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentToString(GetHorizontalAlignment()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::MaxLines, GetMaxLines());
+    writer.WriteProperty(AdaptiveCardSchemaKey::IsSubtle, GetIsSubtle());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Wrap, GetWrap());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Text, GetText());
+    writer.EndObject();
+}
+
 std::string TextBlock::GetText() const
 {
     return m_text;
@@ -190,14 +209,17 @@ std::shared_ptr<BaseCardElement> TextBlockParser::DeserializeFromString(
     return TextBlockParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void TextBlock::PopulateKnownPropertiesSet() 
+const KnownPropertySet& TextBlock::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Text));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Color));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextWeight));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsSubtle));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment));
+    static const KnownPropertySet knownProperties(BaseCardElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Text,
+        AdaptiveCardSchemaKey::Size,
+        AdaptiveCardSchemaKey::Color,
+        AdaptiveCardSchemaKey::TextWeight,
+        AdaptiveCardSchemaKey::Wrap,
+        AdaptiveCardSchemaKey::IsSubtle,
+        AdaptiveCardSchemaKey::MaxLines,
+        AdaptiveCardSchemaKey::HorizontalAlignment
+    });
+    return knownProperties;
 }
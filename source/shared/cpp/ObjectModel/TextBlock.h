@@ -26,6 +26,7 @@ public:
         std::string language);
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     std::string GetText() const;
     void SetText(const std::string value);
@@ -55,6 +56,9 @@ public:
     void SetLanguage(const std::string& value);
     std::string GetLanguage();
 
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
+
 private:
     std::string m_text;
     TextSize m_textSize;
@@ -64,7 +68,6 @@ private:
     bool m_wrap;
     unsigned int m_maxLines;
     HorizontalAlignment m_hAlignment;
-    void PopulateKnownPropertiesSet();
     std::string m_language;
 };
 
@@ -9,7 +9,6 @@ TextInput::TextInput() :
     m_isMultiline(false),
     m_maxLength(0)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value TextInput::SerializeToJsonValue()
@@ -25,6 +24,24 @@ Json::Value TextInput::SerializeToJsonValue()
     return root;
 }
 
+void TextInput::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(TextInput)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseInputElement::SerializeProperties(writer);
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::IsMultiline, GetIsMultiline());
+    writer.WriteProperty(AdaptiveCardSchemaKey::MaxLength, GetMaxLength());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Placeholder, GetPlaceholder());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Value, GetValue());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Style, TextInputStyleToString(GetTextInputStyle()));
+    writer.EndObject();
+}
+
 std::string TextInput::GetPlaceholder() const
 {
     return m_placeholder;
@@ -101,11 +118,14 @@ std::shared_ptr<BaseCardElement> TextInputParser::DeserializeFromString(
     return TextInputParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void TextInput::PopulateKnownPropertiesSet() 
+const KnownPropertySet& TextInput::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiline));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLength));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextInput));
+    static const KnownPropertySet knownProperties(BaseInputElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Placeholder,
+        AdaptiveCardSchemaKey::Value,
+        AdaptiveCardSchemaKey::IsMultiline,
+        AdaptiveCardSchemaKey::MaxLength,
+        AdaptiveCardSchemaKey::TextInput
+    });
+    return knownProperties;
 }
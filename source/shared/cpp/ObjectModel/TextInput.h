@@ -12,6 +12,7 @@ public:
     TextInput();
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     std::string GetPlaceholder() const;
     void SetPlaceholder(const std::string value);
@@ -28,9 +29,10 @@ public:
     TextInputStyle GetTextInputStyle() const;
     void SetTextInputStyle(const TextInputStyle value);
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     std::string m_placeholder;
     std::string m_value;
     bool m_isMultiline;
@@ -0,0 +1,201 @@
+#include "pch.h"
+#include "TextProcessingCache.h"
+#include "MarkDownParser.h"
+#include "ParseCache.h"
+
+using namespace AdaptiveSharedNamespace;
+
+TextProcessingCache::TextProcessingCache(size_t capacityInBytes) :
+    m_capacityInBytes(capacityInBytes),
+    m_sizeInBytes(0),
+    m_hitCount(0),
+    m_missCount(0),
+    m_evictionCount(0)
+{
+}
+
+std::shared_ptr<const std::string> TextProcessingCache::TransformToHtml(
+    const std::string& text,
+    const std::string& language,
+    unsigned long long optionsHash,
+    const DateFormatter& formatDates)
+{
+    const Key key = MakeKey(text, language, optionsHash, Output::Html);
+    if (auto cached = Find(key, text, language))
+    {
+        return std::static_pointer_cast<const std::string>(cached);
+    }
+
+    // Process without holding the lock so that misses on different text do not wait on each other
+    MarkDownParser parser(FormatDates(text, formatDates));
+    auto html = std::make_shared<const std::string>(parser.TransformToHtml());
+
+    Insert(key, text, language, html->size(), html);
+    return html;
+}
+
+std::shared_ptr<const std::vector<MarkDownBlock>> TextProcessingCache::TransformToBlocks(
+    const std::string& text,
+    const std::string& language,
+    unsigned long long optionsHash,
+    const DateFormatter& formatDates)
+{
+    const Key key = MakeKey(text, language, optionsHash, Output::Blocks);
+    if (auto cached = Find(key, text, language))
+    {
+        return std::static_pointer_cast<const std::vector<MarkDownBlock>>(cached);
+    }
+
+    MarkDownParser parser(FormatDates(text, formatDates));
+    auto blocks = std::make_shared<const std::vector<MarkDownBlock>>(parser.TransformToBlocks());
+
+    size_t resultSizeInBytes = blocks->size() * sizeof(MarkDownBlock);
+    for (const auto& block : *blocks)
+    {
+        for (const auto& run : block.runs)
+        {
+            resultSizeInBytes += sizeof(MarkDownRun) + run.text.size() + run.linkTarget.size();
+        }
+    }
+
+    Insert(key, text, language, resultSizeInBytes, blocks);
+    return blocks;
+}
+
+void TextProcessingCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index.clear();
+    m_entries.clear();
+    m_sizeInBytes = 0;
+}
+
+size_t TextProcessingCache::GetCapacityInBytes() const
+{
+    return m_capacityInBytes;
+}
+
+size_t TextProcessingCache::GetSizeInBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sizeInBytes;
+}
+
+size_t TextProcessingCache::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+unsigned long long TextProcessingCache::GetHitCount() const
+{
+    return m_hitCount;
+}
+
+unsigned long long TextProcessingCache::GetMissCount() const
+{
+    return m_missCount;
+}
+
+unsigned long long TextProcessingCache::GetEvictionCount() const
+{
+    return m_evictionCount;
+}
+
+std::shared_ptr<TextProcessingCache> TextProcessingCache::GetDefault()
+{
+    static const std::shared_ptr<TextProcessingCache> defaultCache = std::make_shared<TextProcessingCache>(1024 * 1024);
+    return defaultCache;
+}
+
+TextProcessingCache::Key TextProcessingCache::MakeKey(const std::string& text, const std::string& language, unsigned long long optionsHash, Output output)
+{
+    return {
+        ParseCache::Hash(text.data(), text.size()),
+        ParseCache::Hash(language.data(), language.size()),
+        optionsHash,
+        output };
+}
+
+std::string TextProcessingCache::FormatDates(const std::string& text, const DateFormatter& formatDates)
+{
+    DateTimePreparser preparser(text);
+    if (!preparser.HasDateTokens() || !formatDates)
+    {
+        return text;
+    }
+    return formatDates(preparser);
+}
+
+std::shared_ptr<const void> TextProcessingCache::Find(const Key& key, const std::string& text, const std::string& language)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_index.find(key);
+        // The text and language are compared as well so that a hash collision cannot return
+        // another text's result
+        if (found != m_index.end() && found->second->text == text && found->second->language == language)
+        {
+            m_entries.splice(m_entries.begin(), m_entries, found->second);
+            ++m_hitCount;
+            return found->second->result;
+        }
+    }
+
+    ++m_missCount;
+    return nullptr;
+}
+
+void TextProcessingCache::Insert(const Key& key, const std::string& text, const std::string& language, size_t resultSizeInBytes, std::shared_ptr<const void> result)
+{
+    const size_t sizeInBytes = sizeof(Entry) + text.size() + language.size() + resultSizeInBytes;
+    if (sizeInBytes > m_capacityInBytes)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_index.find(key);
+    if (found != m_index.end())
+    {
+        // Another thread cached this key meanwhile, or the key collides with different text;
+        // either way the newest result replaces it
+        m_sizeInBytes -= found->second->sizeInBytes;
+        m_entries.erase(found->second);
+        m_index.erase(found);
+    }
+
+    m_entries.push_front({ key, text, language, sizeInBytes, std::move(result) });
+    m_index[key] = m_entries.begin();
+    m_sizeInBytes += sizeInBytes;
+    EvictToCapacity();
+}
+
+void TextProcessingCache::EvictToCapacity()
+{
+    while (m_sizeInBytes > m_capacityInBytes && !m_entries.empty())
+    {
+        const Entry& leastRecentlyUsed = m_entries.back();
+        m_sizeInBytes -= leastRecentlyUsed.sizeInBytes;
+        m_index.erase(leastRecentlyUsed.key);
+        m_entries.pop_back();
+        ++m_evictionCount;
+    }
+}
+
+bool TextProcessingCache::Key::operator==(const Key& other) const
+{
+    return textHash == other.textHash &&
+        languageHash == other.languageHash &&
+        optionsHash == other.optionsHash &&
+        output == other.output;
+}
+
+size_t TextProcessingCache::KeyHash::operator()(const Key& key) const
+{
+    size_t hash = static_cast<size_t>(key.textHash);
+    hash ^= static_cast<size_t>(key.languageHash) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= static_cast<size_t>(key.optionsHash) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= static_cast<size_t>(key.output) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
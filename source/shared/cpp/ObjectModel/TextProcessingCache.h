@@ -0,0 +1,112 @@
+#pragma once
+
+#include "pch.h"
+#include "DateTimePreparser.h"
+#include "MarkDownHtmlGenerator.h"
+#include <atomic>
+#include <functional>
+#include <list>
+#include <mutex>
+
+AdaptiveSharedNamespaceStart
+
+// Cache of the processed text of TextBlocks, that is their markdown once their dates are
+// formatted, keyed by the text, its language and a hash of whatever else the host formats it
+// with. Labels, headings and fact titles are rendered again on every re-render and card update;
+// with the cache their dates and markdown are parsed once. Results are shared and read-only. The
+// cache keeps the most recently used results within a byte budget and may be used from several
+// threads at once.
+class TextProcessingCache
+{
+public:
+    // Formats the dates of the text, as TextBlock::GetTextForDateParsing returns it, in the
+    // language the text is processed for. Called only for text with dates, without the cache's
+    // lock held; its result must depend on nothing but the text, the language and the options
+    // the hash is of.
+    typedef std::function<std::string(const DateTimePreparser&)> DateFormatter;
+
+    explicit TextProcessingCache(size_t capacityInBytes);
+    TextProcessingCache(const TextProcessingCache&) = delete;
+    TextProcessingCache& operator=(const TextProcessingCache&) = delete;
+
+    // Returns the html of the text's markdown once its dates are formatted, from the cache or by
+    // processing the text and caching the result
+    std::shared_ptr<const std::string> TransformToHtml(
+        const std::string& text,
+        const std::string& language,
+        unsigned long long optionsHash,
+        const DateFormatter& formatDates);
+
+    // As TransformToHtml, but returns the blocks of inline runs of MarkDownParser::TransformToBlocks
+    std::shared_ptr<const std::vector<MarkDownBlock>> TransformToBlocks(
+        const std::string& text,
+        const std::string& language,
+        unsigned long long optionsHash,
+        const DateFormatter& formatDates);
+
+    void Clear();
+
+    size_t GetCapacityInBytes() const;
+    size_t GetSizeInBytes() const;
+    size_t GetEntryCount() const;
+
+    unsigned long long GetHitCount() const;
+    unsigned long long GetMissCount() const;
+    unsigned long long GetEvictionCount() const;
+
+    // Cache shared by the renderers, of 1 MB
+    static std::shared_ptr<TextProcessingCache> GetDefault();
+
+private:
+    enum class Output
+    {
+        Html = 0,
+        Blocks,
+    };
+
+    struct Key
+    {
+        unsigned long long textHash;
+        unsigned long long languageHash;
+        unsigned long long optionsHash;
+        Output output;
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry
+    {
+        Key key;
+        std::string text;
+        std::string language;
+        size_t sizeInBytes;
+        // a std::string for Output::Html, and a std::vector<MarkDownBlock> for Output::Blocks
+        std::shared_ptr<const void> result;
+    };
+
+    static Key MakeKey(const std::string& text, const std::string& language, unsigned long long optionsHash, Output output);
+    static std::string FormatDates(const std::string& text, const DateFormatter& formatDates);
+
+    std::shared_ptr<const void> Find(const Key& key, const std::string& text, const std::string& language);
+    void Insert(const Key& key, const std::string& text, const std::string& language, size_t resultSizeInBytes, std::shared_ptr<const void> result);
+    void EvictToCapacity();
+
+    const size_t m_capacityInBytes;
+    size_t m_sizeInBytes;
+
+    // Most recently used entry first
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_index;
+    mutable std::mutex m_mutex;
+
+    std::atomic<unsigned long long> m_hitCount;
+    std::atomic<unsigned long long> m_missCount;
+    std::atomic<unsigned long long> m_evictionCount;
+};
+
+AdaptiveSharedNamespaceEnd
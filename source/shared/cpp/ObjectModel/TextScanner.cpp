@@ -0,0 +1,225 @@
+#include "pch.h"
+#include "TextScanner.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TEXT_SCANNER_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define TEXT_SCANNER_SSE2
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    struct ScanState
+    {
+        bool hasMarkDown;
+        bool hasDateTime;
+        size_t escapedLength;
+    };
+
+    // The markdown parser starts a new block at the start of the text, and after ']' or ')'. There,
+    // "- " starts a list item and digits followed by ". " an ordered one; a '-', or digits with or
+    // without a '.', that does not is text, and another block starts after it.
+    bool IsListItemAt(const char* text, size_t length, size_t i)
+    {
+        while (i < length)
+        {
+            if (text[i] == '-')
+            {
+                if (i + 1 < length && text[i + 1] == ' ')
+                {
+                    return true;
+                }
+                ++i;
+            }
+            else if (isdigit(static_cast<unsigned char>(text[i])))
+            {
+                do
+                {
+                    ++i;
+                } while (i < length && isdigit(static_cast<unsigned char>(text[i])));
+
+                if (i < length && text[i] == '.')
+                {
+                    if (i + 1 < length && text[i + 1] == ' ')
+                    {
+                        return true;
+                    }
+                    ++i;
+                }
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    // Emphasis, links and new lines are markdown wherever they are; ']' and ')' end a block, so
+    // the text after them is checked for a list item. Dates are in {{DATE()}} or {{TIME()}}.
+    void ScanChar(const char* text, size_t length, size_t i, ScanState& state)
+    {
+        switch (text[i])
+        {
+        case '*':
+        case '_':
+        case '[':
+        case '\n':
+        case '\r':
+            state.hasMarkDown = true;
+            break;
+        case ']':
+        case ')':
+            if (!state.hasMarkDown && IsListItemAt(text, length, i + 1))
+            {
+                state.hasMarkDown = true;
+            }
+            break;
+        case '{':
+            if (i + 1 < length && text[i + 1] == '{')
+            {
+                state.hasDateTime = true;
+            }
+            break;
+        case '<':
+        case '>':
+            state.escapedLength += 3;
+            break;
+        case '"':
+            state.escapedLength += 5;
+            break;
+        case '&':
+            state.escapedLength += 4;
+            break;
+        }
+    }
+
+#if defined(TEXT_SCANNER_AVX2)
+    typedef __m256i Vector;
+    Vector Set(char ch) { return _mm256_set1_epi8(ch); }
+    Vector Load(const char* text) { return _mm256_loadu_si256(reinterpret_cast<const Vector*>(text)); }
+    Vector Equal(Vector a, Vector b) { return _mm256_cmpeq_epi8(a, b); }
+    Vector Or(Vector a, Vector b) { return _mm256_or_si256(a, b); }
+    unsigned int MoveMask(Vector a) { return static_cast<unsigned int>(_mm256_movemask_epi8(a)); }
+#elif defined(TEXT_SCANNER_SSE2)
+    typedef __m128i Vector;
+    Vector Set(char ch) { return _mm_set1_epi8(ch); }
+    Vector Load(const char* text) { return _mm_loadu_si128(reinterpret_cast<const Vector*>(text)); }
+    Vector Equal(Vector a, Vector b) { return _mm_cmpeq_epi8(a, b); }
+    Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+    unsigned int MoveMask(Vector a) { return static_cast<unsigned int>(_mm_movemask_epi8(a)); }
+#endif
+
+#if defined(TEXT_SCANNER_AVX2) || defined(TEXT_SCANNER_SSE2)
+    unsigned int CountTrailingZeros(unsigned int mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    void ScanMask(const char* text, size_t length, size_t offset, unsigned int mask, ScanState& state)
+    {
+        while (mask)
+        {
+            ScanChar(text, length, offset + CountTrailingZeros(mask), state);
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    // Scans as much of the text as fills whole vectors, and returns where it stopped
+    size_t ScanVectors(const char* text, size_t length, ScanState& state)
+    {
+        size_t i = 0;
+#if defined(TEXT_SCANNER_AVX2) || defined(TEXT_SCANNER_SSE2)
+        // the chars ScanChar checks
+        const Vector asterisk = Set('*');
+        const Vector underscore = Set('_');
+        const Vector leftBracket = Set('[');
+        const Vector rightBracket = Set(']');
+        const Vector rightParenthesis = Set(')');
+        const Vector lineFeed = Set('\n');
+        const Vector carriageReturn = Set('\r');
+        const Vector leftBrace = Set('{');
+        const Vector lessThan = Set('<');
+        const Vector greaterThan = Set('>');
+        const Vector quotation = Set('"');
+        const Vector ampersand = Set('&');
+
+        for (; i + sizeof(Vector) <= length; i += sizeof(Vector))
+        {
+            const Vector chunk = Load(text + i);
+            const Vector markDown = Or(Or(Or(Equal(chunk, asterisk), Equal(chunk, underscore)), Or(Equal(chunk, leftBracket), Equal(chunk, rightBracket))),
+                Or(Or(Equal(chunk, rightParenthesis), Equal(chunk, lineFeed)), Equal(chunk, carriageReturn)));
+            const Vector other = Or(Or(Equal(chunk, leftBrace), Equal(chunk, lessThan)),
+                Or(Or(Equal(chunk, greaterThan), Equal(chunk, quotation)), Equal(chunk, ampersand)));
+            ScanMask(text, length, i, MoveMask(Or(markDown, other)), state);
+        }
+#else
+        (void)text;
+        (void)length;
+        (void)state;
+#endif
+        return i;
+    }
+}
+
+TextScanResult TextScanner::Scan(const std::string& text)
+{
+    const char* data = text.data();
+    const size_t length = text.size();
+    ScanState state = { IsListItemAt(data, length, 0), false, length };
+
+    for (size_t i = ScanVectors(data, length, state); i < length; ++i)
+    {
+        ScanChar(data, length, i, state);
+    }
+
+    const int contentType = (state.hasMarkDown ? static_cast<int>(TextContentType::MarkDown) : 0) |
+        (state.hasDateTime ? static_cast<int>(TextContentType::DateTime) : 0);
+    return { static_cast<TextContentType>(contentType), state.escapedLength };
+}
+
+void TextScanner::AppendEscapedText(const std::string& text, std::string& result)
+{
+    size_t start = 0;
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        const char* entity;
+        switch (text[i])
+        {
+        case '<':
+            entity = "&lt;";
+            break;
+        case '>':
+            entity = "&gt;";
+            break;
+        case '"':
+            entity = "&quot;";
+            break;
+        case '&':
+            entity = "&amp;";
+            break;
+        default:
+            continue;
+        }
+
+        result.append(text, start, i - start);
+        result += entity;
+        start = i + 1;
+    }
+    result.append(text, start, std::string::npos);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "pch.h"
+
+AdaptiveSharedNamespaceStart
+
+// What processing a TextBlock's text needs before it is rendered
+enum class TextContentType
+{
+    // Neither markdown nor dates; its html is the escaped text as a paragraph
+    PlainText = 0x0,
+    MarkDown = 0x1,
+    DateTime = 0x2,
+    MarkDownAndDateTime = 0x3,
+};
+
+struct TextScanResult
+{
+    TextContentType contentType;
+    // Length of the text once <, >, " and & are escaped as html entities
+    size_t escapedLength;
+
+    bool HasMarkDown() const { return (static_cast<int>(contentType) & static_cast<int>(TextContentType::MarkDown)) != 0; }
+    bool HasDateTime() const { return (static_cast<int>(contentType) & static_cast<int>(TextContentType::DateTime)) != 0; }
+};
+
+// Classifies text in a single pass, so that plain text, which most text is, can skip the
+// markdown and date parsers. The pass looks for the chars that can start markdown or a date,
+// 16 or 32 at a time where SSE2 or AVX2 is available, and checks each one found.
+class TextScanner
+{
+public:
+    static TextScanResult Scan(const std::string& text);
+
+    // Appends text to result with <, >, " and & escaped as html entities
+    static void AppendEscapedText(const std::string& text, std::string& result);
+};
+
+AdaptiveSharedNamespaceEnd
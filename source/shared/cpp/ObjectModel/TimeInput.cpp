@@ -7,7 +7,6 @@ using namespace AdaptiveSharedNamespace;
 TimeInput::TimeInput() :
     BaseInputElement(CardElementType::TimeInput)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value TimeInput::SerializeToJsonValue()
@@ -22,6 +21,23 @@ Json::Value TimeInput::SerializeToJsonValue()
     return root;
 }
 
+void TimeInput::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(TimeInput)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseInputElement::SerializeProperties(writer);
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::Max, GetMax());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Min, GetMin());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Placeholder, GetPlaceholder());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Value, GetValue());
+    writer.EndObject();
+}
+
 std::string TimeInput::GetMax() const
 {
     return m_max;
@@ -87,10 +103,13 @@ std::shared_ptr<BaseCardElement> TimeInputParser::DeserializeFromString(
     return TimeInputParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void TimeInput::PopulateKnownPropertiesSet() 
+const KnownPropertySet& TimeInput::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value));
+    static const KnownPropertySet knownProperties(BaseInputElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Max,
+        AdaptiveCardSchemaKey::Min,
+        AdaptiveCardSchemaKey::Placeholder,
+        AdaptiveCardSchemaKey::Value
+    });
+    return knownProperties;
 }
@@ -12,6 +12,7 @@ public:
     TimeInput();
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     std::string GetMax() const;
     void SetMax(const std::string value);
@@ -25,9 +26,10 @@ public:
     std::string GetValue() const;
     void SetValue(const std::string value);
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     std::string m_max;
     std::string m_min;
     std::string m_placeholder;
@@ -9,7 +9,6 @@ ToggleInput::ToggleInput() :
     m_valueOn("true"),
     m_valueOff("false")
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value ToggleInput::SerializeToJsonValue()
@@ -24,6 +23,23 @@ Json::Value ToggleInput::SerializeToJsonValue()
     return root;
 }
 
+void ToggleInput::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(ToggleInput)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+    BaseInputElement::SerializeProperties(writer);
+
+    writer.WriteProperty(AdaptiveCardSchemaKey::Title, GetTitle());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Value, GetValue());
+    writer.WriteProperty(AdaptiveCardSchemaKey::ValueOff, GetValueOff());
+    writer.WriteProperty(AdaptiveCardSchemaKey::ValueOn, GetValueOn());
+    writer.EndObject();
+}
+
 std::string ToggleInput::GetTitle() const
 {
     return m_title;
@@ -98,10 +114,13 @@ std::shared_ptr<BaseCardElement> ToggleInputParser::DeserializeFromString(
     return ToggleInputParser::Deserialize(elementParserRegistration, actionParserRegistration, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void ToggleInput::PopulateKnownPropertiesSet() 
+const KnownPropertySet& ToggleInput::GetKnownProperties() const
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOn));
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOff));
+    static const KnownPropertySet knownProperties(BaseInputElement::GetKnownProperties(), {
+        AdaptiveCardSchemaKey::Title,
+        AdaptiveCardSchemaKey::Value,
+        AdaptiveCardSchemaKey::ValueOn,
+        AdaptiveCardSchemaKey::ValueOff
+    });
+    return knownProperties;
 }
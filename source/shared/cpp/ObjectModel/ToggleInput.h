@@ -12,6 +12,7 @@ public:
     ToggleInput();
 
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 
     std::string GetTitle() const;
     void SetTitle(const std::string value);
@@ -25,9 +26,10 @@ public:
     std::string GetValueOn() const;
     void SetValueOn(const std::string value);
 
-private:
-    void PopulateKnownPropertiesSet();
+protected:
+    virtual const KnownPropertySet& GetKnownProperties() const override;
 
+private:
     std::string m_title;
     std::string m_value;
     std::string m_valueOff;
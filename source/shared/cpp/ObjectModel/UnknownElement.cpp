@@ -24,6 +24,30 @@ Json::Value UnknownElement::SerializeToJsonValue()
     return root;
 }
 
+void UnknownElement::SerializeToWriter(CardWriter& writer)
+{
+    if (SerializeToWriterIfSubclassed(writer, typeid(UnknownElement)))
+    {
+        return;
+    }
+
+    writer.BeginObject();
+
+    const Json::Value additionalProperties = GetAdditionalProperties();
+    for (Json::Value::const_iterator it = additionalProperties.begin(); it != additionalProperties.end(); it++)
+    {
+        writer.WriteKey(it.name());
+        writer.WriteValue(*it);
+    }
+
+    // Written after the additional properties so that they take precedence, as in SerializeToJsonValue
+    writer.WriteProperty(AdaptiveCardSchemaKey::Type, CardElementTypeToString(CardElementType::Unknown));
+    writer.WriteProperty(AdaptiveCardSchemaKey::Spacing, SpacingToString(GetSpacing()));
+    writer.WriteProperty(AdaptiveCardSchemaKey::Separator, GetSeparator());
+    writer.WriteProperty(AdaptiveCardSchemaKey::Id, GetId());
+    writer.EndObject();
+}
+
 std::shared_ptr<BaseCardElement> UnknownElementParser::Deserialize(
     std::shared_ptr<ElementParserRegistration>,
     std::shared_ptr<ActionParserRegistration>,
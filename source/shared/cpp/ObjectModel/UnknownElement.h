@@ -14,6 +14,7 @@ public:
     UnknownElement();
         
     virtual Json::Value SerializeToJsonValue() override;
+    virtual void SerializeToWriter(CardWriter& writer) override;
 };
 
 class UnknownElementParser : public BaseCardElementParser
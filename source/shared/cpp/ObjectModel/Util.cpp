@@ -3,40 +3,52 @@
 #include "ColumnSet.h"
 #include "Container.h"
 #include "TextBlock.h"
+#include "ParseUtil.h"
+#include "Image.h"
+#include "ShowCardAction.h"
+#include "CardTraversal.h"
+#include <cerrno>
+#include <cstdlib>
 
-void PropagateLanguage(const std::string& language, std::vector<std::shared_ptr<BaseCardElement>>& m_body)
+void PropagateLanguage(const std::string& language, const std::vector<std::shared_ptr<BaseCardElement>>& items)
 {
-    for (auto& bodyElement : m_body)
+    // Nested elements are reached through scheduled tasks, which outlive the reference. The card
+    // keeps the elements alive until the walk is over, so the tasks don't hold on to them.
+    for (const auto& item : items)
     {
-        CardElementType elementType = bodyElement->GetElementType();
-
-        if (elementType == CardElementType::ColumnSet)
+        switch (item->GetElementType())
         {
-            auto columnSet = std::static_pointer_cast<ColumnSet>(bodyElement);
-            if (columnSet != nullptr)
-            {
-                columnSet->SetLanguage(language);
-            }
-        }
-        else if (elementType == CardElementType::Container)
+        case CardElementType::ColumnSet:
         {
-            auto container = std::static_pointer_cast<Container>(bodyElement);
-            if (container != nullptr)
-            {
-                container->SetLanguage(language);
-            }
+            ColumnSet* columnSet = static_cast<ColumnSet*>(item.get());
+            CardTraversal::Schedule([columnSet, language]() { columnSet->SetLanguage(language); });
+            break;
         }
-        else if (bodyElement->GetElementType() == CardElementType::TextBlock)
+        case CardElementType::Container:
         {
-            auto textBlock = std::static_pointer_cast<TextBlock>(bodyElement);
-            if (textBlock != nullptr)
-            {
-                textBlock->SetLanguage(language);
-            }
+            Container* container = static_cast<Container*>(item.get());
+            CardTraversal::Schedule([container, language]() { container->SetLanguage(language); });
+            break;
+        }
+        case CardElementType::TextBlock:
+            static_cast<TextBlock*>(item.get())->SetLanguage(language);
+            break;
+        case CardElementType::Image:
+            PropagateLanguage(language, static_cast<Image*>(item.get())->GetSelectAction());
+            break;
+        default:
+            break;
         }
-
     }
+}
 
+void PropagateLanguage(const std::string& language, const std::shared_ptr<BaseActionElement>& action)
+{
+    if (action != nullptr && action->GetElementType() == ActionType::ShowCard)
+    {
+        ShowCardAction* showCard = static_cast<ShowCardAction*>(action.get());
+        CardTraversal::Schedule([showCard, language]() { showCard->SetLanguage(language); });
+    }
 }
 
 void ValidateUserInputForDimensionWithUnit(const std::string &unit, const std::vector<std::string> &requestedDimensions, std::vector<int> &parsedDimensions)
@@ -52,26 +64,33 @@ void ValidateUserInputForDimensionWithUnit(const std::string &unit, const std::v
             std::size_t foundIndex = eachDimension.find(unit);
             if (eachDimension.size() != foundIndex + unit.size())
             {
-                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "unit is either missing or inproper form: " + eachDimension);
+                ParseUtil::RaiseError(ErrorStatusCode::InvalidPropertyValue, "unit is either missing or inproper form: " + eachDimension);
+                parsedDimensions.push_back(0);
+                continue;
             }
-            try
+            // Same parse as std::stof, without using exceptions to report failures
+            const std::string number = eachDimension.substr(0, foundIndex);
+            char* numberEnd;
+            errno = 0;
+            float parsedVal = std::strtof(number.c_str(), &numberEnd);
+            if (numberEnd == number.c_str())
             {
-                float parsedVal = stof(eachDimension.substr(0, foundIndex));
-                if(parsedVal != (int) parsedVal || parsedVal < 0)
-                {
-                    throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "unsigned integer is accepted but received : " + eachDimension);
-                }
-                parsedDimensions.push_back((int)parsedVal);
+                ParseUtil::RaiseError(ErrorStatusCode::InvalidPropertyValue, "unsigned integer is accepted but received : " + eachDimension);
+                parsedDimensions.push_back(0);
+            }
+            else if (errno == ERANGE)
+            {
+                ParseUtil::RaiseError(ErrorStatusCode::InvalidPropertyValue, "out of range: " + eachDimension);
+                parsedDimensions.push_back(0);
             }
-            catch (const std::invalid_argument &e)
+            else if (parsedVal != (int) parsedVal || parsedVal < 0)
             {
-                (void)e;
-                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "unsigned integer is accepted but received : " + eachDimension);
+                ParseUtil::RaiseError(ErrorStatusCode::InvalidPropertyValue, "unsigned integer is accepted but received : " + eachDimension);
+                parsedDimensions.push_back(0);
             }
-            catch (const std::out_of_range &e)
+            else
             {
-                (void)e;
-                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "out of range: " + eachDimension);
+                parsedDimensions.push_back((int)parsedVal);
             }
         }
     }
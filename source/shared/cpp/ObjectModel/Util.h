@@ -3,9 +3,16 @@
 #include <vector>
 #include <memory>
 #include "BaseCardElement.h"
+#include "BaseActionElement.h"
 
 using namespace AdaptiveSharedNamespace;
 
-void PropagateLanguage(const std::string& language, std::vector<std::shared_ptr<BaseCardElement>>& m_body);
+// Sets the language of the TextBlocks among items and in what is nested in them, and of the
+// cards of the Action.ShowCards they select that have no language of their own
+void PropagateLanguage(const std::string& language, const std::vector<std::shared_ptr<BaseCardElement>>& items);
+
+// Sets the language of the card of an Action.ShowCard if it has none of its own. Other actions,
+// and null, are left alone.
+void PropagateLanguage(const std::string& language, const std::shared_ptr<BaseActionElement>& action);
 
 void ValidateUserInputForDimensionWithUnit(const std::string &unit, const std::vector<std::string> &requestedDimensions, std::vector<int> &parsedDimensions);
@@ -8,114 +8,89 @@ using namespace ABI::AdaptiveNamespace;
 using namespace ABI::Windows::Foundation;
 using namespace ABI::Windows::Foundation::Collections;
 using namespace AdaptiveNamespace;
+using namespace AdaptiveSharedNamespace;
 
-HRESULT GetTextFromXmlNode(
-    ABI::Windows::Data::Xml::Dom::IXmlNode* node,
-    HSTRING* text)
+HRESULT AddListMarkerInline(
+    const MarkDownBlock& block,
+    IVector<ABI::Windows::UI::Xaml::Documents::Inline*>* inlines)
 {
-    ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNode> localNode = node;
-    ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNodeSerializer> textNodeSerializer;
-    RETURN_IF_FAILED(localNode.As(&textNodeSerializer));
+    std::wstring listElementString = L"\n";
+    if (block.type == MarkDownBlockType::UnorderedList)
+    {
+        listElementString += L"● ";
+    }
+    else
+    {
+        wchar_t buffer[16];
+        swprintf_s(buffer, ARRAYSIZE(buffer), L"%u. ", block.listNumber);
 
-    RETURN_IF_FAILED(textNodeSerializer->get_InnerText(text));
-    return S_OK;
-}
+        std::wstring numberElementString(buffer);
+        listElementString += numberElementString;
+    }
 
-HRESULT XamlRunFromXmlNode(
-    ABI::Windows::Data::Xml::Dom::IXmlNode* node,
-    ABI::Windows::UI::Xaml::Documents::IRun** run)
-{
-    HString text;
-    RETURN_IF_FAILED(GetTextFromXmlNode(node, text.GetAddressOf()));
+    HString listElementHString;
+    RETURN_IF_FAILED(listElementHString.Set(listElementString.c_str()));
 
-    ComPtr<ABI::Windows::UI::Xaml::Documents::IRun> localRun = XamlHelpers::CreateXamlClass<ABI::Windows::UI::Xaml::Documents::IRun>(HStringReference(RuntimeClass_Windows_UI_Xaml_Documents_Run));
-    RETURN_IF_FAILED(localRun->put_Text(text.Get()));
+    ComPtr<ABI::Windows::UI::Xaml::Documents::IRun> run = XamlHelpers::CreateXamlClass<ABI::Windows::UI::Xaml::Documents::IRun>(HStringReference(RuntimeClass_Windows_UI_Xaml_Documents_Run));
+    RETURN_IF_FAILED(run->put_Text(listElementHString.Get()));
 
-    *run = localRun.Detach();
+    ComPtr<ABI::Windows::UI::Xaml::Documents::IInline> runAsInline;
+    RETURN_IF_FAILED(run.As(&runAsInline));
+
+    RETURN_IF_FAILED(inlines->Append(runAsInline.Get()));
     return S_OK;
 }
 
-HRESULT AddListInlines(
+HRESULT AddRunInline(
     IAdaptiveRenderContext* renderContext,
-    ABI::Windows::Data::Xml::Dom::IXmlNode* node,
-    bool isListOrdered,
+    const MarkDownRun& markDownRun,
     IVector<ABI::Windows::UI::Xaml::Documents::Inline*>* inlines)
 {
-    ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNamedNodeMap> attributeMap;
-    RETURN_IF_FAILED(node->get_Attributes(&attributeMap));
-
-    ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNode> startNode;
-    RETURN_IF_FAILED(attributeMap->GetNamedItem(HStringReference(L"start").Get(), &startNode));
+    HString text;
+    RETURN_IF_FAILED(UTF8ToHString(markDownRun.text, text.GetAddressOf()));
 
-    int iteration = 1;
-    if (startNode != nullptr)
-    {
-        HString start;
-        RETURN_IF_FAILED(GetTextFromXmlNode(startNode.Get(), start.GetAddressOf()));
-        iteration = std::stoi(HStringToUTF8(start.Get()));
-    }
+    ComPtr<ABI::Windows::UI::Xaml::Documents::IRun> run = XamlHelpers::CreateXamlClass<ABI::Windows::UI::Xaml::Documents::IRun>(HStringReference(RuntimeClass_Windows_UI_Xaml_Documents_Run));
+    RETURN_IF_FAILED(run->put_Text(text.Get()));
 
-    ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNode> listChild;
-    RETURN_IF_FAILED(node->get_FirstChild(&listChild));
+    ComPtr<ABI::Windows::UI::Xaml::Documents::ITextElement> runAsTextElement;
+    RETURN_IF_FAILED(run.As(&runAsTextElement));
 
-    while (listChild != nullptr)
+    if (markDownRun.isBold)
     {
-        std::wstring listElementString = L"\n";
-        if (!isListOrdered)
-        {
-            listElementString += L"● ";
-        }
-        else
-        {
-            wchar_t buffer[10];
-            swprintf_s(buffer, ARRAYSIZE(buffer), L"%d. ", iteration);
+        ComPtr<IAdaptiveHostConfig> hostConfig;
+        RETURN_IF_FAILED(renderContext->get_HostConfig(&hostConfig));
 
-            std::wstring numberElementString(buffer);
-            listElementString += numberElementString;
-        }
+        ComPtr<IAdaptiveFontWeightsConfig> fontWeightsConfig;
+        RETURN_IF_FAILED(hostConfig->get_FontWeights(&fontWeightsConfig));
 
-        HString listElementHString;
-        RETURN_IF_FAILED(listElementHString.Set(listElementString.c_str()));
+        ABI::Windows::UI::Text::FontWeight boldFontWeight;
+        RETURN_IF_FAILED(fontWeightsConfig->get_Bolder(&boldFontWeight.Weight));
 
-        ComPtr<ABI::Windows::UI::Xaml::Documents::IRun> run = XamlHelpers::CreateXamlClass<ABI::Windows::UI::Xaml::Documents::IRun>(HStringReference(RuntimeClass_Windows_UI_Xaml_Documents_Run));
-        RETURN_IF_FAILED(run->put_Text(listElementHString.Get()));
-
-        ComPtr<ABI::Windows::UI::Xaml::Documents::IInline> runAsInline;
-        RETURN_IF_FAILED(run.As(&runAsInline));
-
-        RETURN_IF_FAILED(inlines->Append(runAsInline.Get()));
+        RETURN_IF_FAILED(runAsTextElement->put_FontWeight(boldFontWeight));
+    }
 
-        RETURN_IF_FAILED(AddTextInlines(renderContext, listChild.Get(), false, false, inlines));
+    if (markDownRun.isItalic)
+    {
+        RETURN_IF_FAILED(runAsTextElement->put_FontStyle(ABI::Windows::UI::Text::FontStyle::FontStyle_Italic));
+    }
 
-        ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNode> nextListChild;
-        RETURN_IF_FAILED(listChild->get_NextSibling(&nextListChild));
+    ComPtr<ABI::Windows::UI::Xaml::Documents::IInline> runAsInline;
+    RETURN_IF_FAILED(run.As(&runAsInline));
 
-        iteration++;
-        listChild = nextListChild;
-    }
+    RETURN_IF_FAILED(inlines->Append(runAsInline.Get()));
     return S_OK;
 }
 
+// Adds the runs from begin to end, which are in the same link, as a hyperlink
 HRESULT AddLinkInline(
     IAdaptiveRenderContext* renderContext,
-    ABI::Windows::Data::Xml::Dom::IXmlNode* node,
-    BOOL isBold,
-    BOOL isItalic,
+    const std::vector<MarkDownRun>& runs,
+    size_t begin,
+    size_t end,
     IVector<ABI::Windows::UI::Xaml::Documents::Inline*>* inlines)
 {
-    ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNamedNodeMap> attributeMap;
-    RETURN_IF_FAILED(node->get_Attributes(&attributeMap));
-
-    ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNode> hrefNode;
-    RETURN_IF_FAILED(attributeMap->GetNamedItem(HStringReference(L"href").Get(), &hrefNode));
-
-    if (hrefNode == nullptr)
-    {
-        return E_INVALIDARG;
-    }
-
     HString href;
-    RETURN_IF_FAILED(GetTextFromXmlNode(hrefNode.Get(), href.GetAddressOf()));
+    RETURN_IF_FAILED(UTF8ToHString(runs[begin].linkTarget, href.GetAddressOf()));
 
     ComPtr<IUriRuntimeClassFactory> uriActivationFactory;
     RETURN_IF_FAILED(GetActivationFactory(
@@ -134,7 +109,10 @@ HRESULT AddLinkInline(
     ComPtr<IVector<ABI::Windows::UI::Xaml::Documents::Inline*>> hyperlinkInlines;
     RETURN_IF_FAILED(hyperlinkAsSpan->get_Inlines(hyperlinkInlines.GetAddressOf()));
 
-    RETURN_IF_FAILED(AddTextInlines(renderContext, node, isBold, isItalic, hyperlinkInlines.Get()));
+    for (size_t i = begin; i < end; i++)
+    {
+        RETURN_IF_FAILED(AddRunInline(renderContext, runs[i], hyperlinkInlines.Get()));
+    }
 
     ComPtr<ABI::Windows::UI::Xaml::Documents::IInline> hyperLinkAsInline;
     RETURN_IF_FAILED(hyperlink.As(&hyperLinkAsInline));
@@ -143,120 +121,40 @@ HRESULT AddLinkInline(
     return S_OK;
 }
 
-HRESULT AddTextInlines(
+HRESULT AddMarkDownInlines(
     IAdaptiveRenderContext* renderContext,
-    ABI::Windows::Data::Xml::Dom::IXmlNode* node,
-    BOOL isBold,
-    BOOL isItalic,
+    const std::vector<MarkDownBlock>& blocks,
     IVector<ABI::Windows::UI::Xaml::Documents::Inline*>* inlines)
 {
-    ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNode> childNode;
-    RETURN_IF_FAILED(node->get_FirstChild(&childNode));
-
-    while (childNode != nullptr)
+    for (const auto& block : blocks)
     {
-        HString nodeName;
-        RETURN_IF_FAILED(childNode->get_NodeName(nodeName.GetAddressOf()));
-
-        INT32 isLinkResult;
-        RETURN_IF_FAILED(WindowsCompareStringOrdinal(nodeName.Get(), HStringReference(L"a").Get(), &isLinkResult));
-
-        INT32 isBoldResult;
-        RETURN_IF_FAILED(WindowsCompareStringOrdinal(nodeName.Get(), HStringReference(L"strong").Get(), &isBoldResult));
-
-        INT32 isItalicResult;
-        RETURN_IF_FAILED(WindowsCompareStringOrdinal(nodeName.Get(), HStringReference(L"em").Get(), &isItalicResult));
-
-        INT32 isTextResult;
-        RETURN_IF_FAILED(WindowsCompareStringOrdinal(nodeName.Get(), HStringReference(L"#text").Get(), &isTextResult));
-
-        if (isLinkResult == 0)
+        if (block.type != MarkDownBlockType::ContainerBlock)
         {
-            RETURN_IF_FAILED(AddLinkInline(renderContext, childNode.Get(), isBold, isItalic, inlines));
+            RETURN_IF_FAILED(AddListMarkerInline(block, inlines));
         }
-        else if (isTextResult == 0)
-        {
-            ComPtr<ABI::Windows::UI::Xaml::Documents::IRun> run;
-            RETURN_IF_FAILED(XamlRunFromXmlNode(childNode.Get(), &run));
 
-            ComPtr<ABI::Windows::UI::Xaml::Documents::ITextElement> runAsTextElement;
-            RETURN_IF_FAILED(run.As(&runAsTextElement));
-
-            if (isBold)
+        const std::vector<MarkDownRun>& runs = block.runs;
+        size_t i = 0;
+        while (i < runs.size())
+        {
+            // a link without a destination has no uri to navigate to, so its text is a plain run
+            if (runs[i].linkIndex < 0 || runs[i].linkTarget.empty())
             {
-                ComPtr<IAdaptiveHostConfig> hostConfig;
-                RETURN_IF_FAILED(renderContext->get_HostConfig(&hostConfig));
-
-                ComPtr<IAdaptiveFontWeightsConfig> fontWeightsConfig;
-                RETURN_IF_FAILED(hostConfig->get_FontWeights(&fontWeightsConfig));
-
-                ABI::Windows::UI::Text::FontWeight boldFontWeight;
-                RETURN_IF_FAILED(fontWeightsConfig->get_Bolder(&boldFontWeight.Weight));
-
-                RETURN_IF_FAILED(runAsTextElement->put_FontWeight(boldFontWeight));
+                RETURN_IF_FAILED(AddRunInline(renderContext, runs[i], inlines));
+                i++;
             }
-
-            if (isItalic)
+            else
             {
-                RETURN_IF_FAILED(runAsTextElement->put_FontStyle(ABI::Windows::UI::Text::FontStyle::FontStyle_Italic));
+                // consecutive runs of a link differ only in formatting, and make up one hyperlink
+                size_t end = i + 1;
+                while (end < runs.size() && runs[end].linkIndex == runs[i].linkIndex)
+                {
+                    end++;
+                }
+                RETURN_IF_FAILED(AddLinkInline(renderContext, runs, i, end, inlines));
+                i = end;
             }
-
-            ComPtr<ABI::Windows::UI::Xaml::Documents::IInline> runAsInline;
-            RETURN_IF_FAILED(run.As(&runAsInline));
-
-            RETURN_IF_FAILED(inlines->Append(runAsInline.Get()));
-        }
-        else
-        {
-            RETURN_IF_FAILED(AddTextInlines(renderContext, childNode.Get(), isBold || (isBoldResult == 0), isItalic || (isItalicResult == 0), inlines));
         }
-
-        ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNode> nextChildNode;
-        RETURN_IF_FAILED(childNode->get_NextSibling(&nextChildNode));
-        childNode = nextChildNode;
     }
-
     return S_OK;
 }
-
-HRESULT AddHtmlInlines(
-    IAdaptiveRenderContext* renderContext,
-    ABI::Windows::Data::Xml::Dom::IXmlNode * node,
-    IVector<ABI::Windows::UI::Xaml::Documents::Inline*>* inlines)
-{
-    ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNode> childNode;
-    RETURN_IF_FAILED(node->get_FirstChild(&childNode));
-
-    while (childNode != nullptr)
-    {
-        HString nodeName;
-        RETURN_IF_FAILED(childNode->get_NodeName(nodeName.GetAddressOf()));
-
-        INT32 isOrderedListResult;
-        RETURN_IF_FAILED(WindowsCompareStringOrdinal(nodeName.Get(), HStringReference(L"ol").Get(), &isOrderedListResult));
-
-        INT32 isUnorderedListResult;
-        RETURN_IF_FAILED(WindowsCompareStringOrdinal(nodeName.Get(), HStringReference(L"ul").Get(), &isUnorderedListResult));
-
-        INT32 isParagraphResult;
-        RETURN_IF_FAILED(WindowsCompareStringOrdinal(nodeName.Get(), HStringReference(L"p").Get(), &isParagraphResult));
-
-        if ((isOrderedListResult == 0) || (isUnorderedListResult == 0))
-        {
-            RETURN_IF_FAILED(AddListInlines(renderContext, childNode.Get(), (isOrderedListResult == 0), inlines));
-        }
-        else if (isParagraphResult == 0)
-        {
-            RETURN_IF_FAILED(AddTextInlines(renderContext, childNode.Get(), false, false, inlines));
-        }
-        else
-        {
-            RETURN_IF_FAILED(AddHtmlInlines(renderContext, childNode.Get(), inlines));
-        }
-
-        ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNode> nextChildNode;
-        RETURN_IF_FAILED(childNode->get_NextSibling(&nextChildNode));
-        childNode = nextChildNode;
-    }
-    return S_OK;
-}
\ No newline at end of file
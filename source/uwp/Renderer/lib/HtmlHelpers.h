@@ -1,13 +1,9 @@
 #pragma once
 
-HRESULT AddHtmlInlines(
-    ABI::AdaptiveNamespace::IAdaptiveRenderContext* renderContext,
-    ABI::Windows::Data::Xml::Dom::IXmlNode * node,
-    ABI::Windows::Foundation::Collections::IVector<ABI::Windows::UI::Xaml::Documents::Inline*>* inlines);
+#include "MarkDownParser.h"
 
-HRESULT AddTextInlines(
+// Adds the paragraphs and list items of a MarkDownParser as runs, bulleted or numbered for list items
+HRESULT AddMarkDownInlines(
     ABI::AdaptiveNamespace::IAdaptiveRenderContext* renderContext,
-    ABI::Windows::Data::Xml::Dom::IXmlNode* node,
-    BOOL isBold,
-    BOOL isItalic,
-    ABI::Windows::Foundation::Collections::IVector<ABI::Windows::UI::Xaml::Documents::Inline*>* inlines);
\ No newline at end of file
+    const std::vector<AdaptiveSharedNamespace::MarkDownBlock>& blocks,
+    ABI::Windows::Foundation::Collections::IVector<ABI::Windows::UI::Xaml::Documents::Inline*>* inlines);
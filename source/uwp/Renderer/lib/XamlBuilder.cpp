@@ -17,7 +17,7 @@
 #include "json/json.h"
 #include "WholeItemsPanel.h"
 #include "AdaptiveCardRendererComponent.h"
-#include "MarkDownParser.h"
+#include "TextProcessingCache.h"
 #include "HtmlHelpers.h"
 #include "DateTimeParser.h"
 
@@ -1245,41 +1245,46 @@ AdaptiveNamespaceStart
         StyleXamlTextBlock(textSize, textColor, containerStyle, Boolify(isSubtle), wrap, maxWidth, textWeight, xamlTextBlock, hostConfig);
     }
 
+    // Hash of what the dates of text are formatted with besides their language: the time zone they
+    // are converted to, and the user's locale, which DateTimeParser falls back to for an empty or
+    // unknown language. Text without dates comes out the same either way, and hashes to 0.
+    unsigned long long GetDateFormattingOptionsHash(const std::string& text)
+    {
+        if (text.find("{{") == std::string::npos)
+        {
+            return 0;
+        }
+
+        DYNAMIC_TIME_ZONE_INFORMATION timeZone{};
+        GetDynamicTimeZoneInformation(&timeZone);
+        WCHAR localeName[LOCALE_NAME_MAX_LENGTH]{};
+        GetUserDefaultLocaleName(localeName, LOCALE_NAME_MAX_LENGTH);
+
+        std::wstring options(timeZone.TimeZoneKeyName);
+        options += L'|';
+        options += localeName;
+        return std::hash<std::wstring>()(options);
+    }
+
     HRESULT SetTextOnXamlTextBlock(
         IAdaptiveRenderContext* renderContext,
         HSTRING textIn,
         HSTRING language,
         ITextBlock * textBlock)
     {
-        DateTimeParser parser(HStringToUTF8(language));
-        auto textWithParsedDates = parser.GenerateString(HStringToUTF8(textIn));
-
-        MarkDownParser markdownParser(textWithParsedDates);
-        auto htmlString = markdownParser.TransformToHtml();
-
-        HString htmlHString;
-        UTF8ToHString(htmlString, htmlHString.GetAddressOf());
-        
-        ComPtr<ABI::Windows::Data::Xml::Dom::IXmlDocument> xmlDocument = XamlHelpers::CreateXamlClass<ABI::Windows::Data::Xml::Dom::IXmlDocument>(HStringReference(RuntimeClass_Windows_Data_Xml_Dom_XmlDocument));
-
-        ComPtr<ABI::Windows::Data::Xml::Dom::IXmlDocumentIO> xmlDocumentIO;
-        RETURN_IF_FAILED(xmlDocument.As(&xmlDocumentIO));
-        
-        HRESULT hr = xmlDocumentIO->LoadXml(htmlHString.Get());
-        if (FAILED(hr))
-        {
-            RETURN_IF_FAILED(textBlock->put_Text(textIn));
-        }
-        else
-        {
-            ComPtr<IVector<ABI::Windows::UI::Xaml::Documents::Inline*>> inlines;
-            RETURN_IF_FAILED(textBlock->get_Inlines(inlines.GetAddressOf()));
-
-            ComPtr<ABI::Windows::Data::Xml::Dom::IXmlNode> xmlDocumentAsNode;
-            RETURN_IF_FAILED(xmlDocument.As(&xmlDocumentAsNode));
-
-            RETURN_IF_FAILED(AddHtmlInlines(renderContext, xmlDocumentAsNode.Get(), inlines.Get()));
-        }
+        const std::string text = HStringToUTF8(textIn);
+        const std::string languageString = HStringToUTF8(language);
+        DateTimeParser parser(languageString);
+        auto blocks = TextProcessingCache::GetDefault()->TransformToBlocks(
+            text,
+            languageString,
+            GetDateFormattingOptionsHash(text),
+            [&parser](const DateTimePreparser& preparser) { return parser.GenerateString(preparser); });
+
+        ComPtr<IVector<ABI::Windows::UI::Xaml::Documents::Inline*>> inlines;
+        RETURN_IF_FAILED(textBlock->get_Inlines(inlines.GetAddressOf()));
+
+        RETURN_IF_FAILED(AddMarkDownInlines(renderContext, *blocks, inlines.Get()));
 
         return S_OK;
     }